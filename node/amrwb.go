@@ -0,0 +1,155 @@
+package node
+
+import (
+	"errors"
+	"fmt"
+)
+
+// RFC 4867 AMR-WB payload formats, see EvsDecoder.AmrWb, AmrWbToEvsIo and EvsIoToAmrWb
+const (
+	AmrWbOctetAligned       = 1 // octet-align=1: CMR octet, ToC octet, speech bits padded to an octet
+	AmrWbBandwidthEfficient = 2 // default mode: 4 bit CMR, 6 bit ToC and the speech bits without padding
+)
+
+// AmrWbNoCmr is the CMR of a payload without codec mode request
+const AmrWbNoCmr byte = 15
+
+// AMR-WB frame types, RFC 4867 clause 4.3.2 (TS 26.201)
+const (
+	amrWbFtSid        = 9
+	amrWbFtSpeechLost = 14
+	amrWbFtNoData     = 15
+)
+
+// speech (or comfort noise) bits of the AMR-WB frame types 0..9, 6.6..23.85 kbps and SID.
+// EVS AMR-WB IO carries the same bits in the same order, the payload size gives the frame type.
+var amrWbFrameBits = [amrWbFtSid + 1]int{132, 177, 253, 285, 317, 365, 397, 461, 477, 40}
+
+// AmrWbToEvsIo converts a single-frame RFC 4867 AMR-WB payload into the EVS AMR-WB IO payload
+// of EvsDecoder.DecodeEvsToPcm and returns the codec mode request of the AMR-WB sender.
+// No audio is decoded: the frame type moves from the ToC into the payload size and the speech
+// bits are copied, SID frames keep their STI and mode indication bits. A NO_DATA, lost or
+// damaged (Q=0) frame gives an empty payload, which the EVS decoder conceals.
+func AmrWbToEvsIo(payload []byte, format int) (evs []byte, cmr byte, err error) {
+	cmr, ft, q, speech, err := parseAmrWb(payload, format)
+	if err != nil {
+		return nil, AmrWbNoCmr, err
+	}
+	if ft > amrWbFtSid || q == 0 {
+		return nil, cmr, nil
+	}
+	return speech, cmr, nil
+}
+
+// EvsIoToAmrWb converts an EVS AMR-WB IO payload of EvsEncoder.EncodePcmToEvs into a single-frame
+// RFC 4867 AMR-WB payload with codec mode request cmr (AmrWbNoCmr for none). An empty payload
+// (DTX NO_DATA) gives a NO_DATA frame, EVS primary frames have no AMR-WB equivalent.
+func EvsIoToAmrWb(evs []byte, cmr byte, format int) ([]byte, error) {
+	ft := byte(amrWbFtNoData)
+	if len(evs) > 0 {
+		ft = 0
+		for int(ft) <= amrWbFtSid && (amrWbFrameBits[ft]+7)/8 != len(evs) {
+			ft++
+		}
+		if ft > amrWbFtSid {
+			return nil, errors.New(fmt.Sprintf("%v byte payload is no EVS AMR-WB IO frame", len(evs)))
+		}
+	}
+	return buildAmrWb(cmr, ft, 1, evs, format)
+}
+
+// amrWbStorageFrame converts an RFC 4867 payload into the frame of the RFC 4867 storage format
+// (clause 5.3), frame header |P|FT|Q|P|P| and speech bits, as read by the decoder with AMR-WB input
+func amrWbStorageFrame(payload []byte, format int) ([]byte, error) {
+	_, ft, q, speech, err := parseAmrWb(payload, format)
+	if err != nil {
+		return nil, err
+	}
+	frame := make([]byte, 1+len(speech))
+	frame[0] = ft<<3 | q<<2
+	copy(frame[1:], speech)
+	return frame, nil
+}
+
+// parseAmrWb splits a single-frame RFC 4867 payload, the speech bits are returned octet aligned
+// with zero padding
+func parseAmrWb(payload []byte, format int) (cmr byte, ft byte, q byte, speech []byte, err error) {
+	var offset int // bit position of the speech bits
+	switch format {
+	case AmrWbOctetAligned:
+		if len(payload) < 2 {
+			return 0, 0, 0, nil, errors.New(fmt.Sprintf("%v byte AMR-WB payload too short", len(payload)))
+		}
+		cmr = payload[0] >> 4
+		if payload[1]&0x80 != 0 {
+			return 0, 0, 0, nil, errors.New(fmt.Sprintf("AMR-WB payload with several frames not supported"))
+		}
+		ft = payload[1] >> 3 & 0x0f
+		q = payload[1] >> 2 & 0x01
+		offset = 16
+	case AmrWbBandwidthEfficient:
+		if len(payload) < 2 {
+			return 0, 0, 0, nil, errors.New(fmt.Sprintf("%v byte AMR-WB payload too short", len(payload)))
+		}
+		cmr = payload[0] >> 4
+		if payload[0]&0x08 != 0 {
+			return 0, 0, 0, nil, errors.New(fmt.Sprintf("AMR-WB payload with several frames not supported"))
+		}
+		ft = (payload[0]&0x07)<<1 | payload[1]>>7
+		q = payload[1] >> 6 & 0x01
+		offset = 10
+	default:
+		return 0, 0, 0, nil, errors.New(fmt.Sprintf("unknown AMR-WB payload format %v", format))
+	}
+
+	bits := 0
+	if ft <= amrWbFtSid {
+		bits = amrWbFrameBits[ft]
+	} else if ft != amrWbFtSpeechLost && ft != amrWbFtNoData {
+		return 0, 0, 0, nil, errors.New(fmt.Sprintf("reserved AMR-WB frame type %v", ft))
+	}
+	if (offset+bits+7)/8 > len(payload) {
+		return 0, 0, 0, nil, errors.New(fmt.Sprintf("%v byte AMR-WB payload too short for frame type %v", len(payload), ft))
+	}
+	speech = make([]byte, (bits+7)/8)
+	copyBits(speech, 0, payload, offset, bits)
+	return cmr, ft, q, speech, nil
+}
+
+// buildAmrWb writes a single-frame RFC 4867 payload
+func buildAmrWb(cmr byte, ft byte, q byte, speech []byte, format int) ([]byte, error) {
+	bits := 0
+	if ft <= amrWbFtSid {
+		bits = amrWbFrameBits[ft]
+	}
+	switch format {
+	case AmrWbOctetAligned:
+		payload := make([]byte, 2+(bits+7)/8)
+		payload[0] = cmr << 4
+		payload[1] = ft<<3 | q<<2
+		copyBits(payload, 16, speech, 0, bits)
+		return payload, nil
+	case AmrWbBandwidthEfficient:
+		payload := make([]byte, (10+bits+7)/8)
+		payload[0] = cmr<<4 | ft>>1
+		payload[1] = (ft&0x01)<<7 | q<<6
+		copyBits(payload, 10, speech, 0, bits)
+		return payload, nil
+	}
+	return nil, errors.New(fmt.Sprintf("unknown AMR-WB payload format %v", format))
+}
+
+// copyBits copies n bits, MSB first, from bit position srcBit of src to bit position dstBit of dst
+func copyBits(dst []byte, dstBit int, src []byte, srcBit int, n int) {
+	if dstBit%8 == 0 && srcBit%8 == 0 {
+		copy(dst[dstBit/8:], src[srcBit/8:(srcBit+n)/8])
+		dstBit, srcBit, n = dstBit+n&^7, srcBit+n&^7, n&7
+	}
+	for ; n > 0; n-- {
+		if src[srcBit>>3]&(0x80>>(srcBit&7)) != 0 {
+			dst[dstBit>>3] |= 0x80 >> (dstBit & 7)
+		}
+		dstBit++
+		srcBit++
+	}
+}
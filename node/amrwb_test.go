@@ -0,0 +1,139 @@
+package node
+
+import (
+	"bytes"
+	"sync"
+	"testing"
+)
+
+// TestAmrWbPayload checks the RFC 4867 headers and payload sizes written for EVS AMR-WB IO frames
+func TestAmrWbPayload(t *testing.T) {
+	for _, tc := range []struct {
+		ft     int
+		format int
+		header []byte
+		size   int
+	}{
+		{2, AmrWbOctetAligned, []byte{0xf0, 0x14}, 34},       // 12.65 kbps
+		{2, AmrWbBandwidthEfficient, []byte{0xf1, 0x40}, 33}, // 10 header bits + 253 speech bits
+		{8, AmrWbBandwidthEfficient, []byte{0xf4, 0x40}, 61}, // 23.85 kbps
+		{amrWbFtSid, AmrWbOctetAligned, []byte{0xf0, 0x4c}, 7},
+		{amrWbFtNoData, AmrWbOctetAligned, []byte{0xf0, 0x7c}, 2},
+		{amrWbFtNoData, AmrWbBandwidthEfficient, []byte{0xf7, 0xc0}, 2},
+	} {
+		var evs []byte
+		if tc.ft <= amrWbFtSid {
+			evs = make([]byte, (amrWbFrameBits[tc.ft]+7)/8)
+			for i := 0; i < amrWbFrameBits[tc.ft]; i += 3 {
+				evs[i/8] |= 0x80 >> (i % 8)
+			}
+		}
+		amrWb, err := EvsIoToAmrWb(evs, AmrWbNoCmr, tc.format)
+		if err != nil {
+			t.Fatal(err)
+		}
+		header := []byte{amrWb[0], amrWb[1]}
+		if tc.format == AmrWbBandwidthEfficient {
+			header[1] &= 0xc0 // the speech bits start after F, FT and Q
+		}
+		if len(amrWb) != tc.size || !bytes.Equal(header, tc.header) {
+			t.Errorf("frame type %d format %d: header % x size %d, want % x size %d", tc.ft, tc.format, header, len(amrWb), tc.header, tc.size)
+		}
+		back, cmr, err := AmrWbToEvsIo(amrWb, tc.format)
+		if err != nil || cmr != AmrWbNoCmr || !bytes.Equal(back, evs) {
+			t.Errorf("frame type %d format %d: converted back to % x cmr %d err %v", tc.ft, tc.format, back, cmr, err)
+		}
+	}
+	if _, err := EvsIoToAmrWb(make([]byte, 33), AmrWbNoCmr, AmrWbOctetAligned); err == nil {
+		t.Errorf("EVS primary 13.2 kbps frame converted to AMR-WB")
+	}
+}
+
+// TestAmrWbStartFailure checks that an AMR-WB decoder in the G.192 format or with Jbm does not
+// start and decodes nothing
+func TestAmrWbStartFailure(t *testing.T) {
+	for _, tc := range []struct {
+		isG192 int
+		jbm    bool
+	}{
+		{1, false}, // AMR-WB payloads need the MIME format
+		{0, true},  // and no jitter buffer
+	} {
+		dec := NewEvsDecoder()
+		dec.SampleRate = 16000
+		dec.BitRate = 12650
+		dec.IsG192 = tc.isG192
+		dec.Jbm = tc.jbm
+		dec.AmrWb = AmrWbOctetAligned
+		if err := dec.StartDecoder(); err == nil {
+			t.Fatalf("G.192 %d jitter buffer %v: AMR-WB decoder started", tc.isG192, tc.jbm)
+		}
+		if pcm := dec.DecodeEvsToPcm(nil); pcm != nil {
+			t.Errorf("G.192 %d jitter buffer %v: %d bytes decoded after a failed start", tc.isG192, tc.jbm, len(pcm))
+		}
+		dec.StopDecoder()
+	}
+}
+
+// TestAmrWbPassthrough converts the AMR-WB IO frames of an EVS encoder with DTX to RFC 4867 payloads
+// and back without decoding, and checks that the EVS payloads and the AMR-WB payloads of both formats
+// decode to the same pcm
+func TestAmrWbPassthrough(t *testing.T) {
+	pcm := speechWithPauses(t, 1)
+	var stop sync.WaitGroup
+	defer stop.Wait()
+
+	for _, bitRate := range []int{6600, 12650, 23850} {
+		enc := NewEvsEncoder()
+		enc.SampleRate = 16000
+		enc.MaxBand = "WB"
+		enc.BitRate = bitRate
+		enc.Dtx = 8
+		if err := enc.StartEncoder(); err != nil {
+			t.Fatal(err)
+		}
+		decs := make([]*EvsDecoder, 3)
+		for i, format := range []int{0, AmrWbOctetAligned, AmrWbBandwidthEfficient} {
+			decs[i] = NewEvsDecoder()
+			decs[i].SampleRate = 16000
+			decs[i].BitRate = bitRate
+			decs[i].AmrWb = format
+			if err := decs[i].StartDecoder(); err != nil {
+				t.Fatal(err)
+			}
+		}
+
+		var sid int
+		for i := 0; i+640 <= len(pcm); i += 640 {
+			frame := enc.EncodePcmToEvs(pcm[i : i+640])
+			if len(frame) == amrWbSidSize {
+				sid++
+			}
+			want := decs[0].DecodeEvsToPcm(frame)
+			if len(want) != 640 {
+				t.Fatalf("%d bps frame %d: %d bytes decoded", bitRate, i/640, len(want))
+			}
+			for _, dec := range decs[1:] {
+				amrWb, err := EvsIoToAmrWb(frame, AmrWbNoCmr, dec.AmrWb)
+				if err != nil {
+					t.Fatalf("%d bps frame %d: %v", bitRate, i/640, err)
+				}
+				if back, _, _ := AmrWbToEvsIo(amrWb, dec.AmrWb); !bytes.Equal(back, frame) {
+					t.Fatalf("%d bps frame %d format %d: payload changed by the conversion", bitRate, i/640, dec.AmrWb)
+				}
+				if out := dec.DecodeEvsToPcm(amrWb); !bytes.Equal(out, want) {
+					t.Fatalf("%d bps frame %d format %d: AMR-WB payload decoded differently", bitRate, i/640, dec.AmrWb)
+				}
+			}
+		}
+		if sid == 0 {
+			t.Errorf("%d bps: no AMR-WB SID frame", bitRate)
+		}
+
+		stop.Add(1 + len(decs))
+		go func() { defer stop.Done(); enc.StopEncoder() }()
+		for _, dec := range decs {
+			go func(dec *EvsDecoder) { defer stop.Done(); dec.StopDecoder() }(dec)
+		}
+	}
+}
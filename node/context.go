@@ -26,10 +26,10 @@ func newEvsEncoderContext() *EvsEncoderContext {
 	return (*EvsEncoderContext)(C.NewEvsEncoder())
 }
 
-func (enc *EvsEncoderContext) initEvsEncoder(sample int, bitRate int, codec string, isG192Format int) int {
+func (enc *EvsEncoderContext) initEvsEncoder(sample int, bitRate int, codec string, isG192Format int, dtx int) int {
 	p := C.CString(codec)
 	defer C.free(unsafe.Pointer(p))
-	res := int(C.InitEncoder(enc, (C.int)(sample), (C.int)(bitRate), p, (C.int)(isG192Format)))
+	res := int(C.InitEncoder(enc, (C.int)(sample), (C.int)(bitRate), p, (C.int)(isG192Format), (C.int)(dtx)))
 	return res
 }
 
@@ -48,12 +48,34 @@ func (enc *EvsEncoderContext) startEvsEncoder(payload []byte) []byte {
 
 	buffer := enc.buf
 	if buffer.size > 0 {
-		return C.GoBytes(unsafe.Pointer(&buffer.data[0]), buffer.size)
+		return C.GoBytes(unsafe.Pointer(buffer.data), buffer.size)
 	} else {
 		return nil
 	}
 }
 
+func (enc *EvsEncoderContext) setEvsComplexity(profile int) int {
+	return int(C.EvsSetComplexity(enc, (C.int)(profile)))
+}
+
+func (enc *EvsEncoderContext) setEvsBitrate(bitRate int) int {
+	return int(C.EvsSetBitrate(enc, (C.int)(bitRate)))
+}
+
+func (enc *EvsEncoderContext) setEvsMaxBandwidth(band string) int {
+	p := C.CString(band)
+	defer C.free(unsafe.Pointer(p))
+	return int(C.EvsSetMaxBandwidth(enc, p))
+}
+
+func (enc *EvsEncoderContext) applyEvsCmr(cmr byte) int {
+	return int(C.EvsApplyCmr(enc, (C.int)(cmr)))
+}
+
+func (enc *EvsEncoderContext) setEvsChannelAware(fecIndicator int, offset int) int {
+	return int(C.EvsSetChannelAware(enc, (C.int)(fecIndicator), (C.int)(offset)))
+}
+
 func (enc *EvsEncoderContext) stopEvsEncoder() {
 	C.StopEncoder(enc)
 }
@@ -78,7 +100,51 @@ func (dec *EvsDecoderContext) startEvsDecoder(payload []byte) []byte {
 	}
 
 	C.EvsStartDecoder(dec, (*C.char)(unsafe.Pointer(&payload[0])))
+	return dec.output()
+}
+
+func (dec *EvsDecoderContext) decodeEvsNoData() []byte {
+	C.EvsDecodeNoData(dec)
+	return dec.output()
+}
+
+// decodeEvsLanes decodes frame i of data, sizes[i] bytes, on decs[i]; it returns the number of
+// streams not decoded
+func decodeEvsLanes(decs []*EvsDecoderContext, data []byte, sizes []int32) int {
+	if len(decs) == 0 {
+		return 0
+	}
+	var p *C.char
+	if len(data) > 0 {
+		p = (*C.char)(unsafe.Pointer(&data[0]))
+	}
+	return int(C.EvsDecodeLanes(&decs[0], p, (*C.int)(unsafe.Pointer(&sizes[0])), C.int(len(decs))))
+}
+
+// decodeEvsMix decodes as decodeEvsLanes and mixes the pcm into nBus buses of mix and the N-1
+// outputs, gains and buses may be nil
+func decodeEvsMix(decs []*EvsDecoderContext, data []byte, sizes []int32, gains []int16, buses []uint32, nBus int, mix []int16, nMinusOne []int16) int {
+	var p *C.char
+	var g *C.Word16
+	var m *C.uint
+	var n1 *C.Word16
+	if len(data) > 0 {
+		p = (*C.char)(unsafe.Pointer(&data[0]))
+	}
+	if gains != nil {
+		g = (*C.Word16)(unsafe.Pointer(&gains[0]))
+	}
+	if buses != nil {
+		m = (*C.uint)(unsafe.Pointer(&buses[0]))
+	}
+	if nMinusOne != nil {
+		n1 = (*C.Word16)(unsafe.Pointer(&nMinusOne[0]))
+	}
+	return int(C.EvsDecodeMix(&decs[0], p, (*C.int)(unsafe.Pointer(&sizes[0])), C.int(len(decs)), g, m, C.int(nBus),
+		(*C.Word16)(unsafe.Pointer(&mix[0])), n1))
+}
 
+func (dec *EvsDecoderContext) output() []byte {
 	buffer := dec.buf
 	if buffer.size > 0 {
 		return C.GoBytes(unsafe.Pointer(&buffer.data[0]), C.int(buffer.size)*C.int(unsafe.Sizeof(buffer.data[0])))
@@ -87,10 +153,64 @@ func (dec *EvsDecoderContext) startEvsDecoder(payload []byte) []byte {
 	}
 }
 
+func (dec *EvsDecoderContext) setEvsPostFilter(enable bool) int {
+	on := 0
+	if enable {
+		on = 1
+	}
+	return int(C.EvsSetPostFilter(dec, (C.int)(on)))
+}
+
+func (dec *EvsDecoderContext) setEvsAmrWbInput(enable bool) int {
+	on := 0
+	if enable {
+		on = 1
+	}
+	return int(C.EvsSetAmrWbInput(dec, (C.int)(on)))
+}
+
+func (dec *EvsDecoderContext) openEvsReceiver(jbmSafetyMargin int) int {
+	return int(C.EvsRxOpen(dec, (C.int)(jbmSafetyMargin)))
+}
+
+func (dec *EvsDecoderContext) feedEvsPacket(payload []byte, seq uint16, timeStamp uint32, rcvTime uint32) int {
+	if len(payload) == 0 {
+		return 0
+	}
+	return int(C.EvsRxFeedPacket(dec, (*C.char)(unsafe.Pointer(&payload[0])), (C.int)(seq), (C.uint)(timeStamp), (C.uint)(rcvTime)))
+}
+
+func (dec *EvsDecoderContext) getEvsSamples(systemTime uint32) []byte {
+	if C.EvsRxGetSamples(dec, (C.uint)(systemTime)) != 0 {
+		return nil
+	}
+	return dec.output()
+}
+
+func (dec *EvsDecoderContext) getEvsFecOffset() (int, int) {
+	var fecIndicator, offset C.int
+	C.EvsRxGetFecOffset(dec, &fecIndicator, &offset)
+	return int(fecIndicator), int(offset)
+}
+
+func (dec *EvsDecoderContext) getEvsRxStatistics() (int, int, int) {
+	var decoded, concealed, partialCopy C.int
+	C.EvsRxGetStatistics(dec, &decoded, &concealed, &partialCopy)
+	return int(decoded), int(concealed), int(partialCopy)
+}
+
+func (dec *EvsDecoderContext) isEvsRxEmpty() bool {
+	return C.EvsRxIsEmpty(dec) != 0
+}
+
 func (dec *EvsDecoderContext) stopEvsDecoder() {
 	C.StopDecoder(dec)
 }
 
+func (dec *EvsDecoderContext) freeEvsDecoder() {
+	C.FreeDecoder(dec)
+}
+
 func UnitTestDecoder() {
 	C.UnitTestEvsDecoder()
 }
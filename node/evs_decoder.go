@@ -8,13 +8,17 @@ import (
 // EvsDecoder this node receives pcm data, keep tracking each ongoing telephone event code until end-bit in its last
 // frame is seen, then send the finished event code to output in pcm packet 16bit pcm_s16se
 type EvsDecoder struct {
-	SampleRate     int
-	BitRate        int
-	IsG192         int //0 MIME 1 G192
-	isDecoderStart bool
-	realBitRate    int
-	debugPrint     bool
-	ctx            *EvsDecoderContext
+	SampleRate      int
+	BitRate         int
+	IsG192          int  //0 MIME 1 G192
+	NoPostFilter    bool //skip the NB/WB post-filter, e.g. when the pcm is re-encoded
+	Jbm             bool //receive packets through the jitter buffer, FeedPacket and GetSamples instead of DecodeEvsToPcm
+	JbmSafetyMargin int  //delay reserve of the jitter buffer in ms besides the network jitter, 60 if 0
+	AmrWb           int  //0 EVS payloads, AmrWbOctetAligned or AmrWbBandwidthEfficient: RFC 4867 payloads of an AMR-WB leg
+	isDecoderStart  bool
+	realBitRate     int
+	debugPrint      bool
+	ctx             *EvsDecoderContext
 }
 
 const (
@@ -39,6 +43,16 @@ const (
 	Br19850 byte = 0x36
 	Br23050 byte = 0x37
 	Br23850 byte = 0x38
+
+	BrSid     byte = 0xc  // EVS Primary SID, 2.4 kbps
+	BrSid1k75 byte = 0x39 // AMR-WB IO SID
+)
+
+// payload sizes of DTX frames
+const (
+	amrWbSidSize  = 5
+	evsSidSize    = 6
+	headerFullSid = 7 // ToC byte and EVS SID, see clause A.2.1.3
 )
 
 func NewEvsDecoder() *EvsDecoder {
@@ -59,11 +73,30 @@ func (n *EvsDecoder) StartDecoder() error {
 
 	fmt.Printf("EvsDecoder init stream isG192:%v sample rate %v bitRate:%v\n", n.IsG192, n.SampleRate, n.BitRate)
 
+	if n.AmrWb != 0 && (n.Jbm || n.IsG192 != 0) {
+		return errors.New(fmt.Sprintf("evsDecoder AMR-WB payloads need the MIME format without Jbm"))
+	}
+
 	if n.ctx != nil {
 		res := n.ctx.initEvsDecoder(n.SampleRate, n.BitRate, n.IsG192)
 		if res != 0 {
 			return errors.New(fmt.Sprintf("evsDecoder init fail"))
 		} else {
+			if n.NoPostFilter {
+				n.ctx.setEvsPostFilter(false)
+			}
+			if n.AmrWb != 0 && n.ctx.setEvsAmrWbInput(true) != 0 {
+				return errors.New(fmt.Sprintf("evsDecoder AMR-WB input fail"))
+			}
+			if n.Jbm {
+				if n.JbmSafetyMargin <= 0 {
+					n.JbmSafetyMargin = 60
+				}
+				if n.ctx.openEvsReceiver(n.JbmSafetyMargin) != 0 {
+					return errors.New(fmt.Sprintf("evsDecoder jitter buffer open fail"))
+				}
+			}
+			// started only once the whole setup succeeded
 			n.isDecoderStart = true
 			fmt.Printf("EvsDecoder StartDecoder success\n")
 		}
@@ -71,13 +104,21 @@ func (n *EvsDecoder) StartDecoder() error {
 	return nil
 }
 
-// DecodeEvsToPcm input payload evs
+// DecodeEvsToPcm input payload evs (RFC 4867 AMR-WB with AmrWb), empty for a frame period without payload
+// (DTX pause or packet not received), which gives comfort noise or concealment
 // output pcm
 func (n *EvsDecoder) DecodeEvsToPcm(payload []byte) []byte {
-	if len(payload) <= 7 { //2.4 (EVS Primary SID) and Special case(see clause A.2.1.3)
+	if n.ctx == nil || !n.isDecoderStart {
+		return nil
+	}
+	if len(payload) == 0 {
+		return n.ctx.decodeEvsNoData()
+	}
+	newPayload, err := n.codecFrame(payload)
+	if err != nil {
+		fmt.Printf("evsDecode %v\n", err)
 		return nil
 	}
-	newPayload := n.addToCHeader(payload)
 	evsDecoderData := n.ctx.startEvsDecoder(newPayload)
 	if evsDecoderData == nil {
 		fmt.Printf("evsDecode data nil error return\n")
@@ -86,12 +127,80 @@ func (n *EvsDecoder) DecodeEvsToPcm(payload []byte) []byte {
 	return evsDecoderData
 }
 
+// codecFrame returns the frame of a non-empty payload as decoded by the codec: RFC 4867 AMR-WB
+// payloads become storage frames, EVS payloads in the MIME format get their ToC
+func (n *EvsDecoder) codecFrame(payload []byte) ([]byte, error) {
+	if n.AmrWb != 0 {
+		return amrWbStorageFrame(payload, n.AmrWb)
+	} else if n.IsG192 == 0 && len(payload) != headerFullSid {
+		return n.addToCHeader(payload), nil
+	}
+	return payload, nil
+}
+
+// FeedPacket puts a received payload into the jitter buffer (Jbm decoder), with the RTP sequence
+// number, the RTP timestamp in ms and the arrival time in ms on the clock of GetSamples.
+// Packets may arrive late or out of order, a lost frame is recovered from the partial copy of a
+// later channel-aware packet if there is one. An empty payload (DTX NO_DATA) is not buffered.
+func (n *EvsDecoder) FeedPacket(payload []byte, seq uint16, timeStamp uint32, rcvTime uint32) error {
+	if n.ctx == nil || !n.isDecoderStart || !n.Jbm {
+		return errors.New(fmt.Sprintf("evsDecoder jitter buffer not started"))
+	}
+	newPayload := payload
+	if n.IsG192 == 0 && len(payload) != 0 && len(payload) != headerFullSid {
+		newPayload = n.addToCHeader(payload)
+	}
+	if n.ctx.feedEvsPacket(newPayload, seq, timeStamp, rcvTime) != 0 {
+		return errors.New(fmt.Sprintf("evsDecoder invalid packet of %v bytes", len(payload)))
+	}
+	return nil
+}
+
+// GetSamples plays out the next 20 ms of pcm of a Jbm decoder, call it every 20 ms with the
+// current time in ms. It is silence until the jitter buffer has filled up.
+func (n *EvsDecoder) GetSamples(systemTime uint32) []byte {
+	if n.ctx == nil || !n.isDecoderStart || !n.Jbm {
+		return nil
+	}
+	return n.ctx.getEvsSamples(systemTime)
+}
+
+// FecOffset returns the channel-aware configuration best suited for the losses seen by the jitter
+// buffer, to be requested from the far end encoder: FecLo or FecHi and the offset 2, 3, 5 or 7
+// frames, 0 as long as none could be derived
+func (n *EvsDecoder) FecOffset() (fecIndicator int, offset int) {
+	if n.ctx == nil || !n.isDecoderStart || !n.Jbm {
+		return 0, 0
+	}
+	return n.ctx.getEvsFecOffset()
+}
+
+// RxStatistics counts the frames played out by the jitter buffer, those concealed (lost, late or
+// inserted by time scaling) and those recovered from a partial copy
+func (n *EvsDecoder) RxStatistics() (decoded int, concealed int, partialCopy int) {
+	if n.ctx == nil || !n.isDecoderStart || !n.Jbm {
+		return 0, 0, 0
+	}
+	return n.ctx.getEvsRxStatistics()
+}
+
+// RxEmpty tells whether the jitter buffer holds no more frames, to drain it at the end of a call
+func (n *EvsDecoder) RxEmpty() bool {
+	if n.ctx == nil || !n.isDecoderStart || !n.Jbm {
+		return true
+	}
+	return n.ctx.isEvsRxEmpty()
+}
+
 func (n *EvsDecoder) StopDecoder() {
 	if n.ctx != nil {
 		if n.isDecoderStart {
 			n.isDecoderStart = false
 			n.ctx.stopEvsDecoder()
 			fmt.Printf("node %v StopDecoder success now\n", n)
+		} else {
+			// never started or a failed StartDecoder, free the state without waiting
+			n.ctx.freeEvsDecoder()
 		}
 		n.ctx = nil
 	}
@@ -102,7 +211,11 @@ func (n *EvsDecoder) addToCHeader(data []byte) []byte {
 
 	payLoadLen := len(data)
 	var toc byte
-	if payLoadLen == 17 { //EVS AMR-WB IO
+	if payLoadLen == amrWbSidSize {
+		toc = BrSid1k75
+	} else if payLoadLen == evsSidSize {
+		toc = BrSid
+	} else if payLoadLen == 17 { //EVS AMR-WB IO
 		n.realBitRate = 6600
 		toc = Br6600
 	} else if payLoadLen == 18 {
@@ -41,3 +41,173 @@ func TestDecoder(t *testing.T) {
 	}
 	dec.StopDecoder()
 }
+
+// lossTrace returns the lost frames of a channel with about 10% loss in bursts of up to 3 frames
+func lossTrace(frames int) []bool {
+	lost := make([]bool, frames)
+	seed := uint32(7)
+	for i := 0; i < frames; i++ {
+		seed = seed*1664525 + 1013904223
+		if seed>>24 < 12 {
+			for j := i; j < i+1+int(seed>>8)%3 && j < frames; j++ {
+				lost[j] = true
+			}
+		}
+	}
+	return lost
+}
+
+// newChannelAwareEncoder starts a 16 kHz WB 13.2 kbps encoder with partial copies at the given
+// offset, 0 without channel-aware mode
+func newChannelAwareEncoder(fecIndicator int, offset int) *EvsEncoder {
+	enc := NewEvsEncoder()
+	enc.SampleRate = 16000
+	enc.MaxBand = "WB"
+	enc.BitRate = 13200
+	enc.StartEncoder()
+	enc.SetChannelAware(fecIndicator, offset)
+	return enc
+}
+
+// encodeChannelAware encodes 16 kHz pcm with newChannelAwareEncoder(FecHi, offset)
+func encodeChannelAware(pcm []byte, offset int) [][]byte {
+	enc := newChannelAwareEncoder(FecHi, offset)
+	var frames [][]byte
+	for i := 0; i+640 <= len(pcm); i += 640 {
+		frames = append(frames, enc.EncodePcmToEvs(pcm[i:i+640]))
+	}
+	enc.StopEncoder()
+	return frames
+}
+
+// arrival is the receive time in ms of packet k, every fourth packet is 15 ms late
+func arrival(k int) uint32 {
+	if k%4 == 3 {
+		return uint32(k*20 + 15)
+	}
+	return uint32(k * 20)
+}
+
+// newReceiver starts a 16 kHz jitter buffer decoder
+func newReceiver(t testing.TB) *EvsDecoder {
+	dec := NewEvsDecoder()
+	dec.SampleRate = 16000
+	dec.BitRate = 13200
+	dec.Jbm = true
+	if err := dec.StartDecoder(); err != nil {
+		t.Fatal(err)
+	}
+	return dec
+}
+
+// receive plays frames out of a jitter buffer decoder, the lost frames are not fed, and returns
+// the decoder statistics
+func receive(t testing.TB, frames [][]byte, lost []bool) (decoded int, concealed int, partialCopy int) {
+	dec := newReceiver(t)
+	next := 0
+	for now := uint32(0); next < len(frames) || !dec.RxEmpty(); now += 20 {
+		for ; next < len(frames) && arrival(next) <= now; next++ {
+			if !lost[next] {
+				if err := dec.FeedPacket(frames[next], uint16(next), uint32(next*20), now); err != nil {
+					t.Fatal(err)
+				}
+			}
+		}
+		if out := dec.GetSamples(now); len(out) != 640 {
+			t.Fatalf("%d ms: %d bytes played out", now, len(out))
+		}
+	}
+	decoded, concealed, partialCopy = dec.RxStatistics()
+	dec.StopDecoder()
+	return
+}
+
+// TestDecoderNotStarted checks that a decoder decodes nothing before StartDecoder succeeded and
+// that stopping it frees the context
+func TestDecoderNotStarted(t *testing.T) {
+	dec := NewEvsDecoder()
+	if pcm := dec.DecodeEvsToPcm(nil); pcm != nil {
+		t.Errorf("%d bytes decoded before StartDecoder", len(pcm))
+	}
+	if _, err := DecodeLanes([]*EvsDecoder{dec}, [][]byte{nil}); err == nil {
+		t.Errorf("decoder accepted in lanes before StartDecoder")
+	}
+	dec.StopDecoder()
+	if dec.ctx != nil {
+		t.Errorf("context kept after StopDecoder")
+	}
+}
+
+// TestReceiverChannelAware sends a channel-aware stream over a lossy channel with jitter: lost
+// frames are recovered from partial copies, which leaves fewer frames to conceal than without
+func TestReceiverChannelAware(t *testing.T) {
+	pcm := speechWithPauses(t, 2)
+	lost := lossTrace(len(pcm) / 640)
+
+	_, concealed, partialCopy := receive(t, encodeChannelAware(pcm, 0), lost)
+	if partialCopy != 0 {
+		t.Errorf("%d partial copies without channel-aware mode", partialCopy)
+	}
+	_, concealedRf, partialCopyRf := receive(t, encodeChannelAware(pcm, 3), lost)
+	t.Logf("%d concealed frames, channel-aware %d concealed and %d partial copies", concealed, concealedRf, partialCopyRf)
+	if partialCopyRf == 0 || concealedRf >= concealed {
+		t.Errorf("channel-aware: %d partial copies, %d concealed frames (%d without)", partialCopyRf, concealedRf, concealed)
+	}
+
+	enc := NewEvsEncoder()
+	enc.SampleRate = 16000
+	enc.StartEncoder()
+	if enc.SetChannelAware(FecLo, 4) == nil {
+		t.Error("offset 4 accepted")
+	}
+	enc.StopEncoder()
+}
+
+// BenchmarkChannelAware measures the time per 20 ms frame of encoding, sending over the lossy channel
+// with jitter of TestReceiverChannelAware and playing out through the jitter buffer, with and
+// without channel-aware mode. concealed_% and recovered_% are the shares of played out frames that
+// were concealed and recovered from a partial copy.
+func BenchmarkChannelAware(b *testing.B) {
+	pcm := speechWithPauses(b, 2)
+	frames := len(pcm) / 640
+	lost := lossTrace(frames)
+
+	for _, bc := range []struct {
+		name         string
+		fecIndicator int
+		offset       int
+	}{
+		{"off", FecHi, 0},
+		{"lo3", FecLo, 3},
+		{"hi3", FecHi, 3},
+		{"hi5", FecHi, 5},
+	} {
+		b.Run(bc.name, func(b *testing.B) {
+			enc := newChannelAwareEncoder(bc.fecIndicator, bc.offset)
+			dec := newReceiver(b)
+			sent := make([][]byte, 0, 4)
+			next := 0
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				k := i % frames
+				sent = append(sent, enc.EncodePcmToEvs(pcm[k*640:k*640+640]))
+				now := uint32(i * 20)
+				for ; next <= i && arrival(next) <= now; next++ {
+					if !lost[next%frames] {
+						dec.FeedPacket(sent[0], uint16(next), uint32(next*20), now)
+					}
+					sent = sent[1:]
+				}
+				dec.GetSamples(now)
+			}
+			b.StopTimer()
+			decoded, concealed, partialCopy := dec.RxStatistics()
+			if decoded > 0 {
+				b.ReportMetric(100*float64(concealed)/float64(decoded), "concealed_%")
+				b.ReportMetric(100*float64(partialCopy)/float64(decoded), "recovered_%")
+			}
+			enc.StopEncoder()
+			dec.StopDecoder()
+		})
+	}
+}
@@ -3,6 +3,26 @@ package node
 import (
 	"errors"
 	"fmt"
+	"strings"
+)
+
+// encoder complexity profiles, see EvsEncoder.Complexity
+const (
+	ComplexityReference = 0 // full search effort of the reference encoder
+	ComplexityBalanced  = 1 // reduced ACELP codebook search and TCX rate loop
+	ComplexityFast      = 2 // lowest CPU, also reduced LSF search and speech/music classifier
+)
+
+// DTX settings, see EvsEncoder.Dtx
+const (
+	DtxOff      = 0  // every 20 ms frame is coded and sent
+	DtxAdaptive = -1 // SID updates at an adaptive interval during pauses
+)
+
+// channel-aware FEC indicator, see EvsEncoder.SetChannelAware
+const (
+	FecLo = 0 // low frame error rate, partial copies sized for quality of the primary frame
+	FecHi = 1 // high frame error rate, larger partial copies
 )
 
 // EvsEncoder put received pcm data 16bit pcm_s16se
@@ -11,6 +31,8 @@ type EvsEncoder struct {
 	SampleRate     int
 	IsG192         int
 	BitRate        int
+	Complexity     int //ComplexityReference, ComplexityBalanced or ComplexityFast
+	Dtx            int //DtxOff, DtxAdaptive or a fixed SID update interval of 3..100 frames
 	isEncoderStart bool
 	debugPrint     bool
 	ctx            *EvsEncoderContext
@@ -37,13 +59,16 @@ func (n *EvsEncoder) StartEncoder() error {
 		n.MaxBand = "WB"
 	}
 
-	fmt.Printf("EvsEncoder init stream isG192:%v maxBand:%v sample rate %v bitRate:%v\n", n.IsG192, n.MaxBand, n.SampleRate, n.BitRate)
+	fmt.Printf("EvsEncoder init stream isG192:%v maxBand:%v sample rate %v bitRate:%v dtx:%v\n", n.IsG192, n.MaxBand, n.SampleRate, n.BitRate, n.Dtx)
 	if n.ctx != nil {
-		res := n.ctx.initEvsEncoder(n.SampleRate, n.BitRate, n.MaxBand, n.IsG192)
+		res := n.ctx.initEvsEncoder(n.SampleRate, n.BitRate, n.MaxBand, n.IsG192, n.Dtx)
 		if res != 0 {
 			return errors.New(fmt.Sprintf("evsEncode init fail"))
 		} else {
 			n.isEncoderStart = true
+			if n.Complexity != ComplexityReference && n.ctx.setEvsComplexity(n.Complexity) != 0 {
+				return errors.New(fmt.Sprintf("evsEncode unknown complexity profile %v", n.Complexity))
+			}
 			fmt.Printf("EvsEncoder StartEncoder success\n")
 		}
 	}
@@ -52,11 +77,13 @@ func (n *EvsEncoder) StartEncoder() error {
 
 // EncodePcmToEvs data then send result (if any) to receiver
 // input pcm
-// output evs
+// output evs, nil for a DTX NO_DATA frame which is not sent
 func (n *EvsEncoder) EncodePcmToEvs(data []byte) []byte {
 	frame := n.ctx.startEvsEncoder(data)
 	if frame == nil {
-		fmt.Printf("node %v  encoderToReceiver frame is nil error\n", n)
+		if n.Dtx == DtxOff {
+			fmt.Printf("node %v  encoderToReceiver frame is nil error\n", n)
+		}
 		return nil
 	}
 	newFrame := n.delToCHeader(frame)
@@ -68,6 +95,59 @@ func (n *EvsEncoder) EncodePcmToEvs(data []byte) []byte {
 	return newFrame
 }
 
+// SetBitRate switches the running encoder to bitRate from the next frame on, keeping the codec
+// state (EVS primary 7200..128000, AMR-WB IO 6600..23850, 5900 needs DTX)
+func (n *EvsEncoder) SetBitRate(bitRate int) error {
+	if n.ctx == nil || !n.isEncoderStart {
+		return errors.New(fmt.Sprintf("evsEncode not started"))
+	}
+	if n.ctx.setEvsBitrate(bitRate) != 0 {
+		return errors.New(fmt.Sprintf("evsEncode unsupported bitRate %v", bitRate))
+	}
+	n.BitRate = bitRate
+	return nil
+}
+
+// SetMaxBand limits the coded bandwidth (NB, WB, SWB or FB) from the next frame on,
+// a band above half the sample rate is reduced to it
+func (n *EvsEncoder) SetMaxBand(band string) error {
+	if n.ctx == nil || !n.isEncoderStart {
+		return errors.New(fmt.Sprintf("evsEncode not started"))
+	}
+	band = strings.ToUpper(band)
+	if n.ctx.setEvsMaxBandwidth(band) != 0 {
+		return errors.New(fmt.Sprintf("evsEncode unknown maxBand %v", band))
+	}
+	n.MaxBand = band
+	return nil
+}
+
+// ApplyCmr honours a Codec Mode Request byte received from the far end (TS 26.445 A.2.2.1.1),
+// bitrate, bandwidth and channel-aware mode change from the next frame on. NO_REQ (0xff) is a no-op.
+// BitRate and MaxBand keep the values of the last StartEncoder/SetBitRate/SetMaxBand call.
+func (n *EvsEncoder) ApplyCmr(cmr byte) error {
+	if n.ctx == nil || !n.isEncoderStart {
+		return errors.New(fmt.Sprintf("evsEncode not started"))
+	}
+	if n.ctx.applyEvsCmr(cmr) != 0 {
+		return errors.New(fmt.Sprintf("evsEncode unsupported CMR 0x%02x", cmr))
+	}
+	return nil
+}
+
+// SetChannelAware sends a partial copy of each frame offset (2, 3, 5 or 7) frames later in the
+// stream from the next frame on, 0 turns it off. Partial copies are sent while the encoder runs at
+// 13200 with WB or SWB bandwidth, the setting is kept over switches to other bitrates.
+func (n *EvsEncoder) SetChannelAware(fecIndicator int, offset int) error {
+	if n.ctx == nil || !n.isEncoderStart {
+		return errors.New(fmt.Sprintf("evsEncode not started"))
+	}
+	if n.ctx.setEvsChannelAware(fecIndicator, offset) != 0 {
+		return errors.New(fmt.Sprintf("evsEncode unsupported channel-aware fecIndicator %v offset %v", fecIndicator, offset))
+	}
+	return nil
+}
+
 func (n *EvsEncoder) StopEncoder() {
 	if n.ctx != nil {
 		if n.isEncoderStart {
@@ -1,9 +1,14 @@
 package node
 
 import (
+	"encoding/binary"
 	"fmt"
 	"io"
+	"math"
 	"os"
+	"runtime"
+	"runtime/debug"
+	"sync"
 	"testing"
 	"time"
 )
@@ -42,3 +47,440 @@ func TestEncoder(t *testing.T) {
 	}
 	enc.StopEncoder()
 }
+
+// encodeDecodePcm runs a 16 kHz WB 13.2 kbps encode/decode of pcm with the given complexity profile
+func encodeDecodePcm(pcm []byte, profile int) []byte {
+	enc := NewEvsEncoder()
+	enc.SampleRate = 16000
+	enc.MaxBand = "WB"
+	enc.BitRate = 13200
+	enc.Complexity = profile
+	enc.StartEncoder()
+	dec := NewEvsDecoder()
+	dec.SampleRate = 16000
+	dec.BitRate = 13200
+	dec.StartDecoder()
+
+	var out []byte
+	for i := 0; i+640 <= len(pcm); i += 640 {
+		out = append(out, dec.DecodeEvsToPcm(enc.EncodePcmToEvs(pcm[i:i+640]))...)
+	}
+	enc.StopEncoder()
+	dec.StopDecoder()
+	return out
+}
+
+// BenchmarkEncoderComplexity measures the encoder time per 20 ms frame of each complexity profile.
+// The snr_dB metric compares the decoded signal with the decoded signal of the reference profile.
+func BenchmarkEncoderComplexity(b *testing.B) {
+	pcm, err := os.ReadFile(filePcmPath)
+	if err != nil {
+		b.Skip(err)
+	}
+	ref := encodeDecodePcm(pcm, ComplexityReference)
+
+	for _, bc := range []struct {
+		name    string
+		profile int
+	}{
+		{"reference", ComplexityReference},
+		{"balanced", ComplexityBalanced},
+		{"fast", ComplexityFast},
+	} {
+		out := encodeDecodePcm(pcm, bc.profile)
+		var sig, noise float64
+		for i := 0; i+1 < len(ref) && i+1 < len(out); i += 2 {
+			r := float64(int16(binary.LittleEndian.Uint16(ref[i:])))
+			d := r - float64(int16(binary.LittleEndian.Uint16(out[i:])))
+			sig += r * r
+			noise += d * d
+		}
+		snr := math.Inf(1)
+		if noise > 0 {
+			snr = 10 * math.Log10(sig/noise)
+		}
+
+		b.Run(bc.name, func(b *testing.B) {
+			enc := NewEvsEncoder()
+			enc.SampleRate = 16000
+			enc.MaxBand = "WB"
+			enc.BitRate = 13200
+			enc.Complexity = bc.profile
+			enc.StartEncoder()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				k := i % (len(pcm) / 640)
+				enc.EncodePcmToEvs(pcm[k*640 : k*640+640])
+			}
+			b.StopTimer()
+			b.ReportMetric(snr, "snr_dB")
+			enc.StopEncoder()
+		})
+	}
+}
+
+// BenchmarkSwbEncodeDecode measures the encode plus decode time per 20 ms frame of a 32 kHz SWB stream
+// at the rates served by the LR-MDCT (HQ LR) core. The 16 kHz test signal is repeated sample by sample.
+func BenchmarkSwbEncodeDecode(b *testing.B) {
+	pcm16, err := os.ReadFile(filePcmPath)
+	if err != nil {
+		b.Skip(err)
+	}
+	pcm := make([]byte, 0, 2*len(pcm16))
+	for i := 0; i+1 < len(pcm16); i += 2 {
+		pcm = append(pcm, pcm16[i], pcm16[i+1], pcm16[i], pcm16[i+1])
+	}
+
+	for _, bitRate := range []int{13200, 16400, 24400, 32000} {
+		b.Run(fmt.Sprint(bitRate), func(b *testing.B) {
+			enc := NewEvsEncoder()
+			enc.SampleRate = 32000
+			enc.MaxBand = "SWB"
+			enc.BitRate = bitRate
+			enc.StartEncoder()
+			dec := NewEvsDecoder()
+			dec.SampleRate = 32000
+			dec.BitRate = bitRate
+			dec.StartDecoder()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				k := i % (len(pcm) / 1280)
+				dec.DecodeEvsToPcm(enc.EncodePcmToEvs(pcm[k*1280 : k*1280+1280]))
+			}
+			b.StopTimer()
+			enc.StopEncoder()
+			dec.StopDecoder()
+		})
+	}
+}
+
+// residentBytes returns the resident set size of the process
+func residentBytes(b *testing.B) int64 {
+	runtime.GC()
+	debug.FreeOSMemory()
+	statm, err := os.ReadFile("/proc/self/statm")
+	if err != nil {
+		b.Skip(err)
+	}
+	var size, resident int64
+	fmt.Sscan(string(statm), &size, &resident)
+	return resident * int64(os.Getpagesize())
+}
+
+// BenchmarkChannelMemory reports the memory of one encoder plus decoder channel after a second of
+// speech for NB/WB/SWB/FB configurations: the C heap allocated for the codec state, where the C
+// library keeps heap statistics, and the growth of the resident set. The 16 kHz test signal is
+// decimated or repeated sample by sample to the configured sampling rate.
+func BenchmarkChannelMemory(b *testing.B) {
+	pcm16, err := os.ReadFile(filePcmPath)
+	if err != nil {
+		b.Skip(err)
+	}
+	const channels = 40
+
+	for _, bc := range []struct {
+		band       string
+		sampleRate int
+		bitRate    int
+	}{
+		{"NB", 8000, 9600},
+		{"WB", 16000, 13200},
+		{"SWB", 32000, 24400},
+		{"FB", 48000, 24400},
+	} {
+		repeat, stride := bc.sampleRate/16000, 2
+		if repeat == 0 {
+			repeat, stride = 1, 4
+		}
+		var pcm []byte
+		for i := 0; i+1 < len(pcm16); i += stride {
+			for k := 0; k < repeat; k++ {
+				pcm = append(pcm, pcm16[i], pcm16[i+1])
+			}
+		}
+		frame := bc.sampleRate / 50 * 2
+
+		b.Run(bc.band, func(b *testing.B) {
+			var heap, resident int64
+			for n := 0; n < b.N; n++ {
+				encs := make([]*EvsEncoder, channels)
+				decs := make([]*EvsDecoder, channels)
+				heapBefore, residentBefore := cHeapInUse(), residentBytes(b)
+				for c := range encs {
+					encs[c] = NewEvsEncoder()
+					encs[c].SampleRate = bc.sampleRate
+					encs[c].MaxBand = bc.band
+					encs[c].BitRate = bc.bitRate
+					encs[c].StartEncoder()
+					decs[c] = NewEvsDecoder()
+					decs[c].SampleRate = bc.sampleRate
+					decs[c].BitRate = bc.bitRate
+					decs[c].StartDecoder()
+					for k := 0; k < 50 && (k+1)*frame <= len(pcm); k++ {
+						decs[c].DecodeEvsToPcm(encs[c].EncodePcmToEvs(pcm[k*frame : (k+1)*frame]))
+					}
+				}
+				heap = (cHeapInUse() - heapBefore) / channels
+				resident = (residentBytes(b) - residentBefore) / channels
+
+				// every stop sleeps, so stop the channels concurrently
+				var wg sync.WaitGroup
+				for c := range encs {
+					wg.Add(1)
+					go func(c int) {
+						defer wg.Done()
+						encs[c].StopEncoder()
+						decs[c].StopDecoder()
+					}(c)
+				}
+				wg.Wait()
+			}
+			if cHeapInUse() >= 0 {
+				b.ReportMetric(float64(heap), "bytes/channel")
+			}
+			b.ReportMetric(float64(resident), "rss_bytes/channel")
+		})
+	}
+}
+
+// BenchmarkChannelSetup re-initializes one encoder plus decoder channel per iteration and reports
+// the setup rate and the C heap held by the initialized channel for NB/WB/SWB/FB configurations.
+func BenchmarkChannelSetup(b *testing.B) {
+	for _, bc := range []struct {
+		band       string
+		sampleRate int
+		bitRate    int
+	}{
+		{"NB", 8000, 9600},
+		{"WB", 16000, 13200},
+		{"SWB", 32000, 24400},
+		{"FB", 48000, 24400},
+	} {
+		b.Run(bc.band, func(b *testing.B) {
+			enc := NewEvsEncoder()
+			enc.SampleRate = bc.sampleRate
+			enc.MaxBand = bc.band
+			enc.BitRate = bc.bitRate
+			dec := NewEvsDecoder()
+			dec.SampleRate = bc.sampleRate
+			dec.BitRate = bc.bitRate
+			heapBefore := cHeapInUse()
+
+			b.ResetTimer()
+			for n := 0; n < b.N; n++ {
+				if err := enc.StartEncoder(); err != nil {
+					b.Fatal(err)
+				}
+				if err := dec.StartDecoder(); err != nil {
+					b.Fatal(err)
+				}
+			}
+			b.ReportMetric(float64(b.N)/b.Elapsed().Seconds(), "setups/s")
+			if heapBefore >= 0 {
+				b.ReportMetric(float64(cHeapInUse()-heapBefore), "bytes/channel")
+			}
+
+			b.StopTimer()
+			var wg sync.WaitGroup
+			wg.Add(2)
+			go func() { defer wg.Done(); enc.StopEncoder() }()
+			go func() { defer wg.Done(); dec.StopDecoder() }()
+			wg.Wait()
+		})
+	}
+}
+
+// TestEncoderRateSwitch switches bitrate, bandwidth and CMR on a running encoder and checks the
+// size of the next frame and that the decoder follows the switches.
+func TestEncoderRateSwitch(t *testing.T) {
+	pcm, err := os.ReadFile(filePcmPath)
+	if err != nil {
+		t.Skip(err)
+	}
+	enc := NewEvsEncoder()
+	enc.SampleRate = 16000
+	enc.MaxBand = "WB"
+	enc.BitRate = 13200
+	if err := enc.StartEncoder(); err != nil {
+		t.Fatal(err)
+	}
+	dec := NewEvsDecoder()
+	dec.SampleRate = 16000
+	dec.BitRate = 13200
+	dec.StartDecoder()
+
+	for i, sw := range []struct {
+		apply func() error
+		size  int
+	}{
+		{func() error { return nil }, 33},
+		{func() error { return enc.SetBitRate(24400) }, 61},
+		{func() error { return enc.SetBitRate(9600) }, 24},
+		{func() error { return enc.SetBitRate(12650) }, 32}, // AMR-WB IO
+		{func() error { return enc.ApplyCmr(0xa7) }, 80},    // WB 32 kbps
+		{func() error { return enc.ApplyCmr(0xff) }, 80},    // NO_REQ
+		{func() error { return enc.ApplyCmr(0xb4) }, 33},    // SWB 13.2 kbps, limited to WB at 16 kHz
+		{func() error { return enc.ApplyCmr(0xd2) }, 33},    // WB 13.2 kbps channel-aware LO-5
+		{func() error { return enc.SetMaxBand("nb") }, 33},
+		{func() error { return enc.SetBitRate(64000) }, 61}, // NB is capped at 24.4 kbps
+	} {
+		if err := sw.apply(); err != nil {
+			t.Fatalf("switch %d: %v", i, err)
+		}
+		for k := 0; k < 5; k++ {
+			off := ((i*5 + k) % (len(pcm) / 640)) * 640
+			frame := enc.EncodePcmToEvs(pcm[off : off+640])
+			if len(frame) != sw.size {
+				t.Fatalf("switch %d frame %d: %d bytes, want %d", i, k, len(frame), sw.size)
+			}
+			if dec.DecodeEvsToPcm(frame) == nil {
+				t.Fatalf("switch %d frame %d: not decoded", i, k)
+			}
+		}
+	}
+	if enc.SetBitRate(12345) == nil || enc.ApplyCmr(0x8c) == nil || enc.SetMaxBand("XB") == nil {
+		t.Error("invalid request accepted")
+	}
+	enc.StopEncoder()
+	dec.StopDecoder()
+}
+
+// BenchmarkRateSwitch compares a bitrate switch of a running encoder with rebuilding it, each op is
+// the switch plus the first 20 ms frame at the new rate ("steady" is the frame alone).
+func BenchmarkRateSwitch(b *testing.B) {
+	pcm, err := os.ReadFile(filePcmPath)
+	if err != nil {
+		b.Skip(err)
+	}
+	rates := []int{13200, 24400}
+
+	for _, bc := range []struct {
+		name   string
+		change func(enc *EvsEncoder, bitRate int)
+	}{
+		{"steady", func(enc *EvsEncoder, bitRate int) {}},
+		{"setBitRate", func(enc *EvsEncoder, bitRate int) { enc.SetBitRate(bitRate) }},
+		{"reinit", func(enc *EvsEncoder, bitRate int) {
+			enc.BitRate = bitRate
+			enc.StartEncoder()
+		}},
+	} {
+		b.Run(bc.name, func(b *testing.B) {
+			enc := NewEvsEncoder()
+			enc.SampleRate = 16000
+			enc.MaxBand = "WB"
+			enc.BitRate = rates[0]
+			enc.StartEncoder()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				k := i % (len(pcm) / 640)
+				bc.change(enc, rates[(i+1)%2])
+				enc.EncodePcmToEvs(pcm[k*640 : k*640+640])
+			}
+			b.StopTimer()
+			enc.StopEncoder()
+		})
+	}
+}
+
+// speechWithPauses returns 16 kHz pcm alternating the test speech signal with pauses of the
+// same length filled with low-level background noise
+func speechWithPauses(t testing.TB, periods int) []byte {
+	speech, err := os.ReadFile(filePcmPath)
+	if err != nil {
+		t.Skip(err)
+	}
+	pause := make([]byte, len(speech))
+	seed := uint32(1)
+	for i := 0; i+1 < len(pause); i += 2 {
+		seed = seed*1664525 + 1013904223
+		binary.LittleEndian.PutUint16(pause[i:], uint16(int16(seed>>16)>>10))
+	}
+	var pcm []byte
+	for i := 0; i < periods; i++ {
+		pcm = append(append(pcm, speech...), pause...)
+	}
+	return pcm
+}
+
+// TestEncoderDtx runs DTX through encoder and decoder: pauses give SID and unsent NO_DATA frames,
+// every frame period still decodes to a full frame of speech or comfort noise.
+func TestEncoderDtx(t *testing.T) {
+	pcm := speechWithPauses(t, 2)
+	for _, dtx := range []int{DtxAdaptive, 8} {
+		enc := NewEvsEncoder()
+		enc.SampleRate = 16000
+		enc.MaxBand = "WB"
+		enc.BitRate = 13200
+		enc.Dtx = dtx
+		if err := enc.StartEncoder(); err != nil {
+			t.Fatal(err)
+		}
+		dec := NewEvsDecoder()
+		dec.SampleRate = 16000
+		dec.BitRate = 13200
+		dec.StartDecoder()
+
+		var sid, noData int
+		for i := 0; i+640 <= len(pcm); i += 640 {
+			frame := enc.EncodePcmToEvs(pcm[i : i+640])
+			switch len(frame) {
+			case 0:
+				noData++
+			case evsSidSize:
+				sid++
+			}
+			if out := dec.DecodeEvsToPcm(frame); len(out) != 640 {
+				t.Fatalf("dtx %d frame %d: %d bytes decoded", dtx, i/640, len(out))
+			}
+		}
+		if sid == 0 || noData == 0 {
+			t.Errorf("dtx %d: %d SID and %d NO_DATA frames", dtx, sid, noData)
+		}
+		enc.StopEncoder()
+		dec.StopDecoder()
+	}
+	enc := NewEvsEncoder()
+	enc.Dtx = 2
+	if enc.StartEncoder() == nil {
+		t.Error("SID update interval 2 accepted")
+	}
+}
+
+// BenchmarkEncoderDtx measures the encoder time per 20 ms frame on speech with pauses with and
+// without DTX, and the share of frames and bytes that is still sent.
+func BenchmarkEncoderDtx(b *testing.B) {
+	pcm := speechWithPauses(b, 2)
+	frames := len(pcm) / 640
+
+	for _, bc := range []struct {
+		name string
+		dtx  int
+	}{
+		{"off", DtxOff},
+		{"adaptive", DtxAdaptive},
+		{"sid8", 8},
+	} {
+		b.Run(bc.name, func(b *testing.B) {
+			enc := NewEvsEncoder()
+			enc.SampleRate = 16000
+			enc.MaxBand = "WB"
+			enc.BitRate = 13200
+			enc.Dtx = bc.dtx
+			enc.StartEncoder()
+			sent, bytes := 0, 0
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				k := i % frames
+				if frame := enc.EncodePcmToEvs(pcm[k*640 : k*640+640]); frame != nil {
+					sent++
+					bytes += len(frame)
+				}
+			}
+			b.StopTimer()
+			b.ReportMetric(100*float64(sent)/float64(b.N), "sent_%")
+			b.ReportMetric(float64(bytes)/float64(b.N), "bytes/frame")
+			enc.StopEncoder()
+		})
+	}
+}
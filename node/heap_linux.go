@@ -0,0 +1,26 @@
+//go:build linux
+
+package node
+
+//#include <stdlib.h>
+//#ifdef __GLIBC__
+//#include <malloc.h>
+//#endif
+//
+//static long long evsHeapInUse(void)
+//{
+//#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+//    return (long long)mallinfo2().uordblks;
+//#elif defined(__GLIBC__)
+//    return (long long)(unsigned int)mallinfo().uordblks;
+//#else
+//    return -1;
+//#endif
+//}
+import "C"
+
+// cHeapInUse returns the bytes allocated on the C heap, the codec state of all channels, or -1
+// where the C library keeps no statistics (musl). Only the benchmarks use it.
+func cHeapInUse() int64 {
+	return int64(C.evsHeapInUse())
+}
@@ -0,0 +1,8 @@
+//go:build !linux
+
+package node
+
+// cHeapInUse returns -1, the C heap statistics are only read from glibc
+func cHeapInUse() int64 {
+	return -1
+}
@@ -0,0 +1,96 @@
+package node
+
+import (
+	"errors"
+	"fmt"
+)
+
+// MixGainUnity is the 0 dB participant gain of DecodeMix, gains are in Q12
+const MixGainUnity int16 = 4096
+
+// MixBusMax is the number of mix buses of DecodeMix
+const MixBusMax = 8
+
+// laneFrames puts the frames of the payloads back to back, as taken by the codec
+func laneFrames(decs []*EvsDecoder, payloads [][]byte) ([]*EvsDecoderContext, []byte, []int32, error) {
+	if len(decs) != len(payloads) {
+		return nil, nil, nil, errors.New(fmt.Sprintf("%v decoders for %v payloads", len(decs), len(payloads)))
+	}
+	ctxs := make([]*EvsDecoderContext, len(decs))
+	sizes := make([]int32, len(decs))
+	var data []byte
+	for i, n := range decs {
+		if n.ctx == nil || !n.isDecoderStart || n.Jbm {
+			return nil, nil, nil, errors.New(fmt.Sprintf("decoder %v not started or with jitter buffer", i))
+		}
+		ctxs[i] = n.ctx
+		if len(payloads[i]) == 0 {
+			continue
+		}
+		frame, err := n.codecFrame(payloads[i])
+		if err != nil {
+			return nil, nil, nil, err
+		}
+		data = append(data, frame...)
+		if len(frame)%2 != 0 {
+			data = append(data, 0) // keep the G.192 words of the next frames aligned
+		}
+		sizes[i] = int32(len(frame) + len(frame)%2)
+	}
+	return ctxs, data, sizes, nil
+}
+
+// DecodeLanes decodes one payload on each decoder, e.g. the payloads of all participants of a
+// conference in a 20 ms tick, and returns the pcm of each as DecodeEvsToPcm would. All frames go to
+// the codec in one call (EvsDecodeLanes), which runs the output high-pass filter of the streams
+// with the same output rate in lockstep. An empty payload is a frame period without payload. The
+// pcm of a stream that could not be decoded is nil. Decoders with Jbm are not supported.
+func DecodeLanes(decs []*EvsDecoder, payloads [][]byte) ([][]byte, error) {
+	ctxs, data, sizes, err := laneFrames(decs, payloads)
+	if err != nil {
+		return nil, err
+	}
+
+	decodeEvsLanes(ctxs, data, sizes)
+	pcm := make([][]byte, len(decs))
+	for i, n := range decs {
+		pcm[i] = n.ctx.output()
+	}
+	return pcm, nil
+}
+
+// DecodeMix decodes one payload on each decoder as DecodeLanes and mixes the pcm in the codec
+// (EvsDecodeMix), without a pcm copy per participant. Participant i is scaled by gains[i]
+// (MixGainUnity for 0 dB, nil for all) and mixed into bus b if bit b of buses[i] is set (nil for
+// all on bus 0). mix receives the frames of the len(mix)/frame size buses back to back, nMinusOne
+// (may be nil) one frame per participant: bus 0 without the own voice. The sums are saturated
+// once. All decoders need the same SampleRate. It returns the number of streams not decoded,
+// which add nothing to the mix.
+func DecodeMix(decs []*EvsDecoder, payloads [][]byte, gains []int16, buses []uint32, mix []int16, nMinusOne []int16) (int, error) {
+	if len(decs) == 0 {
+		return 0, errors.New(fmt.Sprintf("no decoders to mix"))
+	}
+	frameLen := decs[0].SampleRate / 50
+	for _, n := range decs {
+		if n.SampleRate/50 != frameLen {
+			return 0, errors.New(fmt.Sprintf("decoders of %v and %v Hz mixed", decs[0].SampleRate, n.SampleRate))
+		}
+	}
+	if len(mix) == 0 || len(mix)%frameLen != 0 || len(mix)/frameLen > MixBusMax {
+		return 0, errors.New(fmt.Sprintf("%v mix samples for frames of %v", len(mix), frameLen))
+	}
+	if (gains != nil && len(gains) != len(decs)) || (buses != nil && len(buses) != len(decs)) ||
+		(nMinusOne != nil && len(nMinusOne) != len(decs)*frameLen) {
+		return 0, errors.New(fmt.Sprintf("gains, buses or N-1 outputs not matching %v decoders", len(decs)))
+	}
+	ctxs, data, sizes, err := laneFrames(decs, payloads)
+	if err != nil {
+		return 0, err
+	}
+
+	failed := decodeEvsMix(ctxs, data, sizes, gains, buses, len(mix)/frameLen, mix, nMinusOne)
+	if failed < 0 {
+		return 0, errors.New(fmt.Sprintf("evsDecodeMix fail"))
+	}
+	return failed, nil
+}
@@ -0,0 +1,281 @@
+package node
+
+import (
+	"bytes"
+	"encoding/binary"
+	"fmt"
+	"sync"
+	"testing"
+)
+
+// participant is one stream of a conference: its encoder settings and the decoder output rate
+type participant struct {
+	bitRate    int
+	dtx        int
+	amrWb      int // RFC 4867 payloads
+	sampleRate int // of the decoder
+	lossy      bool
+}
+
+// conferenceFrames encodes the payloads of each participant, every one starting at another
+// position of the speech, lost frames are empty
+func conferenceFrames(t testing.TB, parts []participant, frames int) [][][]byte {
+	pcm := speechWithPauses(t, 1)
+	lost := lossTrace(frames)
+	payloads := make([][][]byte, len(parts))
+	for p, part := range parts {
+		enc := NewEvsEncoder()
+		enc.SampleRate = 16000
+		enc.MaxBand = "WB"
+		enc.BitRate = part.bitRate
+		enc.Dtx = part.dtx
+		if err := enc.StartEncoder(); err != nil {
+			t.Fatal(err)
+		}
+		for i := 0; i < frames; i++ {
+			k := (i + 13*p) % (len(pcm) / 640)
+			frame := enc.EncodePcmToEvs(pcm[k*640 : k*640+640])
+			if part.amrWb != 0 {
+				frame, _ = EvsIoToAmrWb(frame, AmrWbNoCmr, part.amrWb)
+			}
+			if part.lossy && lost[(i+7*p)%frames] {
+				frame = nil
+			}
+			payloads[p] = append(payloads[p], frame)
+		}
+		go enc.StopEncoder()
+	}
+	return payloads
+}
+
+// conferenceDecoders starts a decoder for each participant
+func conferenceDecoders(t testing.TB, parts []participant) []*EvsDecoder {
+	decs := make([]*EvsDecoder, len(parts))
+	for p, part := range parts {
+		decs[p] = NewEvsDecoder()
+		decs[p].SampleRate = part.sampleRate
+		decs[p].BitRate = part.bitRate
+		decs[p].AmrWb = part.amrWb
+		if err := decs[p].StartDecoder(); err != nil {
+			t.Fatal(err)
+		}
+	}
+	return decs
+}
+
+func stopDecoders(stop *sync.WaitGroup, decs []*EvsDecoder) {
+	stop.Add(len(decs))
+	for _, dec := range decs {
+		go func(dec *EvsDecoder) { defer stop.Done(); dec.StopDecoder() }(dec)
+	}
+}
+
+// TestDecodeLanes decodes 16 participants of mixed modes, DTX, loss and output rates in lanes and
+// checks every frame against decoding each stream on its own
+func TestDecodeLanes(t *testing.T) {
+	parts := []participant{
+		{13200, DtxOff, 0, 16000, false}, {13200, DtxOff, 0, 16000, false}, {13200, DtxOff, 0, 16000, true},
+		{13200, DtxOff, 0, 16000, false}, {13200, DtxOff, 0, 32000, false}, {13200, DtxOff, 0, 32000, true},
+		{13200, 8, 0, 16000, false}, {13200, DtxAdaptive, 0, 16000, true}, {9600, DtxOff, 0, 16000, false},
+		{24400, DtxOff, 0, 16000, false}, {12650, DtxOff, 0, 16000, false}, {12650, 8, 0, 16000, true},
+		{12650, DtxOff, AmrWbOctetAligned, 16000, false}, {23850, 8, AmrWbBandwidthEfficient, 16000, true},
+		{13200, DtxOff, 0, 8000, false}, {7200, DtxOff, 0, 16000, false},
+	}
+	frames := 60
+	payloads := conferenceFrames(t, parts, frames)
+	ref := conferenceDecoders(t, parts)
+	lanes := conferenceDecoders(t, parts)
+	var stop sync.WaitGroup
+	defer stop.Wait()
+	defer stopDecoders(&stop, lanes)
+	defer stopDecoders(&stop, ref)
+
+	tick := make([][]byte, len(parts))
+	for i := 0; i < frames; i++ {
+		for p := range parts {
+			tick[p] = payloads[p][i]
+		}
+		pcm, err := DecodeLanes(lanes, tick)
+		if err != nil {
+			t.Fatal(err)
+		}
+		for p := range parts {
+			want := ref[p].DecodeEvsToPcm(tick[p])
+			if len(want) != parts[p].sampleRate/25 || !bytes.Equal(pcm[p], want) {
+				t.Fatalf("frame %d participant %d: %d bytes decoded in lanes, %d on its own, not equal", i, p, len(pcm[p]), len(want))
+			}
+		}
+	}
+
+	if _, err := DecodeLanes(lanes, tick[1:]); err == nil {
+		t.Errorf("payloads not matching the decoders accepted")
+	}
+}
+
+// BenchmarkDecodeLanes measures the decoded frames per second of a 16-participant WB 13.2 kbps
+// conference, one stream after the other with DecodeEvsToPcm and in lanes with DecodeLanes
+func BenchmarkDecodeLanes(b *testing.B) {
+	parts := make([]participant, 16)
+	for p := range parts {
+		parts[p] = participant{13200, DtxOff, 0, 16000, false}
+	}
+	frames := 100
+	payloads := conferenceFrames(b, parts, frames)
+	var stop sync.WaitGroup
+	defer stop.Wait()
+
+	for _, lanes := range []bool{false, true} {
+		b.Run(fmt.Sprintf("lanes=%v", lanes), func(b *testing.B) {
+			decs := conferenceDecoders(b, parts)
+			tick := make([][]byte, len(parts))
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				for p := range parts {
+					tick[p] = payloads[p][i%frames]
+				}
+				if lanes {
+					DecodeLanes(decs, tick)
+				} else {
+					for p, dec := range decs {
+						dec.DecodeEvsToPcm(tick[p])
+					}
+				}
+			}
+			b.StopTimer()
+			b.ReportMetric(float64(b.N*len(parts))/b.Elapsed().Seconds(), "frames/s")
+			stopDecoders(&stop, decs)
+		})
+	}
+}
+
+// saturate16 limits a mix sum to 16 bit
+func saturate16(s int32) int16 {
+	if s > 32767 {
+		return 32767
+	} else if s < -32768 {
+		return -32768
+	}
+	return int16(s)
+}
+
+// mixInGo mixes the decoded pcm of the participants as a bridge would without DecodeMix
+func mixInGo(pcm [][]byte, gains []int16, buses []uint32, mix []int16, nMinusOne []int16) {
+	frameLen := len(nMinusOne) / len(pcm)
+	bus := make([]int32, len(mix))
+	for i, frame := range pcm {
+		for b := 0; b < len(mix)/frameLen; b++ {
+			if len(frame) == 2*frameLen && buses[i]>>b&1 != 0 {
+				for j := 0; j < frameLen; j++ {
+					bus[b*frameLen+j] += int32(int16(binary.LittleEndian.Uint16(frame[2*j:]))) * int32(gains[i]) >> 12
+				}
+			}
+		}
+	}
+	for j := range mix {
+		mix[j] = saturate16(bus[j])
+	}
+	for i, frame := range pcm {
+		for j := 0; j < frameLen; j++ {
+			own := int32(0)
+			if len(frame) == 2*frameLen && buses[i]&1 != 0 {
+				own = int32(int16(binary.LittleEndian.Uint16(frame[2*j:]))) * int32(gains[i]) >> 12
+			}
+			nMinusOne[i*frameLen+j] = saturate16(bus[j] - own)
+		}
+	}
+}
+
+// TestDecodeMix checks the buses and N-1 outputs mixed in the codec against mixing the pcm of
+// each stream decoded on its own
+func TestDecodeMix(t *testing.T) {
+	parts := []participant{
+		{13200, DtxOff, 0, 16000, false}, {13200, 8, 0, 16000, true}, {24400, DtxOff, 0, 16000, false},
+		{12650, DtxOff, 0, 16000, true}, {9600, DtxOff, 0, 16000, false}, {13200, DtxOff, 0, 16000, false},
+	}
+	gains := []int16{MixGainUnity, 2048, 4 * MixGainUnity, MixGainUnity, 1000, MixGainUnity}
+	buses := []uint32{1, 3, 1, 2, 3, 0}
+	frames := 40
+	payloads := conferenceFrames(t, parts, frames)
+	ref := conferenceDecoders(t, parts)
+	decs := conferenceDecoders(t, parts)
+	var stop sync.WaitGroup
+	defer stop.Wait()
+	defer stopDecoders(&stop, decs)
+	defer stopDecoders(&stop, ref)
+
+	frameLen := 320
+	mix, nMinusOne := make([]int16, 2*frameLen), make([]int16, len(parts)*frameLen)
+	wantMix, wantNMinusOne := make([]int16, len(mix)), make([]int16, len(nMinusOne))
+	tick, pcm := make([][]byte, len(parts)), make([][]byte, len(parts))
+	saturated := 0
+	for i := 0; i < frames; i++ {
+		for p := range parts {
+			tick[p] = payloads[p][i]
+			pcm[p] = ref[p].DecodeEvsToPcm(tick[p])
+		}
+		if failed, err := DecodeMix(decs, tick, gains, buses, mix, nMinusOne); err != nil || failed != 0 {
+			t.Fatalf("frame %d: %d streams failed, %v", i, failed, err)
+		}
+		mixInGo(pcm, gains, buses, wantMix, wantNMinusOne)
+		for j := range mix {
+			if mix[j] != wantMix[j] {
+				t.Fatalf("frame %d bus %d sample %d: %d mixed, want %d", i, j/frameLen, j%frameLen, mix[j], wantMix[j])
+			}
+			if mix[j] == 32767 || mix[j] == -32768 {
+				saturated++
+			}
+		}
+		for j := range nMinusOne {
+			if nMinusOne[j] != wantNMinusOne[j] {
+				t.Fatalf("frame %d participant %d sample %d: N-1 %d, want %d", i, j/frameLen, j%frameLen, nMinusOne[j], wantNMinusOne[j])
+			}
+		}
+	}
+	if saturated == 0 {
+		t.Errorf("mix never saturated")
+	}
+
+	if _, err := DecodeMix(decs, tick, gains, buses, mix[:frameLen+1], nil); err == nil {
+		t.Errorf("mix buffer of a partial frame accepted")
+	}
+}
+
+// BenchmarkDecodeMix measures a 16-participant WB 13.2 kbps conference tick with one bus and N-1
+// outputs, mixed in Go after DecodeLanes and in the codec with DecodeMix
+func BenchmarkDecodeMix(b *testing.B) {
+	parts := make([]participant, 16)
+	gains := make([]int16, len(parts))
+	buses := make([]uint32, len(parts))
+	for p := range parts {
+		parts[p] = participant{13200, DtxOff, 0, 16000, false}
+		gains[p], buses[p] = MixGainUnity, 1
+	}
+	frames := 100
+	payloads := conferenceFrames(b, parts, frames)
+	var stop sync.WaitGroup
+	defer stop.Wait()
+
+	for _, inCodec := range []bool{false, true} {
+		b.Run(fmt.Sprintf("codec=%v", inCodec), func(b *testing.B) {
+			decs := conferenceDecoders(b, parts)
+			tick := make([][]byte, len(parts))
+			mix, nMinusOne := make([]int16, 320), make([]int16, len(parts)*320)
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				for p := range parts {
+					tick[p] = payloads[p][i%frames]
+				}
+				if inCodec {
+					DecodeMix(decs, tick, gains, buses, mix, nMinusOne)
+				} else {
+					pcm, _ := DecodeLanes(decs, tick)
+					mixInGo(pcm, gains, buses, mix, nMinusOne)
+				}
+			}
+			b.StopTimer()
+			b.ReportMetric(float64(b.N*len(parts))/b.Elapsed().Seconds(), "frames/s")
+			stopDecoders(&stop, decs)
+		})
+	}
+}
@@ -146,8 +146,8 @@ static Word16 saturate (Word32 L_var1);
  |   Constants and Globals                                                   |
  |___________________________________________________________________________|
 */
-Flag Overflow = 0;
-Flag Carry = 0;
+BASOP_THREAD_LOCAL Flag Overflow = 0;
+BASOP_THREAD_LOCAL Flag Carry = 0;
 
 
 /*___________________________________________________________________________
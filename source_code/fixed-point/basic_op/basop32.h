@@ -53,8 +53,15 @@
  |   Constants and Globals                                                   |
  |___________________________________________________________________________|
 */
-extern Flag Overflow, Overflow2;
-extern Flag Carry;
+/* the flags are per thread, so that codec instances can run on several threads at once */
+#if defined(_MSC_VER)
+#define BASOP_THREAD_LOCAL __declspec(thread)
+#else
+#define BASOP_THREAD_LOCAL __thread
+#endif
+
+extern BASOP_THREAD_LOCAL Flag Overflow, Overflow2;
+extern BASOP_THREAD_LOCAL Flag Carry;
 
 #define BASOP_SATURATE_WARNING_ON
 #define BASOP_SATURATE_WARNING_OFF
@@ -146,6 +146,26 @@ static Word16 rate2EVSmode(
     }
 }
 
+/*-------------------------------------------------------------------*
+ * update_max_ind_fx( )
+ *
+ * Raise the high-water mark of the list of indices to the next slot,
+ * so that packing and clearing only visit slots that were written
+ *-------------------------------------------------------------------*/
+
+void update_max_ind_fx(
+    Encoder_State_fx *st_fx        /* i/o: encoder state structure */
+)
+{
+    IF ( sub(st_fx->next_ind_fx, st_fx->max_ind_fx) > 0 )
+    {
+        st_fx->max_ind_fx = st_fx->next_ind_fx;
+        move16();
+    }
+
+    return;
+}
+
 /*-------------------------------------------------------------------*
  * push_indice_fx( )
  *
@@ -189,6 +209,7 @@ void push_indice_fx(
     st_fx->last_ind_fx = id;
     move16();
     st_fx->nb_bits_tot_fx = add(st_fx->nb_bits_tot_fx, nb_bits);
+    update_max_ind_fx(st_fx);
 
     return;
 }
@@ -211,6 +232,7 @@ void push_next_indice_fx(
     st_fx->ind_list_fx[st_fx->next_ind_fx].nb_bits = nb_bits;
     move16();
     st_fx->next_ind_fx = add(st_fx->next_ind_fx, 1);
+    update_max_ind_fx(st_fx);
 
 
     /* update the total number of bits already written */
@@ -268,6 +290,7 @@ void push_next_bits_fx(
     }
     st_fx->next_ind_fx = (Word16)(ptr - st_fx->ind_list_fx);
     st_fx->nb_bits_tot_fx = add(st_fx->nb_bits_tot_fx, nb_bits);
+    update_max_ind_fx(st_fx);
 }
 
 /*-------------------------------------------------------------------*
@@ -424,6 +447,8 @@ void reset_indices_enc_fx(
     move16();
     st_fx->last_ind_fx = -1;
     move16();
+    st_fx->max_ind_fx = 0;
+    move16();
 
     FOR (i=0; i<MAX_NUM_INDICES; i++)
     {
@@ -468,7 +493,7 @@ void write_indices_fx(
     Word16 stream[2+MAX_BITS_PER_FRAME], *pt_stream;
     Word32  mask;
     UWord8 header;
-	UWord8 headerSize,bodySize;
+    Word16 headerSize, bodySize;
 
     if( st_fx->bitstreamformat == G192 )
     {
@@ -476,10 +501,6 @@ void write_indices_fx(
         * Encode Sync Header and Frame Length
         *-----------------------------------------------------------------*/
         pt_stream = stream;
-        for (i=0; i<(2 + MAX_BITS_PER_FRAME); ++i)
-        {
-            stream[i] = 0;
-        }
         *pt_stream++ = (Word16)SYNC_GOOD_FRAME;
         *pt_stream++ = st_fx->nb_bits_tot_fx;
 
@@ -488,7 +509,7 @@ void write_indices_fx(
         * Writing the serial stream into file
         *----------------------------------------------------------------*/
 
-        for (i=0; i<MAX_NUM_INDICES; i++)
+        for (i=0; i<st_fx->max_ind_fx; i++)
         {
             if (st_fx->ind_list_fx[i].nb_bits != -1)
             {
@@ -512,6 +533,11 @@ void write_indices_fx(
             }
         }
 
+        /* zero any part of the announced frame length that no indice covered */
+        for (k=(Word16)(pt_stream - stream); k<2+stream[1]; k++)
+        {
+            stream[k] = 0;
+        }
     }
     else
     {
@@ -537,8 +563,8 @@ void write_indices_fx(
 		
     }
 
-    /* Clearing of indices */
-    FOR (i=0; i<MAX_NUM_INDICES; i++)
+    /* Clearing of indices - slots above the high-water mark were never written */
+    FOR (i=0; i<st_fx->max_ind_fx; i++)
     {
         st_fx->ind_list_fx[i].nb_bits = -1;
         move16();
@@ -552,12 +578,14 @@ void write_indices_fx(
         fwrite( stream, sizeof(unsigned short), 2+stream[1], file );
      
         st_fx->outDataLenG192 = sizeof(unsigned short)*(2+stream[1]);
+        if(st_fx->outDataG192 != NULL)
         memcpy(st_fx->outDataG192,stream, st_fx->outDataLenG192);
     }
     /* reset index pointers */
     st_fx->nb_bits_tot_fx = 0;
     st_fx->next_ind_fx = 0;
     st_fx->last_ind_fx = -1;
+    st_fx->max_ind_fx = 0;
 
     return;
 }
@@ -574,20 +602,21 @@ void indices_to_serial(
     Word16 *pFrame_size       /* o: size of the binary encoded access unit [bits] */
 )
 {
-    Word16 i, k, j;
+    Word16 i, k, j = 0;
     Word16 cmi = 0, core_mode=0;
     Word32 mask;
     Word16 amrwb_bits[(ACELP_23k85 / 50)];
     UWord8 omask= 0x80;
     UWord8 *pt_pFrame=pFrame;
+    UWord32 acc;
+    Word16 nb_acc, nb_bits;
 
     if ( st_fx->Opt_AMR_WB_fx )
     {
         cmi = rate2EVSmode(st_fx->total_brate_fx);
         core_mode = rate2EVSmode(st_fx->nb_bits_tot_fx * 50);
 
-        j=0;
-        for (i=0; i<MAX_NUM_INDICES; i++)
+        for (i=0; i<st_fx->max_ind_fx; i++)
         {
             if (st_fx->ind_list_fx[i].nb_bits != -1)
             {
@@ -609,29 +638,38 @@ void indices_to_serial(
     /*----------------------------------------------------------------*
     * Bitstream packing (conversion of individual indices into a serial stream)
     *----------------------------------------------------------------*/
-    j=0;
-    for (i=0; i<MAX_NUM_INDICES; i++)
+    if ( st_fx->Opt_AMR_WB_fx )
     {
-        if (st_fx->ind_list_fx[i].nb_bits != -1)
+        /* AMR-WB IO bits are reordered by sensitivity, write bit by bit */
+        nb_bits = j;
+        for (j=0; j<nb_bits; j++)
         {
-            /* mask from MSB to LSB */
-            mask = 1 << (st_fx->ind_list_fx[i].nb_bits - 1);
-
-            /* write bit by bit */
-            for (k=0; k < st_fx->ind_list_fx[i].nb_bits; k++)
+            pack_bit(amrwb_bits[sort_ptr[core_mode][j]], &pt_pFrame, &omask);
+        }
+    }
+    else
+    {
+        /* EVS indices are written whole, MSB first, through a bit accumulator */
+        acc = 0;
+        nb_acc = 0;
+        for (i=0; i<st_fx->max_ind_fx; i++)
+        {
+            nb_bits = st_fx->ind_list_fx[i].nb_bits;
+            if (nb_bits > 0)
             {
-                if (st_fx->Opt_AMR_WB_fx )
-                {
-                    pack_bit(amrwb_bits[sort_ptr[core_mode][j++]], &pt_pFrame, &omask);
-                }
-                else
+                acc = (acc << nb_bits) | (st_fx->ind_list_fx[i].value & ((1u << nb_bits) - 1));
+                nb_acc += nb_bits;
+                while (nb_acc >= 8)
                 {
-                    pack_bit(st_fx->ind_list_fx[i].value & mask, &pt_pFrame, &omask);
-                    j++;
+                    nb_acc -= 8;
+                    *pt_pFrame++ = (UWord8)(acc >> nb_acc);
                 }
-                mask >>= 1;
             }
         }
+        if (nb_acc > 0)
+        {
+            *pt_pFrame = (UWord8)(acc << (8 - nb_acc));
+        }
     }
 
     if ( st_fx->Opt_AMR_WB_fx && core_mode == AMRWB_IO_SID)    /* SID UPD frame always written now  .... */
@@ -1331,7 +1369,7 @@ Word16 read_indices_fx_real(                /* o  : 1 = reading OK, 0 = problem
     {
 		/*Sync header*/
 		utmp = data[0];
-	  headerSize = sizeof(unsigned short) * 1;
+	  headerSize = 1;                       /* offsets in words of the G.192 frame */
 		
 
 		 /* set the BFI indicator according the value of Sync Header */
@@ -1350,7 +1388,7 @@ Word16 read_indices_fx_real(                /* o  : 1 = reading OK, 0 = problem
 		   /*Frame Length field from the bitstream*/
 		   memcpy(&num_bits, data + headerSize, sizeof(unsigned short));
 
-       offsetSize = headerSize + sizeof(unsigned short) * 1;
+       offsetSize = headerSize + 1;
 
        
         /* convert the frame length to total bitrate */
@@ -34,6 +34,7 @@
 
 #define RANDOM_INITSEED                       21845     /* Seed for random generators */
 #define MAX_FRAME_COUNTER                     200
+#define DEC_LANES_MAX                         8         /* streams filtered in lockstep by the decoder lane kernels */
 #define BITS_PER_SHORT                        16
 #define BITS_PER_BYTE                         8
 #define MAX_BITS_PER_FRAME                    2560
@@ -514,6 +515,7 @@ enum
 #define L_FILT_UP32k                          12        /* Resampling - delay of filter for 32 kHz output signals (at 12.8 kHz sampling rate) */
 #define L_FILT_UP48k                          12        /* Resampling - delay of filter for 48 kHz output signals (at 12.8 kHz sampling rate) */
 #define L_FILT_MAX                            L_FILT48k /* Resampling - maximum length of all filters - for memories */
+#define L_FILT_BANK_MAX                       810       /* Resampling - size of the polyphase coefficient bank of modify_Fs_fx(), (fac_num+1)*2*filt_len */
 #define RS_INV_FAC                            0x8000    /* Resampling - flag needed in rom_com and modif_fs to allow pre-scaled and non pre-scaled filters */
 
 #define CLDFB_NO_CHANNELS_MAX                 60        /* CLDFB resampling - max number of CLDFB channels */
@@ -628,6 +630,14 @@ enum
 
 #define TOTALNOISE_HIST_SIZE                  4
 
+/*----------------------------------------------------------------------------------*
+ * Encoder complexity profiles
+ *----------------------------------------------------------------------------------*/
+
+#define ENC_CMPL_REFERENCE                    0         /* full search effort of the reference encoder */
+#define ENC_CMPL_BALANCED                     1         /* fewer ACELP search iterations, shorter TCX rate loop */
+#define ENC_CMPL_FAST                         2         /* single ACELP iteration, 2 rate-loop iterations, 1 LSF survivor, GMM-only sp/mus classifier */
+
 /************************************************************************/
 
 /************************************************************************/
@@ -985,6 +995,8 @@ enum
 #define ari_q2new                             (2*ari_q1new)
 #define ari_q3new                             (3*ari_q1new)
 #define ari_q3newM1                           (3*ari_q1new-1)
+#define ARI_S17_LUT_SHIFT                     7                                   /* bucket width of the direct-indexed s17 symbol lookup */
+#define ARI_S17_LUT_SIZE                      (16384 >> ARI_S17_LUT_SHIFT)
 
 /* ari_hm.h */
 #define kLtpHmFractionalResolution            7
@@ -1634,6 +1646,7 @@ enum QuantaMode { NEAREST = 0, CONS };
 
 #define KMAX_NON_DIRECT_FX                    96                /* max K  for non-direct indexing  recursion rows  is 1+KMAX_NON_DIRECT +1 */
 #define ODD_DIV_SIZE_FX                       48                /* ind0=1/1  ind1 =1/3  ...  ind47=1/95 */
+#define PVQ_A_TAB_SIZE_FX                     1084              /* stored offsets A(n,k), n=3..64, k up to the first A(n,k+1) >= 2^32 (max KMAX_NON_DIRECT_FX+1) */
 
 
 /* TCQ */
@@ -55,6 +55,8 @@ void initFdCngCom(HANDLE_FD_CNG_COM hs, Word16 scale)
     /* Initialize the comfort noise generation */
     set32_fx( hs->fftBuffer, 0, FFTLEN );
     set32_fx( hs->cngNoiseLevel, 0, FFTCLDFBLEN );
+    hs->sqrtNoiseLevelValid = 0;
+    move16();
 
     /* Initialize quantizer */
     set32_fx( hs->sidNoiseEst, 0, NPART );
@@ -1503,18 +1505,60 @@ Word32 rand_gauss (Word16 *seed)
 
 
     /* This unrolled version reduces the cycles from 17 to 10 */
-    loc_seed = extract_l(L_mac0(13849, *seed, 31821));
+    /* The seed products stay below 2^30 and |temp| < 3*2^15, so
+       L_mac0(), L_msu0() and L_shl() never saturate: plain C is bit-exact */
+    loc_seed = (Word16)(13849L + (Word32)*seed * 31821);
     temp = L_deposit_l(loc_seed);
 
-    loc_seed = extract_l(L_mac0(13849, loc_seed, 31821));
-    temp = L_msu0(temp,loc_seed,-1);
+    loc_seed = (Word16)(13849L + (Word32)loc_seed * 31821);
+    temp = temp + loc_seed;
 
-    loc_seed = extract_l(L_mac0(13849, loc_seed, 31821));
-    temp = L_msu0(temp,loc_seed,-1);
+    loc_seed = (Word16)(13849L + (Word32)loc_seed * 31821);
+    temp = temp + loc_seed;
 
     *seed = loc_seed;
     move16();
-    return L_shl(temp,WORD16_BITS-CNG_RAND_GAUSS_SHIFT);
+    return temp * (1 << (WORD16_BITS-CNG_RAND_GAUSS_SHIFT));  /* L_shl(), without shifting a negative value */
+}
+
+
+/*
+   rand_gauss_vec
+
+    Parameters:
+
+    x                  o     : random signal format Q3.29
+    n                  i     : number of samples
+    seed               i/o   : pointer to seed
+
+    Function:
+    Fills x[0..n-1] with the same sequence as n consecutive calls of rand_gauss()
+
+    Returns:
+    void
+*/
+void rand_gauss_vec (Word32 *x, Word16 n, Word16 *seed)
+{
+    Word16 i, loc_seed;
+    Word32 temp;
+
+
+    loc_seed = *seed;
+    move16();
+    FOR (i = 0; i < n; i++)
+    {
+        loc_seed = (Word16)(13849L + (Word32)loc_seed * 31821);
+        temp = loc_seed;
+        loc_seed = (Word16)(13849L + (Word32)loc_seed * 31821);
+        temp = temp + loc_seed;
+        loc_seed = (Word16)(13849L + (Word32)loc_seed * 31821);
+        temp = temp + loc_seed;
+
+        x[i] = temp * (1 << (WORD16_BITS-CNG_RAND_GAUSS_SHIFT));
+        move32();
+    }
+    *seed = loc_seed;
+    move16();
 }
 
 
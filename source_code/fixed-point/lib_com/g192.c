@@ -10,6 +10,8 @@
 #ifndef _WIN32
 #include <netinet/in.h>
 #include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #else
 #include <Winsock2.h>
 typedef unsigned short     uint16_t;
@@ -22,6 +24,7 @@ typedef signed __int64     int64_t;
 #include "options.h"
 #include "stl.h"
 #include "g192.h"
+#include "mime.h"
 
 
 #ifdef _MSC_VER
@@ -34,6 +37,8 @@ typedef signed __int64     int64_t;
 #define G192_BIT1            (Word16)0x0081
 #define MAX_BITS_PER_FRAME           2560
 #define RTP_HEADER_PART1     (Word16)22               /* magic number by network simulator */
+#define RTP_DUMP_HEADER_SIZE 20                       /* packet size, arrival time and 12 byte RTP header */
+#define READ_CHUNK_SIZE      (1 << 20)                /* unmappable files are read in chunks of 1 MiB */
 
 /*
  * Structures
@@ -43,6 +48,19 @@ typedef signed __int64     int64_t;
 struct __G192
 {
     FILE * file;
+    G192_STREAM_HANDLE stream;   /* file mapped into memory, NULL: frames read with fread() */
+};
+
+/* stream reader handle */
+struct __G192_STREAM
+{
+    unsigned char * base;        /* file content */
+    size_t size;                 /* bytes at base */
+    size_t start;                /* first frame, after the file header */
+    size_t pos;                  /* next frame */
+    G192_FORMAT format;
+    Word16 amrwb;                /* RFC 4867 storage file */
+    Word16 mapped;               /* base from mmap(), else from malloc() */
 };
 
 /*
@@ -69,6 +87,12 @@ G192_Reader_Open(G192_HANDLE* phG192, FILE * filename)
         return G192_FILE_NOT_FOUND;
     }
 
+    /* read the packets from memory where possible, fread() per field otherwise */
+    if( G192_Stream_OpenFile(&(*phG192)->stream, filename, G192_FORMAT_RTPDUMP) != G192_NO_ERROR )
+    {
+        (*phG192)->stream = NULL;
+    }
+
     return G192_NO_ERROR;
 }
 
@@ -81,18 +105,37 @@ G192_ReadVoipFrame_compact(G192_HANDLE const hG192,
                            Word32 *rcvTime_ms)
 {
     Word16 short_serial [MAX_BITS_PER_FRAME];
+    const Word16 *bits = short_serial;
+    G192_FRAME_VIEW frame;
     G192_ERROR err;
     Word16 i;
 
-    err = G192_ReadVoipFrame_short(hG192, short_serial, num_bits, rtpSequenceNumber, rtpTimeStamp, rcvTime_ms);
-    if(err != G192_NO_ERROR)
+    if(hG192->stream != NULL)
     {
-        return err;
+        /* pack the bits straight from the mapped packet */
+        err = G192_Stream_ReadFrame(hG192->stream, &frame);
+        if(err != G192_NO_ERROR)
+        {
+            return err;
+        }
+        *num_bits = frame.num_bits;
+        *rtpSequenceNumber = frame.rtpSequenceNumber;
+        *rtpTimeStamp = frame.rtpTimeStamp;
+        *rcvTime_ms = frame.rcvTime_ms;
+        bits = (const Word16 *)(frame.data + 2 * sizeof(Word16));
+    }
+    else
+    {
+        err = G192_ReadVoipFrame_short(hG192, short_serial, num_bits, rtpSequenceNumber, rtpTimeStamp, rcvTime_ms);
+        if(err != G192_NO_ERROR)
+        {
+            return err;
+        }
     }
 
     for(i=0; i<*num_bits; i++)
     {
-        unsigned char bit = (short_serial[i] == G192_BIT1) ? 1 : 0;
+        unsigned char bit = (bits[i] == G192_BIT1) ? 1 : 0;
         unsigned char bitinbyte = bit << (7- (i&0x7));
         if(!(i&0x7))
             serial[i>>3] = 0;
@@ -115,6 +158,23 @@ G192_ReadVoipFrame_short(G192_HANDLE const hG192,
     Word32 ssrc;
     Word16 rtpPayloadG192[2];
     Word16 rtpPayloadSize;
+    G192_FRAME_VIEW frame;
+    G192_ERROR err;
+
+    if(hG192->stream != NULL)
+    {
+        err = G192_Stream_ReadFrame(hG192->stream, &frame);
+        if(err != G192_NO_ERROR)
+        {
+            return err;
+        }
+        *num_bits = frame.num_bits;
+        *rtpSequenceNumber = frame.rtpSequenceNumber;
+        *rtpTimeStamp = frame.rtpTimeStamp;
+        *rcvTime_ms = frame.rcvTime_ms;
+        memcpy(serial, frame.data + 2 * sizeof(Word16), *num_bits * sizeof(Word16));
+        return G192_NO_ERROR;
+    }
 
     /* RTP packet size */
     if(fread(&rtpPacketSize, sizeof(rtpPacketSize), 1, hG192->file) != 1)
@@ -246,9 +306,364 @@ G192_Reader_Close(G192_HANDLE* phG192)
         return G192_NO_ERROR;
     }
 
+    G192_Stream_Close(&(*phG192)->stream);
     free( *phG192 );
     *phG192 = NULL;
     phG192 = NULL;
 
     return G192_NO_ERROR;
 }
+
+/*
+ * Stream reader: the whole file is mapped into memory and the frames are returned as views
+ * into the mapping, which can be passed to read_indices_fx_real()/read_indices_mime_real()
+ * without copying
+ */
+
+/* read the rest of a file that can not be mapped, e.g. a pipe */
+static G192_ERROR
+G192_Stream_ReadAll(G192_STREAM_HANDLE const hStream, FILE * file)
+{
+    unsigned char * grown;
+    size_t n, capacity = 0;
+
+    do
+    {
+        if(hStream->size == capacity)
+        {
+            capacity += READ_CHUNK_SIZE;
+            grown = (unsigned char *) realloc(hStream->base, capacity);
+            if(grown == NULL)
+            {
+                return G192_MEMORY_ERROR;
+            }
+            hStream->base = grown;
+        }
+        n = fread(hStream->base + hStream->size, 1, capacity - hStream->size, file);
+        hStream->size += n;
+    }
+    while(n > 0);
+
+    return ferror(file) ? G192_READ_ERROR : G192_NO_ERROR;
+}
+
+/* skip the file header of the MIME storage formats */
+static G192_ERROR
+G192_Stream_ReadHeader(G192_STREAM_HANDLE const hStream)
+{
+    size_t evsMagic = strlen(EVS_MAGIC_NUMBER);
+    size_t amrwbMagic = strlen(AMRWB_MAGIC_NUMBER);
+
+    if(hStream->format != G192_FORMAT_MIME)
+    {
+        return G192_NO_ERROR;
+    }
+    if(hStream->size >= evsMagic && memcmp(hStream->base, EVS_MAGIC_NUMBER, evsMagic) == 0)
+    {
+        /* magic word and number of channels (32 bit, big endian) */
+        if(hStream->size < evsMagic + 4)
+        {
+            fprintf(stderr, "Premature end of file, cannot read EVS storage header\n");
+            return G192_READ_ERROR;
+        }
+        if(memcmp(hStream->base + evsMagic, "\0\0\0\1", 4) != 0)
+        {
+            fprintf(stderr, "EVS storage file with several channels not supported\n");
+            return G192_NOT_IMPLEMENTED;
+        }
+        hStream->start = evsMagic + 4;
+    }
+    else if(hStream->size >= amrwbMagic && memcmp(hStream->base, AMRWB_MAGIC_NUMBER, amrwbMagic) == 0)
+    {
+        hStream->start = amrwbMagic;
+        hStream->amrwb = 1;
+    }
+    hStream->pos = hStream->start;
+
+    return G192_NO_ERROR;
+}
+
+G192_ERROR
+G192_Stream_Open(G192_STREAM_HANDLE* phStream, const char * filename, G192_FORMAT format)
+{
+    FILE * file;
+    G192_ERROR err;
+
+    *phStream = NULL;
+    if(filename == NULL || (file = fopen(filename, "rb")) == NULL)
+    {
+        return G192_FILE_NOT_FOUND;
+    }
+    err = G192_Stream_OpenFile(phStream, file, format);
+    fclose(file);
+
+    return err;
+}
+
+/* the stream starts at the current position of file, which may be closed afterwards */
+G192_ERROR
+G192_Stream_OpenFile(G192_STREAM_HANDLE* phStream, FILE * file, G192_FORMAT format)
+{
+    long offset;
+    G192_ERROR err;
+#ifndef _WIN32
+    struct stat st;
+    void * map;
+#endif
+
+    *phStream = NULL;
+    if(file == NULL)
+    {
+        return G192_FILE_NOT_FOUND;
+    }
+    if(format != G192_FORMAT_G192 && format != G192_FORMAT_MIME && format != G192_FORMAT_RTPDUMP)
+    {
+        return G192_WRONG_PARAMS;
+    }
+
+    *phStream = (G192_STREAM_HANDLE) calloc(1, sizeof(struct __G192_STREAM));
+    if(*phStream == NULL)
+    {
+        return G192_MEMORY_ERROR;
+    }
+    (*phStream)->format = format;
+
+    offset = ftell(file);
+#ifndef _WIN32
+    /* private writable mapping: the read_indices functions take non-const frame pointers */
+    if(offset >= 0 && fstat(fileno(file), &st) == 0 && S_ISREG(st.st_mode) && st.st_size > offset)
+    {
+        map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(file), 0);
+        if(map != MAP_FAILED)
+        {
+            madvise(map, st.st_size, MADV_SEQUENTIAL);
+            (*phStream)->base = (unsigned char *) map;
+            (*phStream)->size = st.st_size;
+            (*phStream)->start = offset;
+            (*phStream)->mapped = 1;
+        }
+    }
+#endif
+    if(!(*phStream)->mapped)
+    {
+        err = G192_Stream_ReadAll(*phStream, file);
+        if(err != G192_NO_ERROR)
+        {
+            G192_Stream_Close(phStream);
+            return err;
+        }
+    }
+    (*phStream)->pos = (*phStream)->start;
+
+    err = G192_Stream_ReadHeader(*phStream);
+    if(err != G192_NO_ERROR)
+    {
+        G192_Stream_Close(phStream);
+        return err;
+    }
+
+    return G192_NO_ERROR;
+}
+
+G192_ERROR
+G192_Stream_ReadFrame(G192_STREAM_HANDLE const hStream, G192_FRAME_VIEW * const frame)
+{
+    unsigned char * p;
+    size_t left;
+    Word16 header[2];
+    Word32 rtpPacketSize, rate;
+    Word16 rtpPacketHeaderPart1;
+    uint16_t u16;
+    uint32_t u32;
+    unsigned char toc;
+
+    if(hStream == NULL)
+    {
+        return G192_NOT_INITIALIZED;
+    }
+    if(hStream->pos >= hStream->size)
+    {
+        return G192_EOF;
+    }
+    p = hStream->base + hStream->pos;
+    left = hStream->size - hStream->pos;
+
+    memset(frame, 0, sizeof(*frame));
+    switch(hStream->format)
+    {
+    case G192_FORMAT_G192:
+        if(left < sizeof(header))
+        {
+            fprintf(stderr, "Premature end of file, cannot read G.192 header\n");
+            return G192_READ_ERROR;
+        }
+        memcpy(header, p, sizeof(header));
+        if(header[0] != G192_SYNC_GOOD_FRAME && header[0] != G192_SYNC_BAD_FRAME)
+        {
+            fprintf(stderr, "G192_SYNC_WORD missing at byte %ld\n", (long)hStream->pos);
+            return G192_INVALID_DATA;
+        }
+        if(header[1] < 0 || header[1] > MAX_BITS_PER_FRAME)
+        {
+            fprintf(stderr, "too large G.192 frame (size(%d))\n", header[1]);
+            return G192_INVALID_DATA;
+        }
+        frame->data = p;
+        frame->num_bits = header[1];
+        frame->size = (2 + header[1]) * sizeof(Word16);
+        break;
+
+    case G192_FORMAT_MIME:
+        toc = p[0];
+        if(hStream->amrwb)
+        {
+            rate = AMRWB_IOmode2rate[(toc >> 3) & 0x0F];   /* |P| FT |Q|P|P| */
+        }
+        else if(toc & 0x20)
+        {
+            rate = AMRWB_IOmode2rate[toc & 0x0F];
+        }
+        else
+        {
+            rate = PRIMARYmode2rate[toc & 0x0F];
+        }
+        if(rate < 0)
+        {
+            fprintf(stderr, "invalid frame header %02x at byte %ld\n", toc, (long)hStream->pos);
+            return G192_INVALID_DATA;
+        }
+        frame->data = p;
+        frame->num_bits = (Word16)(rate / 50);
+        frame->size = 1 + (frame->num_bits + 7) / 8;
+        break;
+
+    default:
+        /* packet size, arrival time, RTP header (part 1, sequence number, timestamp, ssrc), G.192 payload */
+        if(left < RTP_DUMP_HEADER_SIZE)
+        {
+            return G192_EOF;
+        }
+        memcpy(&rtpPacketSize, p, sizeof(rtpPacketSize));
+        if(rtpPacketSize <= 12)
+        {
+            fprintf(stderr, "RTP Packet size too small: %d\n", rtpPacketSize);
+            return G192_INVALID_DATA;
+        }
+        memcpy(&frame->rcvTime_ms, p + 4, sizeof(frame->rcvTime_ms));
+        memcpy(&rtpPacketHeaderPart1, p + 8, sizeof(rtpPacketHeaderPart1));
+        if(rtpPacketHeaderPart1 != RTP_HEADER_PART1)
+        {
+            fprintf(stderr, "Unexpected RTP Packet header\n");
+            return G192_INVALID_DATA;
+        }
+        memcpy(&u16, p + 10, sizeof(u16));
+        frame->rtpSequenceNumber = (Word16)ntohs(u16);
+        memcpy(&u32, p + 12, sizeof(u32));
+        frame->rtpTimeStamp = (Word32)ntohl(u32);
+
+        /* the payload size counts 16 bit words */
+        if(rtpPacketSize - 12 <= 2 || rtpPacketSize - 12 > 2 + MAX_BITS_PER_FRAME)
+        {
+            fprintf(stderr, "RTP payload size out of range: %d\n", rtpPacketSize - 12);
+            return G192_INVALID_DATA;
+        }
+        if(left < RTP_DUMP_HEADER_SIZE + (size_t)(rtpPacketSize - 12) * sizeof(Word16))
+        {
+            return G192_EOF;
+        }
+        memcpy(header, p + RTP_DUMP_HEADER_SIZE, sizeof(header));
+        if(header[0] != G192_SYNC_GOOD_FRAME)
+        {
+            fprintf(stderr, "G192_SYNC_WORD missing from RTP payload!");
+            return G192_INVALID_DATA;
+        }
+        if(header[1] == 0 || header[1] + 2 != rtpPacketSize - 12)
+        {
+            fprintf(stderr, "error in parsing RTP payload: rtpPayloadSize=%u nBits=%d",
+                    rtpPacketSize - 12, header[1]);
+            return G192_INVALID_DATA;
+        }
+        frame->data = p + RTP_DUMP_HEADER_SIZE;
+        frame->num_bits = header[1];
+        frame->size = (rtpPacketSize - 12) * sizeof(Word16);
+        left -= RTP_DUMP_HEADER_SIZE;
+        hStream->pos += RTP_DUMP_HEADER_SIZE;
+        break;
+    }
+
+    if(left < (size_t)frame->size)
+    {
+        fprintf(stderr, "Premature end of file, cannot read frame at byte %ld\n", (long)hStream->pos);
+        return G192_READ_ERROR;
+    }
+    hStream->pos += frame->size;
+
+    return G192_NO_ERROR;
+}
+
+/* check the sync words and sizes of all frames in one pass, the read position is kept */
+G192_ERROR
+G192_Stream_Validate(G192_STREAM_HANDLE const hStream, Word32 * const num_frames)
+{
+    G192_FRAME_VIEW frame;
+    G192_ERROR err;
+    size_t pos;
+
+    if(hStream == NULL)
+    {
+        return G192_NOT_INITIALIZED;
+    }
+    pos = hStream->pos;
+    hStream->pos = hStream->start;
+    *num_frames = 0;
+    while((err = G192_Stream_ReadFrame(hStream, &frame)) == G192_NO_ERROR)
+    {
+        (*num_frames)++;
+    }
+    hStream->pos = pos;
+
+    return err == G192_EOF ? G192_NO_ERROR : err;
+}
+
+G192_ERROR
+G192_Stream_Rewind(G192_STREAM_HANDLE const hStream)
+{
+    if(hStream == NULL)
+    {
+        return G192_NOT_INITIALIZED;
+    }
+    hStream->pos = hStream->start;
+
+    return G192_NO_ERROR;
+}
+
+/* 1 for an RFC 4867 AMR-WB storage file, see st->amrwb_rfc4867_flag */
+Word16
+G192_Stream_IsAmrWb(G192_STREAM_HANDLE const hStream)
+{
+    return hStream != NULL && hStream->amrwb;
+}
+
+G192_ERROR
+G192_Stream_Close(G192_STREAM_HANDLE* phStream)
+{
+    if(phStream == NULL || *phStream == NULL)
+    {
+        return G192_NO_ERROR;
+    }
+
+#ifndef _WIN32
+    if((*phStream)->mapped)
+    {
+        munmap((*phStream)->base, (*phStream)->size);
+    }
+    else
+#endif
+    {
+        free((*phStream)->base);
+    }
+    free(*phStream);
+    *phStream = NULL;
+
+    return G192_NO_ERROR;
+}
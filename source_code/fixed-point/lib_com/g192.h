@@ -27,6 +27,15 @@ typedef enum _G192_ERROR
     G192_EOF               = 0xffff   /* EOF during reading */
 } G192_ERROR;
 
+/* file formats of the stream reader */
+
+typedef enum _G192_FORMAT
+{
+    G192_FORMAT_G192       = 0x0000,  /* ITU-T G.192: sync word, length, one word per bit */
+    G192_FORMAT_MIME       = 0x0001,  /* EVS (TS 26.445) or AMR-WB (RFC 4867) storage format, or bare ToC frames */
+    G192_FORMAT_RTPDUMP    = 0x0002   /* RTP packets with G.192 payload, as read by G192_ReadVoipFrame_short() */
+} G192_FORMAT;
+
 /*
  * Structures
  */
@@ -35,6 +44,21 @@ typedef enum _G192_ERROR
 struct __G192;
 typedef struct __G192 * G192_HANDLE;
 
+/* stream reader handle, the file is mapped into memory */
+struct __G192_STREAM;
+typedef struct __G192_STREAM * G192_STREAM_HANDLE;
+
+/* frame in the mapped file, valid until G192_Stream_Close() */
+typedef struct _G192_FRAME_VIEW
+{
+    unsigned char *data;        /* G.192 sync word or MIME ToC, as taken by read_indices_fx_real()/read_indices_mime_real() */
+    Word32 size;                /* bytes at data */
+    Word16 num_bits;            /* bits of the frame payload */
+    Word16 rtpSequenceNumber;   /* RTP dump only */
+    Word32 rtpTimeStamp;        /* RTP dump only */
+    Word32 rcvTime_ms;          /* RTP dump only */
+} G192_FRAME_VIEW;
+
 /*
  * Functions
  */
@@ -61,4 +85,25 @@ G192_ReadVoipFrame_short(G192_HANDLE const hG192,
 G192_ERROR
 G192_Reader_Close(G192_HANDLE* phG192);
 
+G192_ERROR
+G192_Stream_Open(G192_STREAM_HANDLE* phStream, const char * filename, G192_FORMAT format);
+
+G192_ERROR
+G192_Stream_OpenFile(G192_STREAM_HANDLE* phStream, FILE * file, G192_FORMAT format);
+
+G192_ERROR
+G192_Stream_ReadFrame(G192_STREAM_HANDLE const hStream, G192_FRAME_VIEW * const frame);
+
+G192_ERROR
+G192_Stream_Validate(G192_STREAM_HANDLE const hStream, Word32 * const num_frames);
+
+G192_ERROR
+G192_Stream_Rewind(G192_STREAM_HANDLE const hStream);
+
+Word16
+G192_Stream_IsAmrWb(G192_STREAM_HANDLE const hStream);
+
+G192_ERROR
+G192_Stream_Close(G192_STREAM_HANDLE* phStream);
+
 #endif /* G192_H */
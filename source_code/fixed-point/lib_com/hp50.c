@@ -138,22 +138,199 @@ static void filter_2nd_order(
 }
 
 
-void hp20(Word16 signal[],     /* i/o: signal to filter                   any */
-          const Word16 stride,       /* i  : stride to be applied accessing signal  */
-          const Word16 lg,           /* i  : length of signal (integer)          Q0 */
-          Word32 mem[5],       /* i/o: static filter memory with this layout: */
-          /*      mem[0]: y[-2] (32-bit)                 */
-          /*      mem[1]; y[-1] (32-bit)                 */
-          /*      mem[2]: x[-2] << 16                    */
-          /*      mem[3]: x[-1] << 16                    */
-          /* Note: mem[0..3] need to be scaled per frame */
-          /*      mem[4]: states scale                   */
-          const Word32 sFreq)        /* i  : input sampling rate                 Q0 */
+/*
+ * The basic operations of filter_2nd_order() as plain 64-bit arithmetic for
+ * the lane kernel, which is not instrumented: the result of every operation
+ * is saturated as by the basic operation and the saturations are reported
+ * through *ovf, to be raised in Overflow afterwards.
+ */
+static Word32 hp20_lane_sat(Word40 x, Word16 *ovf)
 {
-    Word32 a1, b1, a2, b2;
-    Word16 prescale, prescaleOld, diff;
+    if (x > MAX_32)
+    {
+        *ovf = 1;
+        return MAX_32;
+    }
+    if (x < MIN_32)
+    {
+        *ovf = 1;
+        return MIN_32;
+    }
+    return (Word32)x;
+}
+
+/* HP50_Mpy_32_32_fix() for q = 31, HP50_Mode2_Mpy_32_16_fix() for q = 15 */
+static Word32 hp20_lane_mpy(Word32 a, Word32 b, const Word16 q)
+{
+    Word40 result = ((Word40)a * b) >> q;
+
+    if (result > MAX_32)
+    {
+        result = MAX_32;    /* MIN_32*MIN_32, saturated without Overflow */
+    }
+    if (result < 0)
+    {
+        result++;
+    }
+    return (Word32)result;
+}
+
+/* L_shl(L_sum, HP20_COEFF_SCALE) of the L_add() chain of the five products */
+static Word32 hp20_lane_sum(Word32 p0, Word32 p1, Word32 p2, Word32 p3, Word32 p4, Word16 *ovf)
+{
+    Word32 L_sum;
+
+    L_sum = hp20_lane_sat((Word40)p0 + p1, ovf);
+    L_sum = hp20_lane_sat((Word40)L_sum + p2, ovf);
+    L_sum = hp20_lane_sat((Word40)L_sum + p3, ovf);
+    L_sum = hp20_lane_sat((Word40)L_sum + p4, ovf);
+    return hp20_lane_sat((Word40)L_sum * (1 << HP20_COEFF_SCALE), ovf);
+}
 
+/* shr(x, prescale) */
+static Word16 hp20_lane_in(Word16 x, const Word16 prescale, Word16 *ovf)
+{
+    Word32 y;
+
+    if (prescale >= 0)
+    {
+        return (Word16)(x >> prescale);
+    }
+    y = (Word32)x * (1 << -prescale);
+    if (y > MAX_16)
+    {
+        *ovf = 1;
+        return MAX_16;
+    }
+    if (y < MIN_16)
+    {
+        *ovf = 1;
+        return MIN_16;
+    }
+    return (Word16)y;
+}
+
+/* round_fx(L_shl(L_y, prescale)) */
+static Word16 hp20_lane_out(Word32 L_y, const Word16 prescale, Word16 *ovf)
+{
+    if (prescale >= 0)
+    {
+        L_y = hp20_lane_sat((Word40)L_y * (1 << prescale), ovf);
+    }
+    else
+    {
+        L_y >>= -prescale;
+    }
+    return (Word16)(hp20_lane_sat((Word40)L_y + 0x8000, ovf) >> 16);
+}
 
+/*
+ * filter_2nd_order_lanes
+ *
+ * Function:
+ *    filter_2nd_order() on the signals of several lanes with the same
+ *    coefficients and length, in lockstep: every sample is filtered in all
+ *    lanes before the next, the states of the lanes are kept side by side.
+ *    Each lane gets the results of filter_2nd_order(), bit-exact, from the
+ *    inline arithmetic above instead of the calls to the basic operations.
+ */
+static void filter_2nd_order_lanes(
+    Word16 *signal[],
+    const Word16 lanes,
+    const Word16 prescale[],
+    const Word16 lg,
+    Word32 *mem[],
+    Word32 a1,
+    Word32 a2,
+    Word32 b1,
+    Word32 b2
+)
+{
+
+    Word16 i, k, ovf;
+    Word16 x2[DEC_LANES_MAX], x1[DEC_LANES_MAX];
+    Word32 L_y1[DEC_LANES_MAX], L_y2[DEC_LANES_MAX];
+
+
+    ovf = 0;
+
+    /* Execute first 2 iterations with 32-bit x anx y memory values */
+    for (k = 0; k < lanes; k++)
+    {
+        x2[k] = hp20_lane_in(signal[k][0], prescale[k], &ovf);
+        L_y2[k] = hp20_lane_sum(hp20_lane_mpy(b2, mem[k][2], 31),
+                                hp20_lane_mpy(b1, mem[k][3], 31),
+                                hp20_lane_mpy(b2, x2[k], 15),
+                                hp20_lane_mpy(mem[k][0], a2, 31),
+                                hp20_lane_mpy(mem[k][1], a1, 31), &ovf);
+        signal[k][0] = hp20_lane_out(L_y2[k], prescale[k], &ovf);
+
+        x1[k] = hp20_lane_in(signal[k][1], prescale[k], &ovf);
+        L_y1[k] = hp20_lane_sum(hp20_lane_mpy(b2, mem[k][3], 31),
+                                hp20_lane_mpy(b1, x2[k], 15),
+                                hp20_lane_mpy(b2, x1[k], 15),
+                                hp20_lane_mpy(mem[k][1], a2, 31),
+                                hp20_lane_mpy(L_y2[k], a1, 31), &ovf);
+        signal[k][1] = hp20_lane_out(L_y1[k], prescale[k], &ovf);
+    }
+
+    /* the recursions of the lanes are independent, so they are interleaved sample by sample */
+    for (i = 2; i < lg; i+=2)
+    {
+        for (k = 0; k < lanes; k++)
+        {
+            /* y[i+0] = b2*x[i-2] + b1*x[i-1] + b2*x[i-0] + a2*y[i-2] + a1*y[i-1];  */
+            Word32 p0 = hp20_lane_mpy(b2, x2[k], 15);
+            Word32 p1 = hp20_lane_mpy(b1, x1[k], 15);
+
+            x2[k] = hp20_lane_in(signal[k][i], prescale[k], &ovf);
+            L_y2[k] = hp20_lane_sum(p0, p1,
+                                    hp20_lane_mpy(b2, x2[k], 15),
+                                    hp20_lane_mpy(L_y2[k], a2, 31),
+                                    hp20_lane_mpy(L_y1[k], a1, 31), &ovf);
+            signal[k][i] = hp20_lane_out(L_y2[k], prescale[k], &ovf);
+
+            /* y[i+1] = b2*x[i-1] + b1*x[i-0] + b2*x[i+1] + a2*y[i-1] + a1*y[i+0];  */
+            p0 = hp20_lane_mpy(b2, x1[k], 15);
+            p1 = hp20_lane_mpy(b1, x2[k], 15);
+
+            x1[k] = hp20_lane_in(signal[k][i+1], prescale[k], &ovf);
+            L_y1[k] = hp20_lane_sum(p0, p1,
+                                    hp20_lane_mpy(b2, x1[k], 15),
+                                    hp20_lane_mpy(L_y1[k], a2, 31),
+                                    hp20_lane_mpy(L_y2[k], a1, 31), &ovf);
+            signal[k][i+1] = hp20_lane_out(L_y1[k], prescale[k], &ovf);
+        }
+    }
+
+    /* update static filter memory from variables */
+    for (k = 0; k < lanes; k++)
+    {
+        mem[k][0] = L_y2[k];
+        mem[k][1] = L_y1[k];
+        mem[k][2] = L_deposit_h(x2[k]);
+        mem[k][3] = L_deposit_h(x1[k]);
+    }
+    if (ovf)
+    {
+        Overflow = 1;
+    }
+
+
+    return;
+}
+
+
+/*
+ * hp20_prescale
+ *
+ * Function:
+ *    Scale of the signal in the 2nd order high pass filter: rescales the
+ *    filter memory to it and returns it.
+ */
+static Word16 hp20_prescale(Word16 signal[], const Word16 lg, Word32 mem[5])
+{
+    Word16 prescale, prescaleOld, diff;
 
     prescale = getScaleFactor16(signal, lg);
     prescaleOld = extract_l(mem[4]);
@@ -183,16 +360,28 @@ void hp20(Word16 signal[],     /* i/o: signal to filter                   any */
         mem[4] = L_deposit_l(prescale);
     }
 
+    return prescale;
+}
+
+/*
+ * hp20_coeffs
+ *
+ * Function:
+ *    Coefficients of the 2nd order high pass filter at 20 Hz for the
+ *    sampling rate sFreq.
+ */
+static void hp20_coeffs(const Word32 sFreq, Word32 *a1, Word32 *a2, Word32 *b1, Word32 *b2)
+{
     IF ( L_sub(sFreq,8000) == 0 )
     {
         /* hp filter 20Hz at 3dB for 8000 Hz input sampling rate
            [b,a] = butter(2, 20.0/4000.0, 'high');
            b = [0.988954248067140  -1.977908496134280   0.988954248067140]
            a = [1.000000000000000  -1.977786483776764   0.978030508491796]*/
-        a1 = L_add(0,1061816033l/* 1.977786483776764 Q29*/);
-        a2 = L_add(0,-525076131l/*-0.978030508491796 Q29*/);
-        b1 = L_add(0,-1061881538l/*-1.977908496134280 Q29*/);
-        b2 = L_add(0,530940769l/* 0.988954248067140 Q29*/);
+        *a1 = L_add(0,1061816033l/* 1.977786483776764 Q29*/);
+        *a2 = L_add(0,-525076131l/*-0.978030508491796 Q29*/);
+        *b1 = L_add(0,-1061881538l/*-1.977908496134280 Q29*/);
+        *b2 = L_add(0,530940769l/* 0.988954248067140 Q29*/);
 
     }
     ELSE IF ( L_sub(sFreq,16000) == 0 )
@@ -201,10 +390,10 @@ void hp20(Word16 signal[],     /* i/o: signal to filter                   any */
            [b,a] = butter(2, 20.0/8000.0, 'high');
            b = [0.994461788958195  -1.988923577916390   0.994461788958195]
            a = [1.000000000000000  -1.988892905899653   0.988954249933127] */
-        a1 = L_add(0,1067778748l/* 1.988892905899653 Q29*/);
-        a2 = L_add(0,-530940770l/*-0.988954249933127 Q29*/);
-        b1 = L_add(0,-1067795215l/*-1.988923577916390 Q29*/);
-        b2 = L_add(0,533897608l/* 0.994461788958195 Q29*/);
+        *a1 = L_add(0,1067778748l/* 1.988892905899653 Q29*/);
+        *a2 = L_add(0,-530940770l/*-0.988954249933127 Q29*/);
+        *b1 = L_add(0,-1067795215l/*-1.988923577916390 Q29*/);
+        *b2 = L_add(0,533897608l/* 0.994461788958195 Q29*/);
 
     }
     ELSE IF ( L_sub(sFreq,32000) == 0 )
@@ -213,10 +402,10 @@ void hp20(Word16 signal[],     /* i/o: signal to filter                   any */
            [b,a] = butter(2, 20.0/16000.0, 'high');
            b = [0.997227049904470  -1.994454099808940   0.997227049904470]
            a = [1.000000000000000  -1.994446410541927   0.994461789075954]*/
-        a1 = L_add(0,1070760263l/* 1.994446410541927 Q29*/);
-        a2 = L_add(0,-533897608l/*-0.994461789075954 Q29*/);
-        b1 = L_add(0,-1070764392l/*-1.994454099808940 Q29*/);
-        b2 = L_add(0,535382196l/* 0.997227049904470 Q29*/);
+        *a1 = L_add(0,1070760263l/* 1.994446410541927 Q29*/);
+        *a2 = L_add(0,-533897608l/*-0.994461789075954 Q29*/);
+        *b1 = L_add(0,-1070764392l/*-1.994454099808940 Q29*/);
+        *b2 = L_add(0,535382196l/* 0.997227049904470 Q29*/);
     }
     ELSE
     {
@@ -225,13 +414,33 @@ void hp20(Word16 signal[],     /* i/o: signal to filter                   any */
            [b,a] = butter(2, 20.0/24000.0, 'high');
            b =[0.998150511190452  -1.996301022380904   0.998150511190452]
            a =[1.000000000000000  -1.996297601769122   0.996304442992686]*/
-        a1 = L_add(0,1071754114l/* 1.996297601769122 Q29*/);
-        a2 = L_add(0,-534886875l/*-0.996304442992686 Q29*/);
-        b1 = L_add(0,-1071755951l/*-1.996301022380904 Q29*/);
-        b2 = L_add(0,535877975l/* 0.998150511190452 Q29*/);
+        *a1 = L_add(0,1071754114l/* 1.996297601769122 Q29*/);
+        *a2 = L_add(0,-534886875l/*-0.996304442992686 Q29*/);
+        *b1 = L_add(0,-1071755951l/*-1.996301022380904 Q29*/);
+        *b2 = L_add(0,535877975l/* 0.998150511190452 Q29*/);
     }
+}
 
 
+void hp20(Word16 signal[],     /* i/o: signal to filter                   any */
+          const Word16 stride,       /* i  : stride to be applied accessing signal  */
+          const Word16 lg,           /* i  : length of signal (integer)          Q0 */
+          Word32 mem[5],       /* i/o: static filter memory with this layout: */
+          /*      mem[0]: y[-2] (32-bit)                 */
+          /*      mem[1]; y[-1] (32-bit)                 */
+          /*      mem[2]: x[-2] << 16                    */
+          /*      mem[3]: x[-1] << 16                    */
+          /* Note: mem[0..3] need to be scaled per frame */
+          /*      mem[4]: states scale                   */
+          const Word32 sFreq)        /* i  : input sampling rate                 Q0 */
+{
+    Word32 a1, b1, a2, b2;
+    Word16 prescale;
+
+
+    prescale = hp20_prescale(signal, lg, mem);
+    hp20_coeffs(sFreq, &a1, &a2, &b1, &b2);
+
     filter_2nd_order(signal,
                      stride,
                      prescale,
@@ -246,5 +455,53 @@ void hp20(Word16 signal[],     /* i/o: signal to filter                   any */
 }
 
 
+/*
+ * hp20_lanes_fx
+ *
+ * Function:
+ *    hp20() on the frames of up to DEC_LANES_MAX streams with the same
+ *    sampling rate and frame length, filtered in lockstep. Each lane keeps
+ *    its own filter memory and scale; the output of every lane is bit-exact
+ *    to hp20() with stride 1 on that lane.
+ *
+ * Returns:
+ *    void
+ */
+void hp20_lanes_fx(Word16 *signal[],  /* i/o: signals to filter, one per lane          any */
+                   const Word16 lanes,      /* i  : number of lanes, up to DEC_LANES_MAX    Q0 */
+                   const Word16 lg,         /* i  : length of each signal (integer)         Q0 */
+                   Word32 *mem[],     /* i/o: static filter memory of each lane as in hp20() */
+                   const Word32 sFreq)      /* i  : input sampling rate                     Q0 */
+{
+    Word32 a1, b1, a2, b2;
+    Word16 k, prescale[DEC_LANES_MAX];
 
 
+    assert(lanes <= DEC_LANES_MAX);
+#if (WMOPS)
+    /* the lane kernel is not instrumented, complexity builds count the reference filter */
+    FOR (k = 0; k < lanes; k++)
+    {
+        hp20(signal[k], 1, lg, mem[k], sFreq);
+    }
+#else
+    FOR (k = 0; k < lanes; k++)
+    {
+        prescale[k] = hp20_prescale(signal[k], lg, mem[k]);
+        move16();
+    }
+    hp20_coeffs(sFreq, &a1, &a2, &b1, &b2);
+
+    filter_2nd_order_lanes(signal,
+                           lanes,
+                           prescale,
+                           lg,
+                           mem,
+                           a1,
+                           a2,
+                           b1,
+                           b2);
+#endif
+
+    return;
+}
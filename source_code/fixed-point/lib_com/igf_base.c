@@ -614,6 +614,7 @@ void IGFCommonFuncsCalcSfbEnergyPowerSpec(const Word16               startSfb,
     Word16/*Q0*/   sfb;
     Word16/*Q0*/   line;
     Word32 L_c;
+    UWord32 L_sum;
 
 
     FOR (sfb = startSfb; sfb < stopSfb; sfb++)
@@ -627,16 +628,20 @@ void IGFCommonFuncsCalcSfbEnergyPowerSpec(const Word16               startSfb,
 
     FOR (sfb = startSfb; sfb < stopSfb; sfb++)
     {
-        L_c = L_deposit_l(0);
+        /* 64 bit accumulation: L_sum holds the lower word and L_c counts
+           its carries, as the L_add_c()/L_macNs() pair does */
+        L_c   = L_deposit_l(0);
+        L_sum = 0;
+        move32();
         FOR (line = swb_offset[sfb]; line < swb_offset[sfb+1]; line++)
         {
-            Carry = 0;
-            sfbEnergy[sfb] = L_add_c(sfbEnergy[sfb], pPowerSpectrum[line]);
-            move32();
-            Overflow = 0;
-            L_c = L_macNs(L_c,0,0);
+            L_sum = (UWord32)(L_sum + (UWord32)pPowerSpectrum[line]);
+            if (L_sum < (UWord32)pPowerSpectrum[line])
+            {
+                L_c++;
+            }
         }
-        sfbEnergy[sfb] = norm_llQ31(L_c,sfbEnergy[sfb],&(sfbEnergy_exp[sfb]));
+        sfbEnergy[sfb] = norm_llQ31(L_c,(Word32)L_sum,&(sfbEnergy_exp[sfb]));
         move32();
         sfbEnergy_exp[sfb] = add(sfbEnergy_exp[sfb],*pPowerSpectrum_exp);
         move16();
@@ -659,6 +664,7 @@ void IGFCommonFuncsMDCTSquareSpec(const Word16                       sqrtBgn,
     Word16 j;
     Word16 s1;
     Word16 tmp;
+    Word32 L_tmp;
 
 
     /* get headroom, only in IGF range */
@@ -672,10 +678,17 @@ void IGFCommonFuncsMDCTSquareSpec(const Word16                       sqrtBgn,
     j = add(sqrtBgn, indexOffset);                                    /* handle indexOffset with care, otherwise memory overruns may occur! */
 
 
+    /* the shift by the measured headroom is exact, only the rounding can saturate */
     FOR (i = sqrtBgn; i < sqrtEnd; i++)
     {
-        tmp                 = round_fx(L_shl(mdctSpec[i], s1));
-        mdctSquareSpec[j++] = L_mult0(tmp, tmp);
+        L_tmp               = (Word32)((UWord32)mdctSpec[i] << s1);
+        tmp                 = MAX_16;
+        move16();
+        if (L_tmp < 0x7FFF8000)
+        {
+            tmp             = (Word16)((L_tmp + 0x8000) >> 16);
+        }
+        mdctSquareSpec[j++] = (Word32)tmp * tmp;
         move32();
     }
 
@@ -226,6 +226,25 @@ UWord32 direct_msize_fx(Word16 dim_in, Word16 k_in)
     return UL_msize;
 }
 
+/*-------------------------------------------------------------------*
+ * a_tab_row_fx()
+ *
+ *  row A(dim_in, 0 .. k_val_in+1) of the stored offset table,
+ *  NULL if the row is not stored that far
+ *-------------------------------------------------------------------*/
+static
+const UWord32 *a_tab_row_fx(Word16 dim_in, Word16 k_val_in)
+{
+    const UWord32 *row;
+
+    row = NULL;
+    if( sub(add(k_val_in, 1), sub(pvq_a_row_fx[dim_in+1], pvq_a_row_fx[dim_in])) < 0 )
+    {
+        row = &pvq_a_tab_fx[pvq_a_row_fx[dim_in]];
+    }
+    return row;
+}
+
 /* update h_mem[0.. k_val_in+1] ,  with starting offsets for A+U recursion */
 static
 void initOffsets_fx( Word16 dim_in , UWord32* h_mem, Word16 k_val_in)
@@ -394,6 +413,7 @@ UWord32 nm_h_prep_opt_fx(      /* o:  msize for dim     */
     UWord32 h_saveA, h_saveB, u_kp1,a_k;   /*  registers   for alternating  A(n,k-1), A(n,k-2)*/
     UWord32 numDsub1;
     Word16 end_loop, add_last_odd ;
+    const UWord32 *a_row;
 
     h[0]          =  UL_deposit_l(0);                         /*    % A(=>0,k=0)      */
     h[1]          =  UL_deposit_l(1);                         /*    % A(*,k=1)        */
@@ -401,6 +421,22 @@ UWord32 nm_h_prep_opt_fx(      /* o:  msize for dim     */
     mem_size_m1 = add(k_val_in,1);
 
     assert(dim_in > N_OPT_FX);  /* code now optimized with direct functions for dim <= N_OPT_FX ) */
+
+    /* stored row: copy A(n,0..k), U(n,k+1) = A(n,k+1)>>1 as A(n,k+1) is odd */
+    a_row = a_tab_row_fx(dim_in, k_val_in);
+    IF( a_row != NULL )
+    {
+        FOR( k_val = 2; k_val <= k_val_in; k_val++ )
+        {
+            h[k_val] = a_row[k_val];
+            move32();
+        }
+        h[mem_size_m1] = UL_lshr(a_row[mem_size_m1], 1);
+        move32();
+
+        return ( UL_addNsD(1U, UL_addNsD(h[mem_size_m1], UL_lshr(a_row[k_val_in],1))));
+    }
+
     IF(  (sub(k_val_in, TABLE_LIM_OPT_FX) > 0)  )
     {
         d_start = 2;
@@ -1091,6 +1127,7 @@ void vec2mind_fx(Word16 dim_in,                /* i :  dim
 {
     Word16  pos,  mem_size_m1, k_val_acc, tmp_val;
     UWord32 tmp_h;
+    const UWord32 *a_row;
 
     /*
     %%   main steps
@@ -1110,6 +1147,26 @@ void vec2mind_fx(Word16 dim_in,                /* i :  dim
 
     pos            =  sub(dim_in,2);               /*  adress 2nd last sample */
     vec2mind_two_fx(&vec_in[pos],&k_val_acc,next_sign_ind ,index);
+
+    /* stored rows: read A(dim_in-pos, k_val_acc) directly, no row recursion */
+    a_row = a_tab_row_fx(dim_in, k_val_in);
+    IF( a_row != NULL )
+    {
+        FOR (pos--; pos>=0; pos--)
+        {
+            tmp_val = vec_in[pos];
+            move16();
+            enc_push_sign(tmp_val, next_sign_ind, index);
+
+            *index    = UL_addNsD(*index, pvq_a_tab_fx[pvq_a_row_fx[dim_in-pos] + k_val_acc]);
+            k_val_acc = add(k_val_acc, abs_s(tmp_val));
+        }
+        *N_MPVQ_ptr = UL_addNsD(1U,UL_addNsD(UL_lshr(a_row[k_val_acc],1),UL_lshr(a_row[mem_size_m1],1)));
+        move32();
+
+        return;
+    }
+
     initOffsets_fx( 3, h_mem, k_val_in) ;         /*  start recursions at 3rd sample */
 
     tmp_h          = h_mem[k_val_acc];
@@ -1573,12 +1573,12 @@ Word16 vq_dec_lvq_fx (
     Word16 N,              /* i  : Vector dimension                          */
     Word16 mode,           /* (i): mode_lvq, or mode_lvq_p                     */
     Word16 no_bits,        /* (i): no. bits for lattice                         */
-    Word32 *p_offset_scale1,
-    Word32 *p_offset_scale2,
-    Word32 *p_offset_scale1_p,
-    Word32 *p_offset_scale2_p,
-    Word16 *p_no_scales,
-    Word16 *p_no_scales_p
+    const Word32 *p_offset_scale1,
+    const Word32 *p_offset_scale2,
+    const Word32 *p_offset_scale1_p,
+    const Word32 *p_offset_scale2_p,
+    const Word16 *p_no_scales,
+    const Word16 *p_no_scales_p
 )
 {
     Word16  x_lvq[M];
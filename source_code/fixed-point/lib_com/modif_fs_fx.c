@@ -17,6 +17,84 @@
  * Local functions
  *-----------------------------------------------------------------*/
 
+static Word16 build_polyphase_bank_fx( const Word16 *win, const Word16 up_samp, const Word16 nb_coef, Word16 bank[] );
+
+static Word32 dot_product_exact_fx( const Word16 *x, const Word16 *y, const Word16 len );
+
+/*-------------------------------------------------------------------*
+ * build_polyphase_bank_fx()
+ *
+ * Rearrange the interpolation window of Interpol_lc_fx() into one
+ * contiguous branch of 2*nb_coef coefficients per fraction 0..up_samp:
+ * the taps applied to x[-nb_coef+1..0] (in reverse) followed by the
+ * taps applied to x[1..nb_coef]. Returns 1 when the L1 norm of every
+ * branch is below 2^16, i.e. when no partial sum of the L_mac0 chain
+ * can saturate for any 16-bit input, and the plain sum is bit-exact.
+ *-------------------------------------------------------------------*/
+static Word16 build_polyphase_bank_fx(
+    const Word16 *win,     /* i  : interpolation window             Q14 */
+    const Word16 up_samp,  /* i  : upsampling factor                Q0  */
+    const Word16 nb_coef,  /* i  : number of coefficients           Q0  */
+    Word16 bank[]          /* o  : polyphase branches               Q14 */
+)
+{
+    Word16 frac, k;
+    Word16 *c;
+    Word32 L_norm;
+
+    IF( (up_samp + 1) * 2 * nb_coef > L_FILT_BANK_MAX )
+    {
+        return 0;
+    }
+
+    c = bank;
+    FOR( frac = 0; frac <= up_samp; frac++ )
+    {
+        L_norm = 0;
+        move32();
+        FOR( k = 0; k < nb_coef; k++ )
+        {
+            c[nb_coef - 1 - k] = win[frac + k * up_samp];
+            move16();
+            c[nb_coef + k] = win[up_samp - frac + k * up_samp];
+            move16();
+            L_norm += abs( c[nb_coef - 1 - k] ) + abs( c[nb_coef + k] );
+        }
+        IF( L_norm >= 65536 )
+        {
+            return 0;
+        }
+        c += 2 * nb_coef;
+    }
+
+    return 1;
+}
+
+/*-------------------------------------------------------------------*
+ * dot_product_exact_fx()
+ *
+ * Sum of x[i]*y[i] without intermediate saturation; the caller makes
+ * sure the result fits in 32 bits
+ *-------------------------------------------------------------------*/
+static Word32 dot_product_exact_fx(
+    const Word16 *x,       /* i  : first vector                     Qx  */
+    const Word16 *y,       /* i  : second vector                    Qy  */
+    const Word16 len       /* i  : vector length                    Q0  */
+)
+{
+    Word16 i;
+    Word32 L_sum;
+
+    L_sum = 0;
+    move32();
+    FOR( i = 0; i < len; i++ )
+    {
+        L_sum += (Word32)x[i] * y[i];
+    }
+
+    return L_sum;
+}
+
 
 
 /*==============================================================================*/
@@ -70,6 +148,7 @@ Word16 modify_Fs_fx(            /* o  : length of output    Q0  */
     Word32 LepsP[M+1];
     Word16 flag_low_order = 0;
     Word16 filt_len_tmp;
+    Word16 bank_fx[L_FILT_BANK_MAX], bank_len;
 
     const Resampling_cfg_fx *cfg_ptr_fx;
 
@@ -229,18 +308,39 @@ Word16 modify_Fs_fx(            /* o  : length of output    Q0  */
         filt_len_tmp = shr(add(filt_len, 1), 1);
     }
 
-    FOR(i=0; i<lg_out; i++)
+    IF( build_polyphase_bank_fx( cfg_ptr_fx->filter_fx, fac_num, filt_len_tmp, bank_fx ) )
     {
-        sigOut_fx[i] = round_fx(Interpol_lc_fx( sigIn_ptr, cfg_ptr_fx->filter_fx, frac, fac_num, filt_len_tmp ));
+        /* exact dot products over the contiguous polyphase branches */
+        bank_len = shl(filt_len_tmp, 1);
+        FOR(i=0; i<lg_out; i++)
+        {
+            sigOut_fx[i] = round_fx(L_shl(dot_product_exact_fx( sigIn_ptr - filt_len_tmp + 1, bank_fx + i_mult2(frac, bank_len), bank_len ), 1));
 
-        frac = add(frac,fracstep);
+            frac = add(frac,fracstep);
 
-        j = sub(fac_num, frac);
-        if (j < 0)
+            j = sub(fac_num, frac);
+            if (j < 0)
+            {
+                frac = sub(frac,fac_num);
+            }
+            sigIn_ptr += add(lshr(j, 15), datastep);
+        }
+    }
+    ELSE
+    {
+        FOR(i=0; i<lg_out; i++)
         {
-            frac = sub(frac,fac_num);
+            sigOut_fx[i] = round_fx(Interpol_lc_fx( sigIn_ptr, cfg_ptr_fx->filter_fx, frac, fac_num, filt_len_tmp ));
+
+            frac = add(frac,fracstep);
+
+            j = sub(fac_num, frac);
+            if (j < 0)
+            {
+                frac = sub(frac,fac_num);
+            }
+            sigIn_ptr += add(lshr(j, 15), datastep);
         }
-        sigIn_ptr += add(lshr(j, 15), datastep);
     }
     /* rescaling */
     test();
@@ -12,11 +12,6 @@
  * Local functions
  *-----------------------------------------------------------------*/
 
-static void make_offset_scale_fx( Word16 j, const Word32 tab_no_cv[], const Word16 no_ld[],
-                                  Word16 no_scl, Word32 offset_scale[][MAX_NO_SCALES+1]);
-static void init_offset_fx( Word32 offset_scale1[][MAX_NO_SCALES+1], Word32 offset_scale2[][MAX_NO_SCALES+1],
-                            Word32 offset_scale1_p[][MAX_NO_SCALES+1], Word32 offset_scale2_p[][MAX_NO_SCALES+1],
-                            Word16 no_scales[][2], Word16 no_scales_p[][2]);
 static void decode_comb_fx(Word32 index,Word16 *cv,Word16 idx_lead);
 static void decode_sign_pc1_fx( Word16 *c, Word16 idx_sign, Word16 parity );
 static void put_value_fx(Word16 *cv, Word16 *p, Word16 val, Word16 dim, Word16 no_new_val);
@@ -24,8 +19,8 @@ static void decode_leaders_fx(Word16 index, Word16 idx_lead, Word16 *cv );
 static void idx2c_fx(Word16 n, Word16 *p, Word16 k, Word16 val );
 static void divide_64_32_fx(Word16 *xs,Word32 y, Word32 *result, Word32 *rem);
 static Word16
-decode_indexes_fx(Word16 * index,Word16 no_bits,const Word16 * p_scales, Word16 * p_no_scales,
-                  Word32 * p_offset_scale1, Word32 * p_offset_scale2,Word16 * x_lvq,Word16 mode_glb, Word16 *scales);
+decode_indexes_fx(Word16 * index,Word16 no_bits,const Word16 * p_scales, const Word16 * p_no_scales,
+                  const Word32 * p_offset_scale1, const Word32 * p_offset_scale2,Word16 * x_lvq,Word16 mode_glb, Word16 *scales);
 static Word32 divide_32_32_fx(Word32 y, Word32 x, Word32 * rem);
 static Word16 divide_16_16_fx(Word16 y, Word16 x, Word16 *rem);
 
@@ -69,127 +64,14 @@ void permute_fx(
 }
 
 
-void init_lvq_fx(
-    Word32 offset_scale1[][MAX_NO_SCALES+1],    /* o: lattice truncation index offset for the first LSF subvector - safety net structures*/
-    Word32 offset_scale2[][MAX_NO_SCALES+1],    /* o: lattice truncation index offset for the second LSF subvector - safety net structures*/
-    Word32 offset_scale1_p[][MAX_NO_SCALES+1],  /* o: lattice truncation index offset for the first LSF subvector - predictive structures*/
-    Word32 offset_scale2_p[][MAX_NO_SCALES+1],  /* o: lattice truncation index offset for the second LSF subvector - predictive structures*/
-    Word16 no_scales[][2],                      /* o: number of truncations for each LSF subvector at each MSLVQ structure - safety net  */
-    Word16 no_scales_p[][2]                     /* o: number of truncations for each LSF subvector at each MSLVQ structure - predictive  */
-)
-{
-    Word16 i, j;
-    /* safety-net mode */
-    FOR(i=0; i<MAX_NO_MODES; i++)
-    {
-        j=0;
-        move16();
-        test();
-        WHILE ((sub(j,MAX_NO_SCALES)<0) && (no_lead_fx[i][j] >0 ))
-        {
-            j++;
-        }
-        no_scales[i][0] = j;
-        move16();
-        j = MAX_NO_SCALES;
-        move16();
-        test();
-        WHILE ((sub(j,shl(MAX_NO_SCALES,1))<0) && (no_lead_fx[i][j] >0 ))
-        {
-            j++;
-        }
-        no_scales[i][1] = sub(j, MAX_NO_SCALES);
-        move16();
-    }
-    /* predictive mode */
-    FOR(i=0; i<MAX_NO_MODES_p; i++)
-    {
-        j=0;
-        move16();
-        WHILE ((sub(j,MAX_NO_SCALES)<0) && (no_lead_p_fx[i][j] >0 ))
-        {
-            j++;
-        }
-        no_scales_p[i][0] = j;
-        move16();
-        j = MAX_NO_SCALES;
-        move16();
-        WHILE ((sub(j, shl(MAX_NO_SCALES,1))<0) && (no_lead_p_fx[i][j] >0 ))
-        {
-            j++;
-        }
-        no_scales_p[i][1] = sub(j,MAX_NO_SCALES);
-        move16();
-    }
-    /* index offsets for each truncation */
-    init_offset_fx( offset_scale1, offset_scale2, offset_scale1_p, offset_scale2_p, no_scales, no_scales_p );
-}
-
-/* make_offset_scale_fx() - calculates scale offset values for a particular MSLVQ structure  */
-static
-void make_offset_scale_fx(
-    Word16 j,                             /* i: MSLVQ structure index */
-    const Word32 tab_no_cv[],             /* i: cummulated number of codevectors in each leader class */
-    const Word16 no_ld[],                 /* i: number of leaders in each truncation for the MSLVQ structure j*/
-    Word16 no_scl,                        /* i: number of truncations in the MSLVQ structure j */
-    Word32 offset_scale[][MAX_NO_SCALES+1]/* o: offset values */
-)
-{
-    Word16 i;
-
-    offset_scale[j][0] = L_deposit_l(1);
-    FOR( i=1; i<=no_scl; i++ )
-    {
-        offset_scale[j][i] = L_add(offset_scale[j][sub(i,1)], tab_no_cv[no_ld[sub(i,1)]]);
-        move32();
-    }
-
-    return;
-}
-
-void init_offset_fx(
-    Word32 offset_scale1[][MAX_NO_SCALES+1],  /* o: lattice truncation index offset for the first LSF subvector - safety net structures*/
-    Word32 offset_scale2[][MAX_NO_SCALES+1],  /* o: lattice truncation index offset for the second LSF subvector - safety net structures*/
-    Word32 offset_scale1_p[][MAX_NO_SCALES+1],/* o: lattice truncation index offset for the first LSF subvector - predictive structures*/
-    Word32 offset_scale2_p[][MAX_NO_SCALES+1],/* o: lattice truncation index offset for the second LSF subvector - predictive structures*/
-    Word16 no_scales[][2],                    /* i: number of truncations for each LSF subvector at each MSLVQ structure - safety net  */
-    Word16 no_scales_p[][2]                   /* i: number of truncations for each LSF subvector at each MSLVQ structure - predictive  */
-)
-{
-    Word16 j;
-    /* safety-net */
-    FOR( j=0; j<MAX_NO_MODES; j++ )
-    {
-        make_offset_scale_fx( j, table_no_cv_fx, no_lead_fx[j], no_scales[j][0], offset_scale1 );
-        make_offset_scale_fx( j, table_no_cv_fx, &no_lead_fx[j][MAX_NO_SCALES], no_scales[j][1], offset_scale2 );
-    }
-    /* predictive modes AR and MA */
-    FOR( j=0; j<MAX_NO_MODES_p; j++ )
-    {
-        make_offset_scale_fx(j, table_no_cv_fx, no_lead_p_fx[j], no_scales_p[j][0], offset_scale1_p);
-        make_offset_scale_fx(j, table_no_cv_fx, &no_lead_p_fx[j][MAX_NO_SCALES], no_scales_p[j][1], offset_scale2_p);
-    }
-
-    offset_scale1[MAX_NO_MODES][0] = 1;
-    move32();
-    offset_scale2[MAX_NO_MODES][0] = 1;
-    move32();
-    offset_scale1_p[MAX_NO_MODES_p][0] = 1;
-    move32();
-    offset_scale2_p[MAX_NO_MODES_p][0] = 1;
-    move32();
-
-    return;
-}
-
 static Word16
 decode_indexes_fx(
     Word16 * index,            /* i: LSF vector index, written as array of Word16 because it generally uses more than 16 bits */
     Word16 no_bits,            /* i: number of bits for the index */
     const Word16 * p_scales,   /* i: scale values for the MSLVQ structures */
-    Word16 * p_no_scales,      /* i: number of truncations for each MSLVQ structure */
-    Word32 * p_offset_scale1,  /* i: scale index offset for first LSF subvector */
-    Word32 * p_offset_scale2,  /* i: scale index offset for second LSF subvector */
+    const Word16 * p_no_scales,      /* i: number of truncations for each MSLVQ structure */
+    const Word32 * p_offset_scale1,  /* i: scale index offset for first LSF subvector */
+    const Word32 * p_offset_scale2,  /* i: scale index offset for second LSF subvector */
     Word16 * x_lvq,            /* o: decoded LSF vector in Q1 */
     Word16 mode_glb,           /* i: index of LSLVQ structure */
     Word16 * scales            /* o: scale values for the decoded MSLVQ LSF codevector */
@@ -328,9 +210,9 @@ Word16 deindex_lvq_fx(
     Word16 mode,                    /* i  : LVQ  coding mode/MSLVQ structure index (select scales & no_lead ), or idx_cv for CNG case */
     Word16 sf_flag,                 /* i  : safety net flag                                          */
     Word16 no_bits,                 /* i  : number of bits for lattice                               */
-    Word32 *p_offset_scale1,        /* i  : offset for first subvector                               */
-    Word32 *p_offset_scale2,        /* i  : offset for the second subvector                          */
-    Word16 *p_no_scales             /* i  : number of scales for each truncation and each MSLVQ structure */
+    const Word32 *p_offset_scale1,        /* i  : offset for first subvector                               */
+    const Word32 *p_offset_scale2,        /* i  : offset for the second subvector                          */
+    const Word16 *p_no_scales             /* i  : number of scales for each truncation and each MSLVQ structure */
 )
 {
     Word16 i;
@@ -422,9 +304,9 @@ Word16 deindex_lvq_cng_fx(
     Word16 *x_lvq,                   /* o: decoded codevector  Q9 */
     Word16 idx_cv,                   /* i: relative mode_lvq, wrt START_CNG */
     Word16 no_bits,                  /* i: number of bits for lattice */
-    Word32 * p_offset_scale1,        /* i: scale index offset for first LSF subvector */
-    Word32 * p_offset_scale2,        /* i: scale index offset for second LSF subvector */
-    Word16 * p_no_scales             /* i: number of scales for each MSLVQ structure and each subvector */
+    const Word32 * p_offset_scale1,        /* i: scale index offset for first LSF subvector */
+    const Word32 * p_offset_scale2,        /* i: scale index offset for second LSF subvector */
+    const Word16 * p_no_scales             /* i: number of scales for each MSLVQ structure and each subvector */
 )
 {
     Word16 i;
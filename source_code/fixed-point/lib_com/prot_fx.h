@@ -57,6 +57,10 @@ void calc_norm_envelop_fx_32(
     const Word16 st_offset                  /* i  : offset                 : Q0  */
 );
 
+void update_max_ind_fx(
+    Encoder_State_fx *st_fx                   /* i/o: encoder state structure */
+);
+
 void push_indice_fx(
     Encoder_State_fx *st_fx,                  /* i/o: encoder state structure */
     Word16 id,                        /* i  : ID of the indice */
@@ -93,7 +97,7 @@ void io_ini_enc_fx(
     FILE  **f_rate,            /* o  : bitrate switching profile (0 if N/A)      */
     FILE  **f_bwidth,          /* o  : bandwidth switching profile (0 if N/A)    */
     FILE  **f_rf,              /* o  : channel aware config profile (0 if N/A)   */
-    Word16 *quietMode,         /* o  : limit printouts                           */
+    Word16 *quietMode,         /* i/o: limit printouts, no information if set    */
     Word16 *noDelayCmp,        /* o  : turn off delay compensation               */
     Encoder_State_fx *st       /* o  : state structure                           */
 );
@@ -114,6 +118,15 @@ void read_next_brate_fx(
     Word16 *codec_mode                /* i/o: MODE1 or MODE2                            */
 );
 
+void set_next_brate_fx(
+    Word32  *total_brate,             /* o  : total bitrate                             */
+    const Word32 brate,               /* i  : requested bitrate                         */
+    Word32   input_Fs,                /* i  : input sampling frequency                  */
+    Word16 *Opt_AMR_WB,               /* o  : flag indicating AMR-WB IO mode            */
+    Word16 *Opt_SC_VBR,               /* o  : SC-VBR flag                               */
+    Word16 *codec_mode                /* o  : MODE1 or MODE2                            */
+);
+
 
 void read_next_bwidth_fx(
     Word16  *max_bwidth,            /* i/o: maximum encoded bandwidth                 */
@@ -265,12 +278,25 @@ void save_old_syn_fx(
     Word16 *mem_deemph                /* i/o: deemphasis filter memory    */
 );
 
-void evs_dec_fx(
+Word16 evs_dec_fx(
     Decoder_State_fx *st_fx,                /* i/o  : Decoder state structure        */
     Word16 output_sp[],                     /* o    : output synthesis signal */
     frameMode_fx frameMode                  /* i  : Decoder frame mode */
 );
 
+Word16 evs_dec_synth_fx(
+    Decoder_State_fx *st_fx,                /* i/o  : Decoder state structure        */
+    Word16 output_sp[],                     /* o    : output synthesis signal */
+    frameMode_fx frameMode,                 /* i  : Decoder frame mode */
+    DEC_FRAME_SYNTH *dsyn                   /* o  : frame synthesis before the HP filter */
+);
+
+void evs_dec_output_fx(
+    Decoder_State_fx *st_fx,                /* i/o  : Decoder state structure        */
+    Word16 output_sp[],                     /* o    : output synthesis signal */
+    DEC_FRAME_SYNTH *dsyn                   /* i/o: frame synthesis after the HP filter */
+);
+
 Word16 decodeVoip(
     Decoder_State_fx *st_fx,
     FILE *f_stream,
@@ -288,7 +314,7 @@ void io_ini_dec_fx(
     char *argv[],             /* i  : command line arguments                    */
     FILE **f_stream,          /* o  : input bitstream file                      */
     FILE **f_synth,           /* o  : output synthesis file                     */
-    Word16 *quietMode,             /* o  : limited printouts                         */
+    Word16 *quietMode,             /* i/o: limited printouts, no information if set  */
     Word16 *noDelayCmp,            /* o  : turn off delay compensation               */
     Decoder_State_fx *st_fx,           /* o  : Decoder static variables structure        */
 #ifdef SUPPORT_JBM_TRACEFILE
@@ -301,9 +327,9 @@ Word16 deindex_lvq_cng_fx(
     Word16 *x_lvq,                  /* o  : decoded codevector  Q9*/
     Word16 idx_cv,                  /* i  : relative mode_lvq, wrt START_CNG */
     Word16 no_bits,                 /* i  : number of bits for lattice */
-    Word32 * p_offset_scale1,
-    Word32 * p_offset_scale2,
-    Word16 * p_no_scales
+    const Word32 * p_offset_scale1,
+    const Word32 * p_offset_scale2,
+    const Word16 * p_no_scales
 );
 
 void CNG_dec_fx(
@@ -635,6 +661,17 @@ void init_encoder_fx(
 
 void destroy_encoder_fx( Encoder_State_fx *st_fx );
 
+void set_cmpl_profile_fx(
+    Encoder_State_fx *st_fx,      /* i/o: Encoder static variables structure            */
+    const Word16 profile          /* i  : complexity profile                            */
+);
+
+#if (FE_STATS)
+void fe_stats_print_fx(
+    const Encoder_State_fx *st_fx /* i  : Encoder static variables structure            */
+);
+#endif
+
 void analysisCldfbEncoder_fx(
     Encoder_State_fx *st_fx,              /* i/o: encoder state structure                    */
     const Word16 *timeIn,
@@ -1622,7 +1659,7 @@ void hq_pred_hb_bws_fx(
     const Word16 hqswb_clas,             /* i  : HQ SWB class                            */
     const Word16 *SWB_fenv               /* i  : SWB frequency envelopes             Q1  */
 );
-void hq_core_dec_fx(
+Word16 hq_core_dec_fx(
     Decoder_State_fx *st_fx,                /* i/o: decoder state structure fx         */
     Word16 synth[],                 /* o  : output synthesis                   */
     Word16 *Q_synth,                /* o  : Q value of synth                   */
@@ -2350,15 +2387,6 @@ void Copy_Scale_sig_32_16(
     const Word16 exp0   /* i  : exponent: x = round(x << exp)   Qx ?exp  */
 );
 
-void init_lvq_fx(
-    Word32 offset_scale1[][MAX_NO_SCALES+1],
-    Word32 offset_scale2[][MAX_NO_SCALES+1],
-    Word32 offset_scale1_p[][MAX_NO_SCALES+1],
-    Word32 offset_scale2_p[][MAX_NO_SCALES+1],
-    Word16 no_scales[][2],
-    Word16 no_scales_p[][2]
-);
-
 void hf_synth_reset_fx(
     Word16 *seed2,             /* i/o: random seed for HF noise gen    */
     Word16 mem_hf[],           /* o  : HF band-pass filter memory      */
@@ -2701,6 +2729,13 @@ Word32 Dot_product(         /* o  : Sum              */
     const Word16 lg         /* i  : vector length    */
 );
 
+Word32 Dot_product_mac(     /* o  : L_sum + <x,y>, as chained L_mac() */
+    const Word32 L_sum,     /* i  : initial accumulator               */
+    const Word16 x[],       /* i  : x vector                          */
+    const Word16 y[],       /* i  : y vector                          */
+    const Word16 lg         /* i  : vector length                     */
+);
+
 Word16 usquant_fx(          /* o: index of the winning codeword   */
     const Word16 x,         /* i: scalar value to quantize        Qx*/
     Word16 *xq,       /* o: quantized value                 Qx*/
@@ -3638,12 +3673,12 @@ Word16 vq_dec_lvq_fx (
     Word16 N,              /* i  : Vector dimension                          */
     Word16 mode,           /* (i): mode_lvq, or mode_lvq_p           */
     Word16 no_bits,        /* (i): no. bits for lattice             */
-    Word32 *p_offset_scale1,
-    Word32 *p_offset_scale2,
-    Word32 *p_offset_scale1_p,
-    Word32 *p_offset_scale2_p,
-    Word16 *p_no_scales,
-    Word16 *p_no_scales_p
+    const Word32 *p_offset_scale1,
+    const Word32 *p_offset_scale2,
+    const Word32 *p_offset_scale1_p,
+    const Word32 *p_offset_scale2_p,
+    const Word16 *p_no_scales,
+    const Word16 *p_no_scales_p
 );
 
 Word16 qlsf_ARSN_tcvq_Dec_16k_fx (
@@ -3687,9 +3722,9 @@ void index_lvq_fx (
     Word16   *idx_scale,            /* i  : scale index for each subvector */
     Word16   mode,                  /* i  : integer signalling the quantizer structure for the current bitrate */
     Word16 *index,                  /* o  : encoded index (represented on 3 short each with 15 bits ) */
-    Word32 * p_offset_scale1,
-    Word32 * p_offset_scale2,
-    Word16 * p_no_scales
+    const Word32 * p_offset_scale1,
+    const Word32 * p_offset_scale2,
+    const Word16 * p_no_scales
 );
 
 void multiply32_32_64_fx(
@@ -3713,7 +3748,7 @@ Word32 mslvq_fx (
     Word16 mode,                             /* i  : number indicating the coding type (V/UV/G...)*/
     Word16 mode_glb,                         /* i  : LVQ coding mode */
     Word16  pred_flag,                        /* i  : prediction flag (0: safety net, 1 - predictive )*/
-    Word16 no_scales[][2]
+    const Word16 no_scales[][2]
 );
 
 Word32 mslvq_cng_fx (
@@ -3724,7 +3759,7 @@ Word32 mslvq_cng_fx (
     Word16   *idx_lead,         /* o  : leader index for each 8-dim subvector               */
     Word16   *idx_scale,        /* o  : scale index for each subvector                   */
     const Word16 *w,            /* i  : weights for LSF quantization                   Q10*/
-    Word16 * no_scales
+    const Word16 * no_scales
 );
 
 void sort_fx(
@@ -3781,12 +3816,12 @@ void lsf_end_dec_fx(
     Word16 *mem_MA,
     const Word32 int_fs,
     Word32 core_brate,
-    Word32 *p_offset_scale1,
-    Word32 *p_offset_scale2,
-    Word32 *p_offset_scale1_p,
-    Word32 *p_offset_scale2_p,
-    Word16 *p_no_scales,
-    Word16 *p_no_scales_p,
+    const Word32 *p_offset_scale1,
+    const Word32 *p_offset_scale2,
+    const Word32 *p_offset_scale1_p,
+    const Word32 *p_offset_scale2_p,
+    const Word16 *p_no_scales,
+    const Word16 *p_no_scales_p,
     Word16 *safety_net,
     Word16 *lpc_param,
     Word16 *LSF_Q_prediction,  /* o  : LSF prediction mode                     */
@@ -4166,9 +4201,9 @@ Word16 deindex_lvq_fx(
     Word16 mode,                    /* i  : LVQ  coding mode (select scales & no_lead ), or idx_cv */
     Word16 sf_flag,                 /* i  : safety net flag                      */
     Word16 no_bits,                 /* i  : number of bits for lattice                */
-    Word32 *p_offset_scale1,     /* i  : offset for first subvector                */
-    Word32 *p_offset_scale2,       /* i  : offset for the second subvector              */
-    Word16 *p_no_scales
+    const Word32 *p_offset_scale1,     /* i  : offset for first subvector                */
+    const Word32 *p_offset_scale2,       /* i  : offset for the second subvector              */
+    const Word16 *p_no_scales
 );
 void Syn_filt_s(
     const Word16 shift,     /* i  : scaling to apply                          Q0   */
@@ -7155,6 +7190,12 @@ void IGFDecApplyMono(const IGF_DEC_INSTANCE_HANDLE                   hInstance,
                      Word16                                          bfi                 /**< in:     | frame loss == 1, frame good == 0                     */
                     );
 
+Word16 createIgfDec(IGF_DEC_INSTANCE_HANDLE                         *hIGFDec             /**< out:    | instance handle of IGF Decoder */
+                   );
+
+void deleteIgfDec(IGF_DEC_INSTANCE_HANDLE                           *hIGFDec             /**< in/out: | instance handle of IGF Decoder */
+                 );
+
 void IGFDecCopyLPCFlatSpectrum(const IGF_DEC_INSTANCE_HANDLE         hInstance,          /**< in:     | instance handle of IGF Decoder     */
                                const Word32                         *pSpectrumFlat,      /**< in: Q31 | LPC flattend spectrum from TCX dec */
                                const Word16                          pSpectrumFlat_exp,  /**< in:     | exponent of pSpectrumFlat          */
@@ -7597,7 +7638,8 @@ void E_ACELP_innovative_codebook(
     Word16 shift            /* i  : Scaling to get 12 bits                           */
     ,const Word16 L_frame,         /* i  : length of the frame                              */
     const Word16 last_L_frame,    /* i  : length of the last frame                         */
-    const Word32 total_brate      /* i  : total bit-rate                                   */
+    const Word32 total_brate,     /* i  : total bit-rate                                   */
+    const Word16 nbiter_max       /* i  : max. number of search iterations, 0 = not limited */
 );
 
 Word16 E_ACELP_code43bit(const Word16 code[], UWord32 *ps, Word16 *p, UWord16 idxs[]);
@@ -7665,6 +7707,12 @@ void hp20(Word16 signal[],     /* i/o: signal to filter                   any */
           /*      mem[4]: states scale                   */
           const Word32 sFreq);       /* i  : input sampling rate                 Q0 */
 
+void hp20_lanes_fx(Word16 *signal[],  /* i/o: signals to filter, one per lane          any */
+                   const Word16 lanes,      /* i  : number of lanes, up to DEC_LANES_MAX    Q0 */
+                   const Word16 lg,         /* i  : length of each signal (integer)         Q0 */
+                   Word32 *mem[],     /* i/o: static filter memory of each lane as in hp20() */
+                   const Word32 sFreq);     /* i  : input sampling rate                     Q0 */
+
 /* pit_fr4.c */
 void Mode2_pred_lt4(Word16 exc[],      /* in/out: excitation buffer */
                     Word16 T0,           /* input : integer pitch lag */
@@ -8110,9 +8158,9 @@ void phase_dispersion(
 void mdct_window_sine(const PWord16 **window, const Word16 n);
 
 void mdct_window_aldo(
-    Word16 *window1,
-    PWord16 *window1_trunc,
-    PWord16 *window2,
+    const Word16 **window1,
+    const PWord16 **window1_trunc,
+    const PWord16 **window2,
     Word16 n
 );
 
@@ -8248,6 +8296,17 @@ Word16 ACcontextMapping_encode2_estimate_no_mem_s17_LC(
     CONTEXT_HM_CONFIG *hm_cfg
 );
 
+Word16 ACcontextMapping_encode2_estimate_bounded_s17_LC(
+    const Word16 *x,
+    Word16 nt,
+    Word16 *lastnz,
+    Word16 *nEncoded,
+    Word16 target,
+    Word16 *stop,
+    CONTEXT_HM_CONFIG *hm_cfg,
+    Word16 max_bits
+);
+
 
 /* tcx_utils.h */
 
@@ -8404,7 +8463,8 @@ Word16 tcx_scalar_quantization_rateloop(
     Word16 sqBits_in,             /* i  : number of sqBits as determined in prev. quant. stage, using stop mechanism (ie always <= target bits) */
     Word16 tcxRateLoopOpt,        /* i  : turns on/off rateloop optimization */
     const Word8 tcxonly,
-    CONTEXT_HM_CONFIG *hm_cfg     /* i  : configuration of the context-based harmonic model */
+    CONTEXT_HM_CONFIG *hm_cfg,    /* i  : configuration of the context-based harmonic model */
+    const Word16 iter_max         /* i  : maximum number of iterations  */
 );
 
 /** Quantize gain.
@@ -8602,6 +8662,12 @@ Word16 ari_decode_14bits_s17_ext(
     UWord16 const *cum_freq
 );
 
+Word16 ari_decode_14bits_s17_LC(
+    Decoder_State_fx *st,
+    TastatDec *s,
+    Word16 pki
+);
+
 Word16 ari_decode_14bits_s27_ext(
     Decoder_State_fx *st,
     TastatDec *s,
@@ -9582,6 +9648,9 @@ void mhvals(Word16 d, Word16 * m/*, float * h*/);
 /* Random generator with Gaussian distribution with mean 0 and std 1 */
 Word32 rand_gauss (Word16 *seed);
 
+/* Block of consecutive rand_gauss() samples */
+void rand_gauss_vec (Word32 *x, Word16 n, Word16 *seed);
+
 void lpc_from_spectrum (Word32 *powspec,
                         Word16  powspec_exp,
                         Word16  start,
@@ -10435,8 +10504,8 @@ void update_decoder_LPD_cng(
 
 void reconfig_decoder_LPD( Decoder_State_fx *st, Word16 bits_frame, Word16 bandwidth_mode, Word32 bitrate, Word16 L_frame_old);
 
-void mode_switch_decoder_LPD( Decoder_State_fx *st, Word16 bandwidth_in, Word32 bitrate, Word16 frame_size_index
-                            );
+Word16 mode_switch_decoder_LPD( Decoder_State_fx *st, Word16 bandwidth_in, Word32 bitrate, Word16 frame_size_index
+                              );
 
 void decoder_LPD(
     Word16 signal_out[],   /* output: signal with LPD delay (7 subfrs) */
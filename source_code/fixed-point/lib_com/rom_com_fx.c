@@ -1255,6 +1255,200 @@ const Word32 table_no_cv_fx[] = { 0, 112, 240, 1360, 1376, 2400, 4192, 5536, 912
                                   ,0
                                 };
 
+/* Lattice truncation index offsets and number of truncations of each MSLVQ structure,
+ * derived from no_lead_fx[], no_lead_p_fx[] and table_no_cv_fx[] */
+const Word32 offset_scale1_fx[MAX_NO_MODES+1][MAX_NO_SCALES+1] =
+{
+    { 1, 113, 0, 0 },    { 1, 241, 0, 0 },    { 1, 1377, 1617, 0 },    { 1, 1377, 1617, 0 },
+    { 1, 5537, 7937, 8177 },    { 1, 9121, 18241, 19601 },    { 1, 1377, 1617, 0 },    { 1, 1377, 0, 0 },
+    { 1, 9377, 18497, 27617 },    { 1, 9121, 11521, 11761 },    { 1, 56881, 97633, 106753 },    { 1, 124529, 213217, 231553 },
+    { 1, 241, 0, 0 },    { 1, 1377, 1617, 0 },    { 1, 5537, 7937, 8177 },    { 1, 2401, 2641, 2753 },
+    { 1, 9121, 11521, 11761 },    { 1, 9121, 14657, 16033 },    { 1, 9121, 18241, 19617 },    { 1, 26641, 35761, 38161 },
+    { 1, 26641, 35761, 38161 },    { 1, 26641, 35761, 38161 },    { 1, 124529, 213217, 222337 },    { 1, 117361, 174241, 183361 },
+    { 1, 117361, 206049, 215169 },    { 1, 199921, 399841, 449553 },    { 1, 241, 0, 0 },    { 1, 1377, 1617, 0 },
+    { 1, 5537, 7937, 8177 },    { 1, 9121, 14657, 14897 },    { 1, 18449, 27569, 27809 },    { 1, 26641, 53281, 62657 },
+    { 1, 26641, 45089, 50625 },    { 1, 56881, 90689, 100065 },    { 1, 199921, 399841, 433649 },    { 1, 199921, 399841, 555729 },
+    { 1, 2401, 3777, 0 },    { 1, 241, 0, 0 },    { 1, 1377, 1617, 0 },    { 1, 2401, 3777, 0 },
+    { 1, 5537, 7937, 8177 },    { 1, 9121, 14657, 14897 },    { 1, 2401, 4801, 5041 },    { 1, 9121, 18241, 20641 },
+    { 1, 9121, 18241, 23777 },    { 1, 26641, 36017, 45137 },    { 1, 26641, 45089, 54209 },    { 1, 26641, 36017, 45137 },
+    { 1, 95857, 136609, 154945 },    { 1, 88689, 122497, 140833 },    { 1, 124529, 213217, 231553 },    { 1, 2401, 3777, 3889 },
+    { 1, 241, 0, 0 },    { 1, 2401, 3777, 3889 },    { 1, 2401, 3777, 3889 },    { 1, 5537, 7937, 8177 },
+    { 1, 9121, 11521, 11761 },    { 1, 9377, 18497, 20897 },    { 1, 33809, 60449, 69569 },    { 1, 26641, 35761, 41297 },
+    { 1, 26641, 36017, 45137 },    { 1, 56881, 83521, 92641 },    { 1, 88689, 115329, 133777 },    { 1, 95857, 184545, 211185 },
+    { 1, 117361, 206049, 255761 },    { 1, 155889, 273249, 361937 },    { 1, 241, 0, 0 },    { 1, 1377, 1617, 0 },
+    { 1, 1377, 1489, 0 },    { 1, 2401, 2641, 0 },    { 1, 9121, 11521, 11761 },    { 1, 9121, 11521, 11761 },
+    { 1, 33809, 52145, 54545 },    { 1, 33809, 52145, 54545 },    { 1, 26641, 44977, 47377 },    { 1, 117361, 206049, 215169 },
+    { 1, 117361, 174241, 176641 },    { 1, 241, 0, 0 },    { 1, 1377, 1617, 0 },    { 1, 5537, 7937, 8177 },
+    { 1, 9121, 14657, 16033 },    { 1, 18449, 27569, 29969 },    { 1, 56881, 66001, 68401 },    { 1, 40753, 49873, 52273 },
+    { 1, 159473, 276833, 285953 },    { 1, 199921, 399841, 408961 },    { 1, 56881, 113761, 132209 },    { 1, 124529, 241889, 268529 },
+    { 1, 124529, 241889, 268529 },    { 1, 274785, 474705, 531585 },    { 1, 241, 0, 0 },    { 1, 5537, 7937, 8177 },
+    { 1, 5537, 7937, 8177 },    { 1, 9377, 18497, 19857 },    { 1, 18449, 27825, 36945 },    { 1, 500497, 1000993, 1239921 },
+    { 1, 95857, 114193, 115553 },    { 1, 4193, 8385, 8625 },    { 1, 4193, 8385, 8625 },    { 1, 117361, 135697, 137057 },
+    { 1, 235761, 276513, 277873 },    { 1, 333153, 532049, 557665 },    { 1, 18449, 27825, 36945 },    { 1, 500497, 1000993, 1501489 },
+    { 1, 9121, 14657, 14897 },    { 1, 26641, 53281, 55681 },    { 1, 56881, 106593, 108993 },    { 1, 49713, 76353, 78753 },
+    { 1, 117361, 206049, 215169 },    { 1, 199921, 395233, 435985 },    { 1, 199921, 342369, 383121 },    { 1, 425233, 925729, 982609 },
+    { 1, 33809, 59425, 68801 },    { 1, 40529, 67169, 68529 },    { 1, 49713, 51073, 0 },    { 1, 26641, 44977, 46337 },
+    { 1, 33809, 60449, 69569 },    { 1, 5537, 6897, 0 },    { 1, 1377, 2737, 2977 },    { 1, 1377, 1617, 0 },
+    { 1, 1377, 1617, 0 },    { 1, 1377, 1617, 0 },    { 1, 4193, 5553, 0 },    { 1, 1361, 1601, 0 },
+    { 1, 241, 481, 0 },    { 1, 1377, 1617, 0 },    { 1, 1377, 2753, 2993 },    { 1, 1361, 1601, 0 },
+    { 1, 0, 0, 0 }
+};
+
+const Word32 offset_scale2_fx[MAX_NO_MODES+1][MAX_NO_SCALES+1] =
+{
+    { 1, 113, 0, 0 },    { 1, 113, 0, 0 },    { 1, 113, 0, 0 },    { 1, 241, 0, 0 },
+    { 1, 2401, 3777, 4017 },    { 1, 9121, 13313, 13553 },    { 1, 113, 0, 0 },    { 1, 241, 353, 0 },
+    { 1, 241, 481, 593 },    { 1, 2401, 2641, 2753 },    { 1, 2401, 4801, 4913 },    { 1, 9121, 18241, 18481 },
+    { 1, 241, 0, 0 },    { 1, 113, 0, 0 },    { 1, 241, 0, 0 },    { 1, 1377, 1489, 0 },
+    { 1, 2401, 2641, 0 },    { 1, 2401, 3761, 4001 },    { 1, 4193, 6593, 6833 },    { 1, 4193, 6593, 6833 },
+    { 1, 9121, 13313, 13553 },    { 1, 18449, 27569, 27809 },    { 1, 9377, 18497, 18737 },    { 1, 26641, 45089, 46449 },
+    { 1, 49713, 76353, 77729 },    { 1, 153201, 295649, 305025 },    { 1, 241, 481, 0 },    { 1, 113, 0, 0 },
+    { 1, 241, 481, 0 },    { 1, 241, 481, 0 },    { 1, 241, 481, 0 },    { 1, 241, 481, 0 },
+    { 1, 2401, 2641, 0 },    { 1, 2401, 4801, 5041 },    { 1, 18449, 36897, 39297 },    { 1, 124529, 213217, 247025 },
+    { 1, 0, 0, 0 },    { 1, 241, 0, 0 },    { 1, 241, 0, 0 },    { 1, 241, 0, 0 },
+    { 1, 241, 0, 0 },    { 1, 241, 0, 0 },    { 1, 1377, 1617, 0 },    { 1, 1377, 1617, 0 },
+    { 1, 2401, 2641, 0 },    { 1, 2401, 2641, 0 },    { 1, 2401, 4801, 4913 },    { 1, 9121, 11521, 11761 },
+    { 1, 4193, 6593, 6833 },    { 1, 9121, 14657, 14897 },    { 1, 9121, 18241, 18481 },    { 1, 0, 0, 0 },
+    { 1, 241, 0, 0 },    { 1, 113, 0, 0 },    { 1, 241, 0, 0 },    { 1, 241, 0, 0 },
+    { 1, 241, 353, 0 },    { 1, 241, 353, 0 },    { 1, 241, 481, 0 },    { 1, 1377, 1617, 0 },
+    { 1, 2401, 2641, 2881 },    { 1, 2401, 2641, 2881 },    { 1, 2401, 3761, 4001 },    { 1, 2401, 4801, 5041 },
+    { 1, 5537, 7937, 8177 },    { 1, 9121, 11521, 11761 },    { 1, 241, 0, 0 },    { 1, 113, 0, 0 },
+    { 1, 1377, 0, 0 },    { 1, 1377, 1489, 0 },    { 1, 1377, 0, 0 },    { 1, 2401, 2641, 0 },
+    { 1, 2401, 4801, 4913 },    { 1, 9121, 18241, 19617 },    { 1, 26641, 35761, 44881 },    { 1, 9121, 18241, 19617 },
+    { 1, 26641, 35761, 44881 },    { 1, 241, 481, 0 },    { 1, 113, 0, 0 },    { 1, 241, 481, 0 },
+    { 1, 241, 481, 0 },    { 1, 241, 481, 0 },    { 1, 241, 481, 0 },    { 1, 2401, 4801, 5041 },
+    { 1, 2401, 4801, 7201 },    { 1, 2401, 4801, 10337 },    { 1, 9377, 13569, 15969 },    { 1, 9377, 13569, 15969 },
+    { 1, 9377, 13569, 15969 },    { 1, 9377, 13569, 15969 },    { 1, 241, 481, 0 },    { 1, 241, 0, 0 },
+    { 1, 241, 481, 0 },    { 1, 1377, 1617, 0 },    { 1, 1377, 1617, 0 },    { 1, 26641, 45089, 54465 },
+    { 1, 0, 0, 0 },    { 1, 241, 0, 0 },    { 1, 241, 481, 0 },    { 1, 241, 481, 0 },
+    { 1, 241, 481, 0 },    { 1, 241, 481, 0 },    { 1, 1377, 1617, 0 },    { 1, 26641, 36017, 45137 },
+    { 1, 241, 0, 0 },    { 1, 2401, 4801, 0 },    { 1, 2401, 4801, 4913 },    { 1, 9121, 13313, 13553 },
+    { 1, 9377, 18497, 19857 },    { 1, 9121, 18241, 19601 },    { 1, 25617, 34737, 43857 },    { 1, 56881, 113761, 139377 },
+    { 1, 241, 481, 0 },    { 1, 241, 481, 0 },    { 1, 241, 481, 593 },    { 1, 241, 481, 721 },
+    { 1, 241, 481, 0 },    { 1, 2401, 3761, 3873 },    { 1, 4193, 8385, 10785 },    { 1, 9377, 18753, 20113 },
+    { 1, 9377, 18497, 18737 },    { 1, 9377, 14913, 19105 },    { 1, 4193, 5553, 5793 },    { 1, 9377, 18497, 20897 },
+    { 1, 40529, 41889, 43249 },    { 1, 9377, 18753, 20113 },    { 1, 5537, 9729, 11089 },    { 1, 9377, 14913, 19105 },
+    { 1, 0, 0, 0 }
+};
+
+const Word32 offset_scale1_p_fx[MAX_NO_MODES_p+1][MAX_NO_SCALES+1] =
+{
+    { 1, 241, 353, 0 },    { 1, 1377, 1617, 0 },    { 1, 2401, 4801, 5041 },    { 1, 9121, 11521, 11761 },
+    { 1, 9121, 18241, 20641 },    { 1, 26641, 45089, 47489 },    { 1, 18449, 36785, 39185 },    { 1, 33809, 60449, 62849 },
+    { 1, 40753, 67393, 69793 },    { 1, 88689, 177377, 179777 },    { 1, 124529, 213217, 215617 },    { 1, 235761, 353121, 355521 },
+    { 1, 274785, 474705, 483825 },    { 1, 425105, 699873, 740625 },    { 1, 425105, 699873, 740625 },    { 1, 241, 0, 0 },
+    { 1, 1377, 1617, 0 },    { 1, 9121, 14657, 14897 },    { 1, 26641, 45089, 47489 },    { 1, 9121, 18241, 20641 },
+    { 1, 26641, 45089, 47489 },    { 1, 26641, 45089, 47489 },    { 1, 33809, 60449, 62849 },    { 1, 117361, 206049, 208449 },
+    { 1, 117361, 174241, 176641 },    { 1, 124529, 213217, 215617 },    { 1, 423649, 790849, 817489 },    { 1, 423649, 698433, 725073 },
+    { 1, 423649, 763969, 790609 },    { 1, 423649, 833857, 860497 },    { 1, 241, 0, 0 },    { 1, 2401, 3777, 3889 },
+    { 1, 9121, 14657, 14897 },    { 1, 18337, 27713, 30113 },    { 1, 33809, 60449, 69569 },    { 1, 33809, 60449, 69569 },
+    { 1, 56881, 106593, 133233 },    { 1, 33809, 60449, 69569 },    { 1, 56881, 106593, 133233 },    { 1, 95857, 184545, 211185 },
+    { 1, 199921, 317281, 405969 },    { 1, 155889, 273249, 361937 },    { 1, 199921, 317281, 405969 },    { 1, 235761, 435681, 560209 },
+    { 1, 235761, 471521, 630993 },    { 1, 241, 0, 0 },    { 1, 2401, 3777, 4017 },    { 1, 9121, 11521, 11761 },
+    { 1, 9121, 14657, 14897 },    { 1, 26641, 45089, 45329 },    { 1, 40753, 67393, 67633 },    { 1, 88689, 138401, 138641 },
+    { 1, 26641, 52257, 52497 },    { 1, 56881, 97633, 97873 },    { 1, 117361, 206049, 206289 },    { 1, 235761, 395233, 395473 },
+    { 1, 311649, 511569, 511809 },    { 1, 236881, 436801, 437041 },    { 1, 410209, 610129, 610369 },    { 1, 410209, 610129, 610369 },
+    { 1, 5537, 7937, 8177 },    { 1, 9121, 18241, 20641 },    { 1, 26641, 35761, 38161 },    { 1, 26641, 35761, 38161 },
+    { 1, 26641, 35761, 38161 },    { 1, 500497, 1000993, 1501489 },    { 1, 5537, 7937, 8177 },    { 1, 26641, 53281, 62657 },
+    { 1, 56881, 113761, 123137 },    { 1, 124529, 241889, 260225 },    { 1, 199921, 399841, 425457 },    { 1, 423649, 662577, 688193 },
+    { 1, 26641, 35761, 38161 },    { 1, 500497, 1000993, 1426097 },    { 1, 241, 0, 0 },    { 1, 5537, 7937, 8177 },
+    { 1, 5537, 7937, 8177 },    { 1, 26641, 45089, 63425 },    { 1, 56881, 113761, 132097 },    { 1, 26641, 36017, 45393 },
+    { 1, 340321, 499793, 642241 },    { 1, 56881, 106593, 125041 },    { 1, 5537, 7937, 8177 },    { 1, 9121, 11521, 11761 },
+    { 1, 26641, 53281, 62657 },    { 1, 56881, 113761, 139377 },    { 1, 117361, 234721, 275473 },    { 1, 274785, 510545, 635073 },
+    { 1, 241, 481, 0 },    { 1, 5537, 7937, 8177 },    { 1, 9121, 11521, 11761 },    { 1, 26641, 53281, 62657 },
+    { 1, 56881, 106593, 133233 },    { 1, 117361, 213217, 262929 },    { 1, 238929, 474689, 599217 },    { 1, 1377, 1617, 0 },
+    { 1, 2401, 3777, 0 },    { 1, 9121, 14657, 14897 },    { 1, 18337, 27713, 30113 },    { 1, 40529, 67169, 69569 },
+    { 1, 56881, 97633, 106753 },    { 1, 410209, 645969, 845889 },    { 1, 113, 0, 0 },    { 1, 241, 0, 0 },
+    { 1, 1377, 1617, 0 },    { 1, 1377, 1617, 0 },    { 1, 2401, 3777, 0 },    { 1, 9121, 18241, 20641 },
+    { 1, 18449, 36785, 39185 },    { 1, 9377, 10737, 0 },    { 1, 56881, 83521, 101857 },    { 1, 124529, 181409, 199745 },
+    { 1, 235761, 378209, 396545 },    { 1, 410209, 610129, 628465 },    { 1, 423761, 659521, 815409 },    { 1, 423761, 659521, 801969 },
+    { 1, 500497, 833649, 1069409 },    { 1, 18449, 36785, 39185 },    { 1, 117361, 234721, 284433 },    { 1, 235761, 435681, 492561 },
+    { 1, 199921, 399841, 456721 },    { 1, 235761, 471521, 555729 },    { 1, 235761, 471521, 588881 },    { 1, 235761, 471521, 588881 },
+    { 1, 241, 0, 0 },    { 1, 5537, 7937, 8177 },    { 1, 33809, 60449, 69569 },    { 1, 9121, 18241, 20641 },
+    { 1, 18449, 36785, 39185 },    { 1, 40753, 67393, 76513 },    { 1, 26641, 53281, 62401 },    { 1, 117361, 174241, 200881 },
+    { 1, 117361, 234721, 261361 },    { 1, 117361, 234721, 284433 },    { 1, 235761, 435681, 560209 },    { 1, 410209, 645969, 845889 },
+    { 1, 340321, 576081, 771393 },    { 1, 340321, 576081, 776001 },    { 1, 367201, 602961, 802881 },    { 1, 18449, 36785, 39185 },
+    { 1, 117361, 234721, 284433 },    { 1, 199921, 399841, 456721 },    { 1, 500497, 736257, 860785 },    { 1, 500497, 736257, 895729 },
+    { 1, 500497, 776305, 1012065 },    { 1, 0, 0, 0 }
+};
+
+const Word32 offset_scale2_p_fx[MAX_NO_MODES_p+1][MAX_NO_SCALES+1] =
+{
+    { 1, 0, 0, 0 },    { 1, 241, 0, 0 },    { 1, 1377, 1617, 0 },    { 1, 1377, 0, 0 },
+    { 1, 1377, 1617, 0 },    { 1, 2401, 2641, 0 },    { 1, 4193, 6593, 6833 },    { 1, 5537, 7937, 8177 },
+    { 1, 9121, 14657, 14897 },    { 1, 9121, 11521, 11761 },    { 1, 9121, 18241, 19617 },    { 1, 26641, 45089, 47489 },
+    { 1, 40753, 67393, 69793 },    { 1, 56881, 83521, 85921 },    { 1, 311649, 511569, 520689 },    { 1, 0, 0, 0 },
+    { 1, 241, 0, 0 },    { 1, 241, 481, 0 },    { 1, 241, 353, 0 },    { 1, 1377, 1617, 0 },
+    { 1, 2401, 2641, 2753 },    { 1, 2401, 4801, 5041 },    { 1, 5537, 7937, 8177 },    { 1, 2401, 4801, 5041 },
+    { 1, 9121, 11521, 11761 },    { 1, 9121, 18241, 19617 },    { 1, 9377, 18497, 20897 },    { 1, 26641, 44977, 47377 },
+    { 1, 49713, 76353, 85729 },    { 1, 199921, 398817, 455697 },    { 1, 113, 0, 0 },    { 1, 113, 0, 0 },
+    { 1, 241, 0, 0 },    { 1, 241, 0, 0 },    { 1, 241, 0, 0 },    { 1, 241, 481, 0 },
+    { 1, 241, 481, 0 },    { 1, 2401, 3777, 0 },    { 1, 2401, 3777, 4017 },    { 1, 2401, 4801, 5041 },
+    { 1, 2401, 4801, 5041 },    { 1, 9121, 11521, 11761 },    { 1, 9377, 18497, 20897 },    { 1, 18449, 27569, 29969 },
+    { 1, 26641, 45089, 54209 },    { 1, 113, 0, 0 },    { 1, 113, 0, 0 },    { 1, 241, 353, 0 },
+    { 1, 241, 481, 0 },    { 1, 241, 353, 0 },    { 1, 241, 481, 0 },    { 1, 241, 481, 0 },
+    { 1, 2401, 4801, 5041 },    { 1, 2401, 4801, 5041 },    { 1, 2401, 4801, 5041 },    { 1, 2401, 4801, 5041 },
+    { 1, 5537, 7937, 8177 },    { 1, 9121, 18241, 19617 },    { 1, 9377, 18753, 27873 },    { 1, 26641, 45089, 54465 },
+    { 1, 241, 0, 0 },    { 1, 1377, 1617, 0 },    { 1, 1377, 1617, 0 },    { 1, 9121, 13313, 13553 },
+    { 1, 9377, 18497, 20897 },    { 1, 274785, 549569, 709041 },    { 1, 241, 0, 0 },    { 1, 241, 481, 0 },
+    { 1, 241, 481, 0 },    { 1, 2401, 3777, 4017 },    { 1, 2401, 4801, 5041 },    { 1, 2401, 4801, 6177 },
+    { 1, 9377, 18497, 20897 },    { 1, 425105, 625025, 767473 },    { 1, 241, 481, 0 },    { 1, 241, 0, 0 },
+    { 1, 241, 481, 0 },    { 1, 241, 481, 0 },    { 1, 241, 481, 0 },    { 1, 2401, 2641, 0 },
+    { 1, 56881, 106593, 106833 },    { 1, 0, 0, 0 },    { 1, 241, 0, 0 },    { 1, 241, 353, 0 },
+    { 1, 241, 481, 0 },    { 1, 241, 481, 0 },    { 1, 241, 481, 0 },    { 1, 49713, 76353, 102993 },
+    { 1, 241, 0, 0 },    { 1, 241, 0, 0 },    { 1, 241, 353, 0 },    { 1, 241, 481, 0 },
+    { 1, 241, 481, 0 },    { 1, 241, 481, 0 },    { 1, 40753, 81505, 108145 },    { 1, 113, 0, 0 },
+    { 1, 113, 0, 0 },    { 1, 241, 0, 0 },    { 1, 241, 0, 0 },    { 1, 241, 0, 0 },
+    { 1, 2401, 4801, 4913 },    { 1, 2401, 4801, 5041 },    { 1, 113, 0, 0 },    { 1, 113, 0, 0 },
+    { 1, 113, 0, 0 },    { 1, 241, 0, 0 },    { 1, 241, 0, 0 },    { 1, 1377, 1617, 0 },
+    { 1, 4193, 6593, 6833 },    { 1, 1377, 0, 0 },    { 1, 9121, 10481, 0 },    { 1, 9377, 10737, 0 },
+    { 1, 9377, 10737, 0 },    { 1, 25617, 26977, 27217 },    { 1, 40529, 41889, 42129 },    { 1, 83761, 85121, 85361 },
+    { 1, 274769, 315297, 316657 },    { 1, 1377, 1617, 0 },    { 1, 9121, 14657, 14897 },    { 1, 9377, 14913, 17313 },
+    { 1, 18449, 27825, 36945 },    { 1, 26641, 52257, 61377 },    { 1, 56881, 106593, 115713 },    { 1, 117361, 213217, 231553 },
+    { 1, 241, 0, 0 },    { 1, 241, 0, 0 },    { 1, 241, 0, 0 },    { 1, 1377, 1617, 0 },
+    { 1, 1377, 1617, 0 },    { 1, 1377, 1617, 0 },    { 1, 2401, 3777, 4017 },    { 1, 2401, 4801, 5041 },
+    { 1, 5537, 7937, 8177 },    { 1, 9121, 14657, 14897 },    { 1, 9121, 14657, 14897 },    { 1, 9377, 18753, 20129 },
+    { 1, 25617, 34993, 44369 },    { 1, 49713, 68161, 86609 },    { 1, 84209, 141089, 167729 },    { 1, 1377, 1617, 0 },
+    { 1, 9121, 14657, 14897 },    { 1, 9377, 18497, 18737 },    { 1, 9377, 18497, 19857 },    { 1, 18449, 36785, 38145 },
+    { 1, 40753, 66369, 67745 },    { 1, 0, 0, 0 }
+};
+
+const Word16 no_scales_fx[MAX_NO_MODES][2] =
+{
+    {1,1}, {1,1}, {2,1}, {2,1}, {3,3}, {3,3}, {2,1}, {1,2}, {3,3}, {3,3},
+    {3,3}, {3,3}, {1,1}, {2,1}, {3,1}, {3,2}, {3,2}, {3,3}, {3,3}, {3,3},
+    {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {1,2}, {2,1}, {3,2}, {3,2},
+    {3,2}, {3,2}, {3,2}, {3,3}, {3,3}, {3,3}, {2,0}, {1,1}, {2,1}, {2,1},
+    {3,1}, {3,1}, {3,2}, {3,2}, {3,2}, {3,2}, {3,3}, {3,3}, {3,3}, {3,3},
+    {3,3}, {3,0}, {1,1}, {3,1}, {3,1}, {3,1}, {3,2}, {3,2}, {3,2}, {3,2},
+    {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {1,1}, {2,1}, {2,1}, {2,2},
+    {3,1}, {3,2}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {1,2}, {2,1}, {3,2},
+    {3,2}, {3,2}, {3,2}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3},
+    {1,2}, {3,1}, {3,2}, {3,2}, {3,2}, {3,3}, {3,0}, {3,1}, {3,2}, {3,2},
+    {3,2}, {3,2}, {3,2}, {3,3}, {3,1}, {3,2}, {3,3}, {3,3}, {3,3}, {3,3},
+    {3,3}, {3,3}, {3,2}, {3,2}, {2,3}, {3,3}, {3,2}, {2,3}, {3,3}, {2,3},
+    {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {2,3}, {3,3}, {2,3}
+};
+
+const Word16 no_scales_p_fx[MAX_NO_MODES_p][2] =
+{
+    {2,0}, {2,1}, {3,2}, {3,1}, {3,2}, {3,2}, {3,3}, {3,3}, {3,3}, {3,3},
+    {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {1,0}, {2,1}, {3,2}, {3,2}, {3,2},
+    {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3},
+    {1,1}, {3,1}, {3,1}, {3,1}, {3,1}, {3,2}, {3,2}, {3,2}, {3,3}, {3,3},
+    {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {1,1}, {3,1}, {3,2}, {3,2}, {3,2},
+    {3,2}, {3,2}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3},
+    {3,1}, {3,2}, {3,2}, {3,3}, {3,3}, {3,3}, {3,1}, {3,2}, {3,2}, {3,3},
+    {3,3}, {3,3}, {3,3}, {3,3}, {1,2}, {3,1}, {3,2}, {3,2}, {3,2}, {3,2},
+    {3,3}, {3,0}, {3,1}, {3,2}, {3,2}, {3,2}, {3,2}, {3,3}, {2,1}, {3,1},
+    {3,2}, {3,2}, {3,2}, {3,2}, {3,3}, {2,1}, {2,1}, {3,1}, {3,1}, {3,1},
+    {3,3}, {3,3}, {1,1}, {1,1}, {2,1}, {2,1}, {2,1}, {3,2}, {3,3}, {2,1},
+    {3,2}, {3,2}, {3,2}, {3,3}, {3,3}, {3,3}, {3,3}, {3,2}, {3,3}, {3,3},
+    {3,3}, {3,3}, {3,3}, {3,3}, {1,1}, {3,1}, {3,1}, {3,2}, {3,2}, {3,2},
+    {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,3}, {3,2},
+    {3,3}, {3,3}, {3,3}, {3,3}, {3,3}
+};
+
 
 
 /* Innovative codebook config */
@@ -12559,6 +12753,415 @@ const Word16 window_256kHz[592] = /*ALDO at 25.6 maybe not needed ?*/
     2139, 1888, 1635, 1379, 1119, 854, 583, 304
 };
 
+/* ALDO analysis window slopes per frame length (first part, truncated first part
+ * and second part), decimated from window_48kHz_fx[], window_256kHz[] and
+ * window_8_16_32kHz_fx[]; selected by mdct_window_aldo() */
+const Word16 window_aldo_1_160_fx[45] =
+{
+         2,    17,    46,    88,   144,   212,   293,   387,   493,   612,
+       743,   885,  1040,  1206,  1384,  1573,  1773,  1984,  2206,  2438,
+      2681,  2934,  3196,  3469,  3751,  4043,  4343,  4653,  4971,  5297,
+      5631,  5974,  6323,  6680,  7045,  7416,  7793,  8177,  8566,  8961,
+      9362,  9768, 10178, 10593, 11012
+};
+
+const PWord16 window_aldo_1_trunc_160_fx[35] =
+{
+    {{ 32685, 11406 }}, {{ 32530, 11778 }}, {{ 32373, 12154 }}, {{ 32213, 12532 }}, {{ 32048, 12912 }},
+    {{ 31879, 13294 }}, {{ 31704, 13677 }}, {{ 31523, 14061 }}, {{ 31337, 14446 }}, {{ 31145, 14832 }},
+    {{ 30948, 15218 }}, {{ 30744, 15604 }}, {{ 30535, 15990 }}, {{ 30319, 16376 }}, {{ 30098, 16762 }},
+    {{ 29871, 17147 }}, {{ 29638, 17532 }}, {{ 29399, 17915 }}, {{ 29154, 18297 }}, {{ 28903, 18678 }},
+    {{ 28646, 19057 }}, {{ 28384, 19434 }}, {{ 28116, 19810 }}, {{ 27842, 20183 }}, {{ 27563, 20554 }},
+    {{ 27278, 20923 }}, {{ 26988, 21289 }}, {{ 26693, 21652 }}, {{ 26393, 22012 }}, {{ 26087, 22368 }},
+    {{ 25777, 22722 }}, {{ 25461, 23071 }}, {{ 25141, 23418 }}, {{ 24817, 23760 }}, {{ 24488, 24098 }}
+};
+
+const PWord16 window_aldo_2_160_fx[35] =
+{
+    {{ 32685,   474 }}, {{ 32527,  1330 }}, {{ 32363,  2142 }}, {{ 32193,  2929 }}, {{ 32015,  3696 }},
+    {{ 31828,  4447 }}, {{ 31632,  5183 }}, {{ 31428,  5906 }}, {{ 31214,  6617 }}, {{ 30991,  7317 }},
+    {{ 30759,  8006 }}, {{ 30517,  8684 }}, {{ 30266,  9353 }}, {{ 30006, 10013 }}, {{ 29737, 10663 }},
+    {{ 29457, 11304 }}, {{ 29169, 11936 }}, {{ 28871, 12559 }}, {{ 28563, 13173 }}, {{ 28246, 13778 }},
+    {{ 27920, 14375 }}, {{ 27584, 14964 }}, {{ 27238, 15543 }}, {{ 26884, 16114 }}, {{ 26520, 16677 }},
+    {{ 26146, 17231 }}, {{ 25763, 17776 }}, {{ 25371, 18313 }}, {{ 24970, 18841 }}, {{ 24559, 19360 }},
+    {{ 24140, 19871 }}, {{ 23711, 20373 }}, {{ 23273, 20866 }}, {{ 22826, 21351 }}, {{ 22370, 21826 }}
+};
+
+const Word16 window_aldo_1_256_fx[72] =
+{
+         1,     7,    19,    36,    58,    86,   119,   157,   201,   249,
+       302,   361,   424,   492,   564,   642,   724,   811,   903,   999,
+      1100,  1205,  1315,  1430,  1548,  1671,  1799,  1931,  2066,  2207,
+      2351,  2499,  2651,  2808,  2968,  3132,  3300,  3472,  3647,  3826,
+      4009,  4195,  4385,  4578,  4774,  4974,  5177,  5384,  5593,  5806,
+      6021,  6240,  6461,  6685,  6912,  7141,  7373,  7608,  7845,  8085,
+      8327,  8571,  8817,  9066,  9316,  9569,  9823, 10079, 10337, 10597,
+     10858, 11121
+};
+
+const PWord16 window_aldo_1_trunc_256_fx[56] =
+{
+    {{ 32715, 11367 }}, {{ 32617, 11598 }}, {{ 32520, 11831 }}, {{ 32422, 12065 }}, {{ 32323, 12300 }},
+    {{ 32222, 12536 }}, {{ 32120, 12772 }}, {{ 32016, 13010 }}, {{ 31909, 13248 }}, {{ 31801, 13486 }},
+    {{ 31691, 13725 }}, {{ 31579, 13964 }}, {{ 31464, 14203 }}, {{ 31347, 14443 }}, {{ 31228, 14683 }},
+    {{ 31107, 14924 }}, {{ 30984, 15164 }}, {{ 30858, 15405 }}, {{ 30730, 15645 }}, {{ 30600, 15885 }},
+    {{ 30467, 16126 }}, {{ 30333, 16366 }}, {{ 30196, 16606 }}, {{ 30056, 16846 }}, {{ 29915, 17086 }},
+    {{ 29771, 17325 }}, {{ 29624, 17564 }}, {{ 29476, 17803 }}, {{ 29325, 18041 }}, {{ 29172, 18279 }},
+    {{ 29017, 18516 }}, {{ 28859, 18753 }}, {{ 28699, 18988 }}, {{ 28537, 19224 }}, {{ 28373, 19458 }},
+    {{ 28207, 19692 }}, {{ 28038, 19925 }}, {{ 27868, 20157 }}, {{ 27695, 20388 }}, {{ 27520, 20618 }},
+    {{ 27343, 20848 }}, {{ 27164, 21076 }}, {{ 26982, 21303 }}, {{ 26799, 21529 }}, {{ 26614, 21754 }},
+    {{ 26427, 21978 }}, {{ 26238, 22200 }}, {{ 26047, 22421 }}, {{ 25854, 22641 }}, {{ 25659, 22860 }},
+    {{ 25462, 23077 }}, {{ 25263, 23293 }}, {{ 25063, 23507 }}, {{ 24861, 23719 }}, {{ 24657, 23931 }},
+    {{ 24452, 24140 }}
+};
+
+const PWord16 window_aldo_2_256_fx[56] =
+{
+    {{ 32715,   304 }}, {{ 32616,   854 }}, {{ 32517,  1379 }}, {{ 32415,  1888 }}, {{ 32311,  2387 }},
+    {{ 32204,  2876 }}, {{ 32094,  3358 }}, {{ 31981,  3832 }}, {{ 31864,  4301 }}, {{ 31744,  4764 }},
+    {{ 31621,  5221 }}, {{ 31494,  5673 }}, {{ 31363,  6121 }}, {{ 31229,  6563 }}, {{ 31091,  7002 }},
+    {{ 30950,  7436 }}, {{ 30805,  7866 }}, {{ 30657,  8292 }}, {{ 30505,  8714 }}, {{ 30349,  9132 }},
+    {{ 30189,  9547 }}, {{ 30026,  9957 }}, {{ 29860, 10364 }}, {{ 29689, 10768 }}, {{ 29515, 11168 }},
+    {{ 29337, 11564 }}, {{ 29156, 11957 }}, {{ 28971, 12346 }}, {{ 28782, 12732 }}, {{ 28590, 13115 }},
+    {{ 28394, 13494 }}, {{ 28194, 13869 }}, {{ 27991, 14242 }}, {{ 27784, 14611 }}, {{ 27573, 14976 }},
+    {{ 27358, 15339 }}, {{ 27140, 15698 }}, {{ 26919, 16053 }}, {{ 26693, 16405 }}, {{ 26464, 16754 }},
+    {{ 26232, 17100 }}, {{ 25996, 17442 }}, {{ 25756, 17781 }}, {{ 25512, 18116 }}, {{ 25265, 18448 }},
+    {{ 25015, 18777 }}, {{ 24761, 19103 }}, {{ 24503, 19425 }}, {{ 24242, 19743 }}, {{ 23977, 20059 }},
+    {{ 23708, 20370 }}, {{ 23436, 20679 }}, {{ 23161, 20984 }}, {{ 22882, 21285 }}, {{ 22599, 21583 }},
+    {{ 22313, 21878 }}
+};
+
+const Word16 window_aldo_1_320_fx[90] =
+{
+         1,     5,    13,    25,    40,    58,    80,   105,   133,   165,
+       200,   238,   279,   323,   371,   421,   475,   532,   591,   654,
+       720,   789,   861,   936,  1013,  1094,  1178,  1264,  1353,  1445,
+      1540,  1638,  1739,  1842,  1948,  2057,  2168,  2282,  2399,  2518,
+      2640,  2764,  2891,  3020,  3152,  3286,  3423,  3562,  3704,  3847,
+      3994,  4142,  4293,  4445,  4600,  4758,  4917,  5078,  5242,  5407,
+      5575,  5744,  5916,  6089,  6265,  6442,  6620,  6801,  6983,  7168,
+      7353,  7541,  7730,  7920,  8112,  8306,  8501,  8697,  8895,  9094,
+      9295,  9497,  9700,  9904, 10109, 10316, 10523, 10732, 10941, 11152
+};
+
+const PWord16 window_aldo_1_trunc_320_fx[70] =
+{
+    {{ 32712, 11344 }}, {{ 32633, 11529 }}, {{ 32556, 11716 }}, {{ 32478, 11903 }}, {{ 32399, 12091 }},
+    {{ 32320, 12280 }}, {{ 32240, 12469 }}, {{ 32159, 12658 }}, {{ 32076, 12849 }}, {{ 31992, 13039 }},
+    {{ 31907, 13230 }}, {{ 31821, 13421 }}, {{ 31733, 13613 }}, {{ 31644, 13805 }}, {{ 31554, 13997 }},
+    {{ 31462, 14189 }}, {{ 31369, 14382 }}, {{ 31274, 14574 }}, {{ 31178, 14767 }}, {{ 31080, 14960 }},
+    {{ 30981, 15153 }}, {{ 30881, 15346 }}, {{ 30779, 15540 }}, {{ 30675, 15733 }}, {{ 30570, 15926 }},
+    {{ 30464, 16119 }}, {{ 30356, 16312 }}, {{ 30246, 16505 }}, {{ 30135, 16698 }}, {{ 30023, 16891 }},
+    {{ 29909, 17083 }}, {{ 29794, 17275 }}, {{ 29677, 17468 }}, {{ 29559, 17659 }}, {{ 29439, 17851 }},
+    {{ 29318, 18042 }}, {{ 29195, 18233 }}, {{ 29071, 18424 }}, {{ 28945, 18614 }}, {{ 28818, 18804 }},
+    {{ 28689, 18994 }}, {{ 28559, 19183 }}, {{ 28428, 19372 }}, {{ 28295, 19560 }}, {{ 28161, 19748 }},
+    {{ 28025, 19935 }}, {{ 27888, 20121 }}, {{ 27750, 20307 }}, {{ 27610, 20493 }}, {{ 27469, 20677 }},
+    {{ 27326, 20862 }}, {{ 27182, 21045 }}, {{ 27037, 21228 }}, {{ 26890, 21410 }}, {{ 26743, 21591 }},
+    {{ 26593, 21772 }}, {{ 26443, 21952 }}, {{ 26291, 22131 }}, {{ 26138, 22309 }}, {{ 25984, 22486 }},
+    {{ 25829, 22663 }}, {{ 25672, 22839 }}, {{ 25514, 23013 }}, {{ 25355, 23187 }}, {{ 25195, 23360 }},
+    {{ 25034, 23532 }}, {{ 24871, 23703 }}, {{ 24707, 23873 }}, {{ 24543, 24042 }}, {{ 24377, 24210 }}
+};
+
+const PWord16 window_aldo_2_320_fx[70] =
+{
+    {{ 32712,   324 }}, {{ 32633,   766 }}, {{ 32553,  1191 }}, {{ 32473,  1604 }}, {{ 32391,  2009 }},
+    {{ 32307,  2407 }}, {{ 32222,  2800 }}, {{ 32134,  3187 }}, {{ 32045,  3570 }}, {{ 31953,  3948 }},
+    {{ 31859,  4323 }}, {{ 31764,  4694 }}, {{ 31665,  5061 }}, {{ 31565,  5425 }}, {{ 31462,  5786 }},
+    {{ 31357,  6144 }}, {{ 31250,  6499 }}, {{ 31141,  6851 }}, {{ 31029,  7201 }}, {{ 30915,  7547 }},
+    {{ 30798,  7892 }}, {{ 30679,  8233 }}, {{ 30558,  8572 }}, {{ 30435,  8908 }}, {{ 30309,  9243 }},
+    {{ 30181,  9574 }}, {{ 30050,  9904 }}, {{ 29917, 10230 }}, {{ 29782, 10555 }}, {{ 29645, 10877 }},
+    {{ 29505, 11197 }}, {{ 29362, 11515 }}, {{ 29218, 11831 }}, {{ 29070, 12144 }}, {{ 28921, 12455 }},
+    {{ 28769, 12764 }}, {{ 28615, 13071 }}, {{ 28459, 13376 }}, {{ 28300, 13678 }}, {{ 28138, 13978 }},
+    {{ 27975, 14276 }}, {{ 27809, 14572 }}, {{ 27640, 14866 }}, {{ 27470, 15158 }}, {{ 27297, 15447 }},
+    {{ 27121, 15735 }}, {{ 26944, 16020 }}, {{ 26763, 16303 }}, {{ 26581, 16584 }}, {{ 26396, 16863 }},
+    {{ 26209, 17139 }}, {{ 26020, 17414 }}, {{ 25828, 17686 }}, {{ 25634, 17956 }}, {{ 25437, 18224 }},
+    {{ 25239, 18490 }}, {{ 25037, 18754 }}, {{ 24834, 19015 }}, {{ 24628, 19274 }}, {{ 24420, 19532 }},
+    {{ 24210, 19787 }}, {{ 23998, 20039 }}, {{ 23783, 20290 }}, {{ 23566, 20538 }}, {{ 23346, 20785 }},
+    {{ 23125, 21029 }}, {{ 22901, 21271 }}, {{ 22675, 21510 }}, {{ 22446, 21747 }}, {{ 22215, 21983 }}
+};
+
+const Word16 window_aldo_1_512_fx[144] =
+{
+         1,     3,     7,    12,    19,    27,    36,    47,    58,    72,
+        86,   102,   119,   138,   157,   178,   201,   224,   249,   275,
+       302,   331,   361,   391,   424,   457,   492,   527,   564,   603,
+       642,   683,   724,   767,   811,   857,   903,   951,   999,  1049,
+      1100,  1152,  1205,  1260,  1315,  1372,  1430,  1488,  1548,  1609,
+      1671,  1735,  1799,  1864,  1931,  1998,  2066,  2136,  2207,  2278,
+      2351,  2424,  2499,  2575,  2651,  2729,  2808,  2887,  2968,  3049,
+      3132,  3215,  3300,  3385,  3472,  3559,  3647,  3736,  3826,  3917,
+      4009,  4101,  4195,  4289,  4385,  4481,  4578,  4676,  4774,  4874,
+      4974,  5075,  5177,  5280,  5384,  5488,  5593,  5699,  5806,  5913,
+      6021,  6130,  6240,  6350,  6461,  6573,  6685,  6798,  6912,  7026,
+      7141,  7257,  7373,  7491,  7608,  7726,  7845,  7965,  8085,  8206,
+      8327,  8449,  8571,  8694,  8817,  8941,  9066,  9191,  9316,  9442,
+      9569,  9696,  9823,  9951, 10079, 10208, 10337, 10467, 10597, 10727,
+     10858, 10990, 11121, 11253
+};
+
+const PWord16 window_aldo_1_trunc_512_fx[112] =
+{
+    {{ 32715, 11367 }}, {{ 32666, 11482 }}, {{ 32617, 11598 }}, {{ 32568, 11714 }}, {{ 32520, 11831 }},
+    {{ 32471, 11948 }}, {{ 32422, 12065 }}, {{ 32372, 12182 }}, {{ 32323, 12300 }}, {{ 32273, 12418 }},
+    {{ 32222, 12536 }}, {{ 32171, 12654 }}, {{ 32120, 12772 }}, {{ 32068, 12891 }}, {{ 32016, 13010 }},
+    {{ 31963, 13129 }}, {{ 31909, 13248 }}, {{ 31856, 13367 }}, {{ 31801, 13486 }}, {{ 31746, 13605 }},
+    {{ 31691, 13725 }}, {{ 31635, 13844 }}, {{ 31579, 13964 }}, {{ 31522, 14084 }}, {{ 31464, 14203 }},
+    {{ 31406, 14323 }}, {{ 31347, 14443 }}, {{ 31288, 14563 }}, {{ 31228, 14683 }}, {{ 31168, 14804 }},
+    {{ 31107, 14924 }}, {{ 31046, 15044 }}, {{ 30984, 15164 }}, {{ 30921, 15284 }}, {{ 30858, 15405 }},
+    {{ 30794, 15525 }}, {{ 30730, 15645 }}, {{ 30665, 15765 }}, {{ 30600, 15885 }}, {{ 30534, 16006 }},
+    {{ 30467, 16126 }}, {{ 30400, 16246 }}, {{ 30333, 16366 }}, {{ 30264, 16486 }}, {{ 30196, 16606 }},
+    {{ 30126, 16726 }}, {{ 30056, 16846 }}, {{ 29986, 16966 }}, {{ 29915, 17086 }}, {{ 29843, 17206 }},
+    {{ 29771, 17325 }}, {{ 29698, 17445 }}, {{ 29624, 17564 }}, {{ 29550, 17684 }}, {{ 29476, 17803 }},
+    {{ 29401, 17922 }}, {{ 29325, 18041 }}, {{ 29249, 18160 }}, {{ 29172, 18279 }}, {{ 29095, 18397 }},
+    {{ 29017, 18516 }}, {{ 28938, 18634 }}, {{ 28859, 18753 }}, {{ 28780, 18871 }}, {{ 28699, 18988 }},
+    {{ 28619, 19106 }}, {{ 28537, 19224 }}, {{ 28456, 19341 }}, {{ 28373, 19458 }}, {{ 28290, 19575 }},
+    {{ 28207, 19692 }}, {{ 28123, 19809 }}, {{ 28038, 19925 }}, {{ 27953, 20041 }}, {{ 27868, 20157 }},
+    {{ 27781, 20273 }}, {{ 27695, 20388 }}, {{ 27608, 20503 }}, {{ 27520, 20618 }}, {{ 27432, 20733 }},
+    {{ 27343, 20848 }}, {{ 27253, 20962 }}, {{ 27164, 21076 }}, {{ 27073, 21190 }}, {{ 26982, 21303 }},
+    {{ 26891, 21416 }}, {{ 26799, 21529 }}, {{ 26707, 21642 }}, {{ 26614, 21754 }}, {{ 26521, 21866 }},
+    {{ 26427, 21978 }}, {{ 26333, 22089 }}, {{ 26238, 22200 }}, {{ 26142, 22311 }}, {{ 26047, 22421 }},
+    {{ 25950, 22531 }}, {{ 25854, 22641 }}, {{ 25756, 22751 }}, {{ 25659, 22860 }}, {{ 25561, 22968 }},
+    {{ 25462, 23077 }}, {{ 25363, 23185 }}, {{ 25263, 23293 }}, {{ 25163, 23400 }}, {{ 25063, 23507 }},
+    {{ 24962, 23613 }}, {{ 24861, 23719 }}, {{ 24759, 23825 }}, {{ 24657, 23931 }}, {{ 24555, 24036 }},
+    {{ 24452, 24140 }}, {{ 24348, 24244 }}
+};
+
+const PWord16 window_aldo_2_512_fx[112] =
+{
+    {{ 32715,   304 }}, {{ 32666,   583 }}, {{ 32616,   854 }}, {{ 32567,  1119 }}, {{ 32517,  1379 }},
+    {{ 32466,  1635 }}, {{ 32415,  1888 }}, {{ 32364,  2139 }}, {{ 32311,  2387 }}, {{ 32258,  2632 }},
+    {{ 32204,  2876 }}, {{ 32150,  3118 }}, {{ 32094,  3358 }}, {{ 32038,  3596 }}, {{ 31981,  3832 }},
+    {{ 31923,  4067 }}, {{ 31864,  4301 }}, {{ 31805,  4533 }}, {{ 31744,  4764 }}, {{ 31683,  4993 }},
+    {{ 31621,  5221 }}, {{ 31557,  5448 }}, {{ 31494,  5673 }}, {{ 31429,  5897 }}, {{ 31363,  6121 }},
+    {{ 31296,  6343 }}, {{ 31229,  6563 }}, {{ 31161,  6783 }}, {{ 31091,  7002 }}, {{ 31021,  7219 }},
+    {{ 30950,  7436 }}, {{ 30878,  7651 }}, {{ 30805,  7866 }}, {{ 30731,  8079 }}, {{ 30657,  8292 }},
+    {{ 30581,  8503 }}, {{ 30505,  8714 }}, {{ 30427,  8924 }}, {{ 30349,  9132 }}, {{ 30270,  9340 }},
+    {{ 30189,  9547 }}, {{ 30108,  9752 }}, {{ 30026,  9957 }}, {{ 29943, 10161 }}, {{ 29860, 10364 }},
+    {{ 29775, 10566 }}, {{ 29689, 10768 }}, {{ 29603, 10968 }}, {{ 29515, 11168 }}, {{ 29427, 11366 }},
+    {{ 29337, 11564 }}, {{ 29247, 11761 }}, {{ 29156, 11957 }}, {{ 29064, 12152 }}, {{ 28971, 12346 }},
+    {{ 28877, 12540 }}, {{ 28782, 12732 }}, {{ 28687, 12924 }}, {{ 28590, 13115 }}, {{ 28492, 13305 }},
+    {{ 28394, 13494 }}, {{ 28294, 13682 }}, {{ 28194, 13869 }}, {{ 28093, 14056 }}, {{ 27991, 14242 }},
+    {{ 27888, 14427 }}, {{ 27784, 14611 }}, {{ 27679, 14794 }}, {{ 27573, 14976 }}, {{ 27466, 15158 }},
+    {{ 27358, 15339 }}, {{ 27250, 15518 }}, {{ 27140, 15698 }}, {{ 27030, 15876 }}, {{ 26919, 16053 }},
+    {{ 26806, 16230 }}, {{ 26693, 16405 }}, {{ 26579, 16580 }}, {{ 26464, 16754 }}, {{ 26349, 16927 }},
+    {{ 26232, 17100 }}, {{ 26114, 17271 }}, {{ 25996, 17442 }}, {{ 25876, 17612 }}, {{ 25756, 17781 }},
+    {{ 25635, 17949 }}, {{ 25512, 18116 }}, {{ 25389, 18283 }}, {{ 25265, 18448 }}, {{ 25140, 18613 }},
+    {{ 25015, 18777 }}, {{ 24888, 18940 }}, {{ 24761, 19103 }}, {{ 24632, 19264 }}, {{ 24503, 19425 }},
+    {{ 24373, 19584 }}, {{ 24242, 19743 }}, {{ 24110, 19901 }}, {{ 23977, 20059 }}, {{ 23843, 20215 }},
+    {{ 23708, 20370 }}, {{ 23573, 20525 }}, {{ 23436, 20679 }}, {{ 23299, 20832 }}, {{ 23161, 20984 }},
+    {{ 23022, 21135 }}, {{ 22882, 21285 }}, {{ 22741, 21435 }}, {{ 22599, 21583 }}, {{ 22457, 21731 }},
+    {{ 22313, 21878 }}, {{ 22169, 22024 }}
+};
+
+const Word16 window_aldo_1_640_fx[180] =
+{
+         1,     3,     5,     9,    13,    19,    25,    33,    40,    49,
+        58,    69,    80,    93,   105,   119,   133,   149,   165,   182,
+       200,   219,   238,   258,   279,   301,   323,   347,   371,   396,
+       421,   448,   475,   503,   532,   561,   591,   623,   654,   687,
+       720,   755,   789,   825,   861,   898,   936,   974,  1013,  1054,
+      1094,  1136,  1178,  1221,  1264,  1309,  1353,  1399,  1445,  1493,
+      1540,  1589,  1638,  1688,  1739,  1790,  1842,  1895,  1948,  2002,
+      2057,  2112,  2168,  2225,  2282,  2340,  2399,  2458,  2518,  2579,
+      2640,  2702,  2764,  2827,  2891,  2955,  3020,  3086,  3152,  3219,
+      3286,  3355,  3423,  3493,  3562,  3633,  3704,  3775,  3847,  3920,
+      3994,  4068,  4142,  4217,  4293,  4369,  4445,  4523,  4600,  4679,
+      4758,  4837,  4917,  4998,  5078,  5160,  5242,  5325,  5407,  5491,
+      5575,  5660,  5744,  5830,  5916,  6003,  6089,  6177,  6265,  6353,
+      6442,  6531,  6620,  6711,  6801,  6892,  6983,  7076,  7168,  7260,
+      7353,  7447,  7541,  7635,  7730,  7825,  7920,  8016,  8112,  8209,
+      8306,  8403,  8501,  8599,  8697,  8796,  8895,  8995,  9094,  9195,
+      9295,  9396,  9497,  9598,  9700,  9802,  9904, 10007, 10109, 10212,
+     10316, 10419, 10523, 10628, 10732, 10837, 10941, 11047, 11152, 11248
+};
+
+const PWord16 window_aldo_1_trunc_640_fx[140] =
+{
+    {{ 32712, 11344 }}, {{ 32673, 11437 }}, {{ 32633, 11529 }}, {{ 32595, 11623 }}, {{ 32556, 11716 }},
+    {{ 32517, 11809 }}, {{ 32478, 11903 }}, {{ 32439, 11997 }}, {{ 32399, 12091 }}, {{ 32360, 12185 }},
+    {{ 32320, 12280 }}, {{ 32280, 12374 }}, {{ 32240, 12469 }}, {{ 32200, 12564 }}, {{ 32159, 12658 }},
+    {{ 32118, 12754 }}, {{ 32076, 12849 }}, {{ 32035, 12944 }}, {{ 31992, 13039 }}, {{ 31950, 13135 }},
+    {{ 31907, 13230 }}, {{ 31864, 13326 }}, {{ 31821, 13421 }}, {{ 31777, 13517 }}, {{ 31733, 13613 }},
+    {{ 31689, 13709 }}, {{ 31644, 13805 }}, {{ 31599, 13901 }}, {{ 31554, 13997 }}, {{ 31508, 14093 }},
+    {{ 31462, 14189 }}, {{ 31416, 14286 }}, {{ 31369, 14382 }}, {{ 31322, 14478 }}, {{ 31274, 14574 }},
+    {{ 31226, 14671 }}, {{ 31178, 14767 }}, {{ 31129, 14864 }}, {{ 31080, 14960 }}, {{ 31031, 15057 }},
+    {{ 30981, 15153 }}, {{ 30931, 15250 }}, {{ 30881, 15346 }}, {{ 30830, 15443 }}, {{ 30779, 15540 }},
+    {{ 30727, 15636 }}, {{ 30675, 15733 }}, {{ 30623, 15829 }}, {{ 30570, 15926 }}, {{ 30517, 16023 }},
+    {{ 30464, 16119 }}, {{ 30410, 16216 }}, {{ 30356, 16312 }}, {{ 30301, 16409 }}, {{ 30246, 16505 }},
+    {{ 30191, 16602 }}, {{ 30135, 16698 }}, {{ 30079, 16794 }}, {{ 30023, 16891 }}, {{ 29966, 16987 }},
+    {{ 29909, 17083 }}, {{ 29852, 17179 }}, {{ 29794, 17275 }}, {{ 29736, 17372 }}, {{ 29677, 17468 }},
+    {{ 29618, 17564 }}, {{ 29559, 17659 }}, {{ 29499, 17755 }}, {{ 29439, 17851 }}, {{ 29378, 17947 }},
+    {{ 29318, 18042 }}, {{ 29256, 18138 }}, {{ 29195, 18233 }}, {{ 29133, 18329 }}, {{ 29071, 18424 }},
+    {{ 29008, 18519 }}, {{ 28945, 18614 }}, {{ 28882, 18710 }}, {{ 28818, 18804 }}, {{ 28754, 18899 }},
+    {{ 28689, 18994 }}, {{ 28625, 19089 }}, {{ 28559, 19183 }}, {{ 28494, 19278 }}, {{ 28428, 19372 }},
+    {{ 28362, 19466 }}, {{ 28295, 19560 }}, {{ 28228, 19654 }}, {{ 28161, 19748 }}, {{ 28093, 19841 }},
+    {{ 28025, 19935 }}, {{ 27957, 20028 }}, {{ 27888, 20121 }}, {{ 27819, 20214 }}, {{ 27750, 20307 }},
+    {{ 27680, 20400 }}, {{ 27610, 20493 }}, {{ 27540, 20585 }}, {{ 27469, 20677 }}, {{ 27398, 20770 }},
+    {{ 27326, 20862 }}, {{ 27254, 20954 }}, {{ 27182, 21045 }}, {{ 27110, 21137 }}, {{ 27037, 21228 }},
+    {{ 26964, 21319 }}, {{ 26890, 21410 }}, {{ 26817, 21501 }}, {{ 26743, 21591 }}, {{ 26668, 21682 }},
+    {{ 26593, 21772 }}, {{ 26518, 21862 }}, {{ 26443, 21952 }}, {{ 26367, 22042 }}, {{ 26291, 22131 }},
+    {{ 26215, 22220 }}, {{ 26138, 22309 }}, {{ 26061, 22398 }}, {{ 25984, 22486 }}, {{ 25907, 22575 }},
+    {{ 25829, 22663 }}, {{ 25751, 22751 }}, {{ 25672, 22839 }}, {{ 25593, 22926 }}, {{ 25514, 23013 }},
+    {{ 25435, 23101 }}, {{ 25355, 23187 }}, {{ 25275, 23274 }}, {{ 25195, 23360 }}, {{ 25114, 23446 }},
+    {{ 25034, 23532 }}, {{ 24953, 23618 }}, {{ 24871, 23703 }}, {{ 24789, 23788 }}, {{ 24707, 23873 }},
+    {{ 24625, 23958 }}, {{ 24543, 24042 }}, {{ 24460, 24126 }}, {{ 24377, 24210 }}, {{ 24321, 24266 }}
+};
+
+const PWord16 window_aldo_2_640_fx[140] =
+{
+    {{ 32712,   324 }}, {{ 32673,   545 }}, {{ 32633,   766 }}, {{ 32593,   978 }}, {{ 32553,  1191 }},
+    {{ 32513,  1397 }}, {{ 32473,  1604 }}, {{ 32432,  1807 }}, {{ 32391,  2009 }}, {{ 32349,  2208 }},
+    {{ 32307,  2407 }}, {{ 32265,  2603 }}, {{ 32222,  2800 }}, {{ 32178,  2993 }}, {{ 32134,  3187 }},
+    {{ 32090,  3378 }}, {{ 32045,  3570 }}, {{ 31999,  3759 }}, {{ 31953,  3948 }}, {{ 31907,  4136 }},
+    {{ 31859,  4323 }}, {{ 31812,  4508 }}, {{ 31764,  4694 }}, {{ 31715,  4878 }}, {{ 31665,  5061 }},
+    {{ 31615,  5243 }}, {{ 31565,  5425 }}, {{ 31514,  5606 }}, {{ 31462,  5786 }}, {{ 31410,  5965 }},
+    {{ 31357,  6144 }}, {{ 31304,  6322 }}, {{ 31250,  6499 }}, {{ 31196,  6675 }}, {{ 31141,  6851 }},
+    {{ 31085,  7026 }}, {{ 31029,  7201 }}, {{ 30972,  7374 }}, {{ 30915,  7547 }}, {{ 30857,  7720 }},
+    {{ 30798,  7892 }}, {{ 30739,  8062 }}, {{ 30679,  8233 }}, {{ 30619,  8403 }}, {{ 30558,  8572 }},
+    {{ 30497,  8740 }}, {{ 30435,  8908 }}, {{ 30372,  9076 }}, {{ 30309,  9243 }}, {{ 30245,  9408 }},
+    {{ 30181,  9574 }}, {{ 30116,  9739 }}, {{ 30050,  9904 }}, {{ 29984, 10067 }}, {{ 29917, 10230 }},
+    {{ 29850, 10393 }}, {{ 29782, 10555 }}, {{ 29714, 10716 }}, {{ 29645, 10877 }}, {{ 29575, 11038 }},
+    {{ 29505, 11197 }}, {{ 29434, 11356 }}, {{ 29362, 11515 }}, {{ 29290, 11673 }}, {{ 29218, 11831 }},
+    {{ 29144, 11988 }}, {{ 29070, 12144 }}, {{ 28996, 12300 }}, {{ 28921, 12455 }}, {{ 28845, 12610 }},
+    {{ 28769, 12764 }}, {{ 28692, 12918 }}, {{ 28615, 13071 }}, {{ 28537, 13223 }}, {{ 28459, 13376 }},
+    {{ 28379, 13527 }}, {{ 28300, 13678 }}, {{ 28219, 13828 }}, {{ 28138, 13978 }}, {{ 28057, 14127 }},
+    {{ 27975, 14276 }}, {{ 27892, 14425 }}, {{ 27809, 14572 }}, {{ 27725, 14719 }}, {{ 27640, 14866 }},
+    {{ 27555, 15012 }}, {{ 27470, 15158 }}, {{ 27383, 15303 }}, {{ 27297, 15447 }}, {{ 27209, 15591 }},
+    {{ 27121, 15735 }}, {{ 27033, 15877 }}, {{ 26944, 16020 }}, {{ 26854, 16161 }}, {{ 26763, 16303 }},
+    {{ 26672, 16443 }}, {{ 26581, 16584 }}, {{ 26489, 16723 }}, {{ 26396, 16863 }}, {{ 26303, 17001 }},
+    {{ 26209, 17139 }}, {{ 26115, 17277 }}, {{ 26020, 17414 }}, {{ 25924, 17550 }}, {{ 25828, 17686 }},
+    {{ 25731, 17821 }}, {{ 25634, 17956 }}, {{ 25536, 18090 }}, {{ 25437, 18224 }}, {{ 25338, 18357 }},
+    {{ 25239, 18490 }}, {{ 25138, 18622 }}, {{ 25037, 18754 }}, {{ 24936, 18885 }}, {{ 24834, 19015 }},
+    {{ 24731, 19145 }}, {{ 24628, 19274 }}, {{ 24525, 19403 }}, {{ 24420, 19532 }}, {{ 24316, 19659 }},
+    {{ 24210, 19787 }}, {{ 24104, 19913 }}, {{ 23998, 20039 }}, {{ 23890, 20165 }}, {{ 23783, 20290 }},
+    {{ 23674, 20414 }}, {{ 23566, 20538 }}, {{ 23456, 20662 }}, {{ 23346, 20785 }}, {{ 23236, 20907 }},
+    {{ 23125, 21029 }}, {{ 23013, 21150 }}, {{ 22901, 21271 }}, {{ 22788, 21390 }}, {{ 22675, 21510 }},
+    {{ 22561, 21629 }}, {{ 22446, 21747 }}, {{ 22331, 21865 }}, {{ 22215, 21983 }}, {{ 22138, 22060 }}
+};
+
+const Word16 window_aldo_1_960_fx[270] =
+{
+         0,     1,     2,     3,     5,     8,    10,    13,    17,    21,
+        25,    30,    35,    40,    46,    52,    58,    65,    72,    80,
+        88,    96,   105,   114,   124,   133,   144,   154,   165,   176,
+       188,   200,   212,   225,   238,   251,   265,   279,   293,   308,
+       323,   339,   354,   371,   387,   404,   421,   439,   457,   475,
+       493,   512,   532,   551,   571,   591,   612,   633,   654,   676,
+       698,   720,   743,   766,   789,   813,   837,   861,   885,   910,
+       936,   961,   987,  1013,  1040,  1067,  1094,  1122,  1149,  1178,
+      1206,  1235,  1264,  1293,  1323,  1353,  1384,  1414,  1445,  1477,
+      1508,  1540,  1573,  1605,  1638,  1671,  1705,  1739,  1773,  1807,
+      1842,  1877,  1912,  1948,  1984,  2020,  2057,  2093,  2130,  2168,
+      2206,  2244,  2282,  2320,  2359,  2399,  2438,  2478,  2518,  2558,
+      2599,  2640,  2681,  2722,  2764,  2806,  2848,  2891,  2934,  2977,
+      3020,  3064,  3108,  3152,  3196,  3241,  3286,  3332,  3377,  3423,
+      3469,  3515,  3562,  3609,  3656,  3704,  3751,  3799,  3847,  3896,
+      3945,  3994,  4043,  4092,  4142,  4192,  4242,  4293,  4343,  4394,
+      4445,  4497,  4549,  4600,  4653,  4705,  4758,  4811,  4864,  4917,
+      4971,  5024,  5078,  5133,  5187,  5242,  5297,  5352,  5407,  5463,
+      5519,  5575,  5631,  5688,  5744,  5801,  5859,  5916,  5974,  6031,
+      6089,  6147,  6206,  6265,  6323,  6382,  6442,  6501,  6561,  6620,
+      6680,  6741,  6801,  6862,  6922,  6983,  7045,  7106,  7168,  7229,
+      7291,  7353,  7416,  7478,  7541,  7604,  7667,  7730,  7793,  7857,
+      7920,  7984,  8048,  8112,  8177,  8241,  8306,  8371,  8436,  8501,
+      8566,  8632,  8697,  8763,  8829,  8895,  8961,  9028,  9094,  9161,
+      9228,  9295,  9362,  9429,  9497,  9564,  9632,  9700,  9768,  9836,
+      9904,  9972, 10041, 10109, 10178, 10247, 10316, 10385, 10454, 10523,
+     10593, 10662, 10732, 10802, 10871, 10941, 11012, 11082, 11152, 11222
+};
+
+const PWord16 window_aldo_1_trunc_960_fx[210] =
+{
+    {{ 32739, 11283 }}, {{ 32712, 11344 }}, {{ 32685, 11406 }}, {{ 32659, 11467 }}, {{ 32633, 11529 }},
+    {{ 32607, 11591 }}, {{ 32582, 11653 }}, {{ 32556, 11716 }}, {{ 32530, 11778 }}, {{ 32504, 11840 }},
+    {{ 32478, 11903 }}, {{ 32452, 11966 }}, {{ 32426, 12028 }}, {{ 32399, 12091 }}, {{ 32373, 12154 }},
+    {{ 32347, 12217 }}, {{ 32320, 12280 }}, {{ 32294, 12343 }}, {{ 32267, 12406 }}, {{ 32240, 12469 }},
+    {{ 32213, 12532 }}, {{ 32186, 12595 }}, {{ 32159, 12658 }}, {{ 32131, 12722 }}, {{ 32104, 12785 }},
+    {{ 32076, 12849 }}, {{ 32048, 12912 }}, {{ 32020, 12976 }}, {{ 31992, 13039 }}, {{ 31964, 13103 }},
+    {{ 31936, 13166 }}, {{ 31907, 13230 }}, {{ 31879, 13294 }}, {{ 31850, 13358 }}, {{ 31821, 13421 }},
+    {{ 31792, 13485 }}, {{ 31763, 13549 }}, {{ 31733, 13613 }}, {{ 31704, 13677 }}, {{ 31674, 13741 }},
+    {{ 31644, 13805 }}, {{ 31614, 13869 }}, {{ 31584, 13933 }}, {{ 31554, 13997 }}, {{ 31523, 14061 }},
+    {{ 31493, 14125 }}, {{ 31462, 14189 }}, {{ 31431, 14253 }}, {{ 31400, 14318 }}, {{ 31369, 14382 }},
+    {{ 31337, 14446 }}, {{ 31306, 14510 }}, {{ 31274, 14574 }}, {{ 31242, 14639 }}, {{ 31210, 14703 }},
+    {{ 31178, 14767 }}, {{ 31145, 14832 }}, {{ 31113, 14896 }}, {{ 31080, 14960 }}, {{ 31047, 15025 }},
+    {{ 31014, 15089 }}, {{ 30981, 15153 }}, {{ 30948, 15218 }}, {{ 30914, 15282 }}, {{ 30881, 15346 }},
+    {{ 30847, 15411 }}, {{ 30813, 15475 }}, {{ 30779, 15540 }}, {{ 30744, 15604 }}, {{ 30710, 15668 }},
+    {{ 30675, 15733 }}, {{ 30640, 15797 }}, {{ 30605, 15862 }}, {{ 30570, 15926 }}, {{ 30535, 15990 }},
+    {{ 30499, 16055 }}, {{ 30464, 16119 }}, {{ 30428, 16183 }}, {{ 30392, 16248 }}, {{ 30356, 16312 }},
+    {{ 30319, 16376 }}, {{ 30283, 16441 }}, {{ 30246, 16505 }}, {{ 30209, 16569 }}, {{ 30172, 16634 }},
+    {{ 30135, 16698 }}, {{ 30098, 16762 }}, {{ 30061, 16826 }}, {{ 30023, 16891 }}, {{ 29985, 16955 }},
+    {{ 29947, 17019 }}, {{ 29909, 17083 }}, {{ 29871, 17147 }}, {{ 29832, 17211 }}, {{ 29794, 17275 }},
+    {{ 29755, 17339 }}, {{ 29716, 17404 }}, {{ 29677, 17468 }}, {{ 29638, 17532 }}, {{ 29598, 17596 }},
+    {{ 29559, 17659 }}, {{ 29519, 17723 }}, {{ 29479, 17787 }}, {{ 29439, 17851 }}, {{ 29399, 17915 }},
+    {{ 29358, 17979 }}, {{ 29318, 18042 }}, {{ 29277, 18106 }}, {{ 29236, 18170 }}, {{ 29195, 18233 }},
+    {{ 29154, 18297 }}, {{ 29112, 18361 }}, {{ 29071, 18424 }}, {{ 29029, 18488 }}, {{ 28987, 18551 }},
+    {{ 28945, 18614 }}, {{ 28903, 18678 }}, {{ 28860, 18741 }}, {{ 28818, 18804 }}, {{ 28775, 18868 }},
+    {{ 28732, 18931 }}, {{ 28689, 18994 }}, {{ 28646, 19057 }}, {{ 28603, 19120 }}, {{ 28559, 19183 }},
+    {{ 28516, 19246 }}, {{ 28472, 19309 }}, {{ 28428, 19372 }}, {{ 28384, 19434 }}, {{ 28340, 19497 }},
+    {{ 28295, 19560 }}, {{ 28250, 19622 }}, {{ 28206, 19685 }}, {{ 28161, 19748 }}, {{ 28116, 19810 }},
+    {{ 28071, 19872 }}, {{ 28025, 19935 }}, {{ 27980, 19997 }}, {{ 27934, 20059 }}, {{ 27888, 20121 }},
+    {{ 27842, 20183 }}, {{ 27796, 20245 }}, {{ 27750, 20307 }}, {{ 27703, 20369 }}, {{ 27657, 20431 }},
+    {{ 27610, 20493 }}, {{ 27563, 20554 }}, {{ 27516, 20616 }}, {{ 27469, 20677 }}, {{ 27421, 20739 }},
+    {{ 27374, 20800 }}, {{ 27326, 20862 }}, {{ 27278, 20923 }}, {{ 27230, 20984 }}, {{ 27182, 21045 }},
+    {{ 27134, 21106 }}, {{ 27086, 21167 }}, {{ 27037, 21228 }}, {{ 26988, 21289 }}, {{ 26939, 21349 }},
+    {{ 26890, 21410 }}, {{ 26841, 21471 }}, {{ 26792, 21531 }}, {{ 26743, 21591 }}, {{ 26693, 21652 }},
+    {{ 26643, 21712 }}, {{ 26593, 21772 }}, {{ 26543, 21832 }}, {{ 26493, 21892 }}, {{ 26443, 21952 }},
+    {{ 26393, 22012 }}, {{ 26342, 22071 }}, {{ 26291, 22131 }}, {{ 26240, 22190 }}, {{ 26189, 22250 }},
+    {{ 26138, 22309 }}, {{ 26087, 22368 }}, {{ 26036, 22427 }}, {{ 25984, 22486 }}, {{ 25932, 22545 }},
+    {{ 25881, 22604 }}, {{ 25829, 22663 }}, {{ 25777, 22722 }}, {{ 25724, 22780 }}, {{ 25672, 22839 }},
+    {{ 25620, 22897 }}, {{ 25567, 22955 }}, {{ 25514, 23013 }}, {{ 25461, 23071 }}, {{ 25408, 23129 }},
+    {{ 25355, 23187 }}, {{ 25302, 23245 }}, {{ 25248, 23303 }}, {{ 25195, 23360 }}, {{ 25141, 23418 }},
+    {{ 25087, 23475 }}, {{ 25034, 23532 }}, {{ 24979, 23589 }}, {{ 24925, 23646 }}, {{ 24871, 23703 }},
+    {{ 24817, 23760 }}, {{ 24762, 23817 }}, {{ 24707, 23873 }}, {{ 24653, 23930 }}, {{ 24598, 23986 }},
+    {{ 24543, 24042 }}, {{ 24488, 24098 }}, {{ 24432, 24154 }}, {{ 24377, 24210 }}, {{ 24321, 24266 }}
+};
+
+const PWord16 window_aldo_2_960_fx[210] =
+{
+    {{ 32739,   169 }}, {{ 32712,   324 }}, {{ 32685,   474 }}, {{ 32659,   621 }}, {{ 32633,   766 }},
+    {{ 32606,   909 }}, {{ 32580,  1051 }}, {{ 32553,  1191 }}, {{ 32527,  1330 }}, {{ 32500,  1467 }},
+    {{ 32473,  1604 }}, {{ 32446,  1740 }}, {{ 32418,  1875 }}, {{ 32391,  2009 }}, {{ 32363,  2142 }},
+    {{ 32335,  2275 }}, {{ 32307,  2407 }}, {{ 32279,  2539 }}, {{ 32251,  2669 }}, {{ 32222,  2800 }},
+    {{ 32193,  2929 }}, {{ 32164,  3058 }}, {{ 32134,  3187 }}, {{ 32105,  3315 }}, {{ 32075,  3443 }},
+    {{ 32045,  3570 }}, {{ 32015,  3696 }}, {{ 31984,  3823 }}, {{ 31953,  3948 }}, {{ 31922,  4074 }},
+    {{ 31891,  4198 }}, {{ 31859,  4323 }}, {{ 31828,  4447 }}, {{ 31796,  4570 }}, {{ 31764,  4694 }},
+    {{ 31731,  4817 }}, {{ 31698,  4939 }}, {{ 31665,  5061 }}, {{ 31632,  5183 }}, {{ 31599,  5304 }},
+    {{ 31565,  5425 }}, {{ 31531,  5546 }}, {{ 31497,  5666 }}, {{ 31462,  5786 }}, {{ 31428,  5906 }},
+    {{ 31393,  6025 }}, {{ 31357,  6144 }}, {{ 31322,  6263 }}, {{ 31286,  6381 }}, {{ 31250,  6499 }},
+    {{ 31214,  6617 }}, {{ 31177,  6734 }}, {{ 31141,  6851 }}, {{ 31104,  6968 }}, {{ 31066,  7085 }},
+    {{ 31029,  7201 }}, {{ 30991,  7317 }}, {{ 30953,  7432 }}, {{ 30915,  7547 }}, {{ 30876,  7662 }},
+    {{ 30837,  7777 }}, {{ 30798,  7892 }}, {{ 30759,  8006 }}, {{ 30719,  8119 }}, {{ 30679,  8233 }},
+    {{ 30639,  8346 }}, {{ 30599,  8459 }}, {{ 30558,  8572 }}, {{ 30517,  8684 }}, {{ 30476,  8797 }},
+    {{ 30435,  8908 }}, {{ 30393,  9020 }}, {{ 30351,  9131 }}, {{ 30309,  9243 }}, {{ 30266,  9353 }},
+    {{ 30224,  9464 }}, {{ 30181,  9574 }}, {{ 30138,  9684 }}, {{ 30094,  9794 }}, {{ 30050,  9904 }},
+    {{ 30006, 10013 }}, {{ 29962, 10122 }}, {{ 29917, 10230 }}, {{ 29873, 10339 }}, {{ 29827, 10447 }},
+    {{ 29782, 10555 }}, {{ 29737, 10663 }}, {{ 29691, 10770 }}, {{ 29645, 10877 }}, {{ 29598, 10984 }},
+    {{ 29551, 11091 }}, {{ 29505, 11197 }}, {{ 29457, 11304 }}, {{ 29410, 11410 }}, {{ 29362, 11515 }},
+    {{ 29314, 11621 }}, {{ 29266, 11726 }}, {{ 29218, 11831 }}, {{ 29169, 11936 }}, {{ 29120, 12040 }},
+    {{ 29070, 12144 }}, {{ 29021, 12248 }}, {{ 28971, 12352 }}, {{ 28921, 12455 }}, {{ 28871, 12559 }},
+    {{ 28820, 12662 }}, {{ 28769, 12764 }}, {{ 28718, 12867 }}, {{ 28667, 12969 }}, {{ 28615, 13071 }},
+    {{ 28563, 13173 }}, {{ 28511, 13274 }}, {{ 28459, 13376 }}, {{ 28406, 13477 }}, {{ 28353, 13578 }},
+    {{ 28300, 13678 }}, {{ 28246, 13778 }}, {{ 28192, 13878 }}, {{ 28138, 13978 }}, {{ 28084, 14078 }},
+    {{ 28030, 14177 }}, {{ 27975, 14276 }}, {{ 27920, 14375 }}, {{ 27864, 14474 }}, {{ 27809, 14572 }},
+    {{ 27753, 14671 }}, {{ 27697, 14768 }}, {{ 27640, 14866 }}, {{ 27584, 14964 }}, {{ 27527, 15061 }},
+    {{ 27470, 15158 }}, {{ 27412, 15254 }}, {{ 27355, 15351 }}, {{ 27297, 15447 }}, {{ 27238, 15543 }},
+    {{ 27180, 15639 }}, {{ 27121, 15735 }}, {{ 27062, 15830 }}, {{ 27003, 15925 }}, {{ 26944, 16020 }},
+    {{ 26884, 16114 }}, {{ 26824, 16209 }}, {{ 26763, 16303 }}, {{ 26703, 16397 }}, {{ 26642, 16490 }},
+    {{ 26581, 16584 }}, {{ 26520, 16677 }}, {{ 26458, 16770 }}, {{ 26396, 16863 }}, {{ 26334, 16955 }},
+    {{ 26272, 17047 }}, {{ 26209, 17139 }}, {{ 26146, 17231 }}, {{ 26083, 17322 }}, {{ 26020, 17414 }},
+    {{ 25956, 17505 }}, {{ 25892, 17595 }}, {{ 25828, 17686 }}, {{ 25763, 17776 }}, {{ 25699, 17866 }},
+    {{ 25634, 17956 }}, {{ 25568, 18046 }}, {{ 25503, 18135 }}, {{ 25437, 18224 }}, {{ 25371, 18313 }},
+    {{ 25305, 18402 }}, {{ 25239, 18490 }}, {{ 25172, 18578 }}, {{ 25105, 18666 }}, {{ 25037, 18754 }},
+    {{ 24970, 18841 }}, {{ 24902, 18928 }}, {{ 24834, 19015 }}, {{ 24766, 19102 }}, {{ 24697, 19188 }},
+    {{ 24628, 19274 }}, {{ 24559, 19360 }}, {{ 24490, 19446 }}, {{ 24420, 19532 }}, {{ 24351, 19617 }},
+    {{ 24281, 19702 }}, {{ 24210, 19787 }}, {{ 24140, 19871 }}, {{ 24069, 19955 }}, {{ 23998, 20039 }},
+    {{ 23926, 20123 }}, {{ 23855, 20207 }}, {{ 23783, 20290 }}, {{ 23711, 20373 }}, {{ 23638, 20456 }},
+    {{ 23566, 20538 }}, {{ 23493, 20621 }}, {{ 23420, 20703 }}, {{ 23346, 20785 }}, {{ 23273, 20866 }},
+    {{ 23199, 20948 }}, {{ 23125, 21029 }}, {{ 23050, 21110 }}, {{ 22976, 21190 }}, {{ 22901, 21271 }},
+    {{ 22826, 21351 }}, {{ 22750, 21430 }}, {{ 22675, 21510 }}, {{ 22599, 21589 }}, {{ 22523, 21669 }},
+    {{ 22446, 21747 }}, {{ 22370, 21826 }}, {{ 22293, 21904 }}, {{ 22215, 21983 }}, {{ 22138, 22060 }}
+};
+
 const Word16 small_overlap_48[R2_48/7]=
 {
     429, 1286, 2143, 2998, 3851, 4702, 5549, 6393,
@@ -13929,6 +14532,243 @@ const UWord32 exactdivodd_fx[ODD_DIV_SIZE_FX]=/*     exactdivodd[0]=1/1,exactdiv
     2014922929U,   724452315U,  4244438269U,  1875962727U,  4198451177U,  3539808211U,  1062196213U,  3571604383U
 };
 
+const UWord32 pvq_a_tab_fx[PVQ_A_TAB_SIZE_FX] =   /* A(n,k), n = 3..64, k = 0..kmax(n)+1, rows start at pvq_a_row_fx[n] */
+{
+    /* n = 3 */
+              0U,           1U,           5U,          13U,          25U,          41U,          61U,          85U,
+            113U,         145U,         181U,         221U,         265U,         313U,         365U,         421U,
+            481U,         545U,         613U,         685U,         761U,         841U,         925U,        1013U,
+           1105U,        1201U,        1301U,        1405U,        1513U,        1625U,        1741U,        1861U,
+           1985U,        2113U,        2245U,        2381U,        2521U,        2665U,        2813U,        2965U,
+           3121U,        3281U,        3445U,        3613U,        3785U,        3961U,        4141U,        4325U,
+           4513U,        4705U,        4901U,        5101U,        5305U,        5513U,        5725U,        5941U,
+           6161U,        6385U,        6613U,        6845U,        7081U,        7321U,        7565U,        7813U,
+           8065U,        8321U,        8581U,        8845U,        9113U,        9385U,        9661U,        9941U,
+          10225U,       10513U,       10805U,       11101U,       11401U,       11705U,       12013U,       12325U,
+          12641U,       12961U,       13285U,       13613U,       13945U,       14281U,       14621U,       14965U,
+          15313U,       15665U,       16021U,       16381U,       16745U,       17113U,       17485U,       17861U,
+          18241U,       18625U,
+    /* n = 4 */
+              0U,           1U,           7U,          25U,          63U,         129U,         231U,         377U,
+            575U,         833U,        1159U,        1561U,        2047U,        2625U,        3303U,        4089U,
+           4991U,        6017U,        7175U,        8473U,        9919U,       11521U,       13287U,       15225U,
+          17343U,       19649U,       22151U,       24857U,       27775U,       30913U,       34279U,       37881U,
+          41727U,       45825U,       50183U,       54809U,       59711U,       64897U,       70375U,       76153U,
+          82239U,       88641U,       95367U,      102425U,      109823U,      117569U,      125671U,      134137U,
+         142975U,      152193U,      161799U,      171801U,      182207U,      193025U,      204263U,      215929U,
+         228031U,      240577U,      253575U,      267033U,      280959U,      295361U,      310247U,      325625U,
+         341503U,      357889U,      374791U,      392217U,      410175U,      428673U,      447719U,      467321U,
+         487487U,      508225U,      529543U,      551449U,      573951U,      597057U,      620775U,      645113U,
+         670079U,      695681U,      721927U,      748825U,      776383U,      804609U,      833511U,      863097U,
+         893375U,      924353U,      956039U,      988441U,     1021567U,     1055425U,     1090023U,     1125369U,
+        1161471U,     1198337U,
+    /* n = 5 */
+              0U,           1U,           9U,          41U,         129U,         321U,         681U,        1289U,
+           2241U,        3649U,        5641U,        8361U,       11969U,       16641U,       22569U,       29961U,
+          39041U,       50049U,       63241U,       78889U,       97281U,      118721U,      143529U,      172041U,
+         204609U,      241601U,      283401U,      330409U,      383041U,      441729U,      506921U,      579081U,
+         658689U,      746241U,      842249U,      947241U,     1061761U,     1186369U,     1321641U,     1468169U,
+        1626561U,     1797441U,     1981449U,     2179241U,     2391489U,     2618881U,     2862121U,     3121929U,
+        3399041U,     3694209U,     4008201U,     4341801U,     4695809U,     5071041U,     5468329U,     5888521U,
+        6332481U,     6801089U,     7295241U,     7815849U,     8363841U,     8940161U,     9545769U,    10181641U,
+       10848769U,    11548161U,    12280841U,    13047849U,    13850241U,    14689089U,    15565481U,    16480521U,
+       17435329U,    18431041U,    19468809U,    20549801U,    21675201U,    22846209U,    24064041U,    25329929U,
+       26645121U,    28010881U,    29428489U,    30899241U,    32424449U,    34005441U,    35643561U,    37340169U,
+       39096641U,    40914369U,    42794761U,    44739241U,    46749249U,    48826241U,    50971689U,    53187081U,
+       55473921U,    57833729U,
+    /* n = 6 */
+              0U,           1U,          11U,          61U,         231U,         681U,        1683U,        3653U,
+           7183U,       13073U,       22363U,       36365U,       56695U,       85305U,      124515U,      177045U,
+         246047U,      335137U,      448427U,      590557U,      766727U,      982729U,     1244979U,     1560549U,
+        1937199U,     2383409U,     2908411U,     3522221U,     4235671U,     5060441U,     6009091U,     7095093U,
+        8332863U,     9737793U,    11326283U,    13115773U,    15124775U,    17372905U,    19880915U,    22670725U,
+       25765455U,    29189457U,    32968347U,    37129037U,    41699767U,    46710137U,    52191139U,    58175189U,
+       64696159U,    71789409U,    79491819U,    87841821U,    96879431U,   106646281U,   117185651U,   128542501U,
+      140763503U,   153897073U,   167993403U,   183104493U,   199284183U,   216588185U,   235074115U,   254801525U,
+      275831935U,   298228865U,   322057867U,   347386557U,   374284647U,   402823977U,   433078547U,   465124549U,
+      499040399U,   534906769U,   572806619U,   612825229U,   655050231U,   699571641U,   746481891U,   795875861U,
+      847850911U,   902506913U,   959946283U,  1020274013U,  1083597703U,  1150027593U,  1219676595U,  1292660325U,
+     1369097135U,  1449108145U,  1532817275U,  1620351277U,  1711839767U,  1807415257U,  1907213187U,  2011371957U,
+     2120032959U,  2233340609U,
+    /* n = 7 */
+              0U,           1U,          13U,          85U,         377U,        1289U,        3653U,        8989U,
+          19825U,       40081U,       75517U,      134245U,      227305U,      369305U,      579125U,      880685U,
+        1303777U,     1884961U,     2668525U,     3707509U,     5064793U,     6814249U,     9041957U,    11847485U,
+       15345233U,    19665841U,    24957661U,    31388293U,    39146185U,    48442297U,    59511829U,    72616013U,
+       88043969U,   106114625U,   127178701U,   151620757U,   179861305U,   212358985U,   249612805U,   292164445U,
+      340600625U,   395555537U,   457713341U,   527810725U,   606639529U,   695049433U,   793950709U,   904317037U,
+     1027188385U,  1163673953U,  1314955181U,  1482288821U,  1667010073U,  1870535785U,  2094367717U,  2340095869U,
+     2609401873U,  2904062449U,  3225952925U,  3577050821U,  3959439497U,
+    /* n = 8 */
+              0U,           1U,          15U,         113U,         575U,        2241U,        7183U,       19825U,
+          48639U,      108545U,      224143U,      433905U,      795455U,     1392065U,     2340495U,     3800305U,
+        5984767U,     9173505U,    13726991U,    20103025U,    28875327U,    40754369U,    56610575U,    77500017U,
+      104692735U,   139703809U,   184327311U,   240673265U,   311207743U,   398796225U,   506750351U,   638878193U,
+      799538175U,   993696769U,  1226990095U,  1505789553U,  1837271615U,  2229491905U,  2691463695U,  3233240945U,
+     3866006015U,
+    /* n = 9 */
+              0U,           1U,          17U,         145U,         833U,        3649U,       13073U,       40081U,
+         108545U,      265729U,      598417U,     1256465U,     2485825U,     4673345U,     8405905U,    14546705U,
+       24331777U,    39490049U,    62390545U,    96220561U,   145198913U,   214828609U,   312193553U,   446304145U,
+      628496897U,   872893441U,  1196924561U,  1621925137U,  2173806145U,  2883810113U,  3789356689U,
+    /* n = 10 */
+              0U,           1U,          19U,         181U,        1159U,        5641U,       22363U,       75517U,
+         224143U,      598417U,     1462563U,     3317445U,     7059735U,    14218905U,    27298155U,    50250765U,
+       89129247U,   152951073U,   254831667U,   413442773U,   654862247U,  1014889769U,  1541911931U,  2300409629U,
+     3375210671U,
+    /* n = 11 */
+              0U,           1U,          21U,         221U,        1561U,        8361U,       36365U,      134245U,
+         433905U,     1256465U,     3317445U,     8097453U,    18474633U,    39753273U,    81270333U,   158819253U,
+      298199265U,   540279585U,   948062325U,  1616336765U,  2684641785U,
+    /* n = 12 */
+              0U,           1U,          23U,         265U,        2047U,       11969U,       56695U,      227305U,
+         795455U,     2485825U,     7059735U,    18474633U,    45046719U,   103274625U,   224298231U,   464387817U,
+      921406335U,  1759885185U,  3248227095U,
+    /* n = 13 */
+              0U,           1U,          25U,         313U,        2625U,       16641U,       85305U,      369305U,
+        1392065U,     4673345U,    14218905U,    39753273U,   103274625U,   251595969U,   579168825U,  1267854873U,
+     2653649025U,
+    /* n = 14 */
+              0U,           1U,          27U,         365U,        3303U,       22569U,      124515U,      579125U,
+        2340495U,     8405905U,    27298155U,    81270333U,   224298231U,   579168825U,  1409933619U,  3256957317U,
+    /* n = 15 */
+              0U,           1U,          29U,         421U,        4089U,       29961U,      177045U,      880685U,
+        3800305U,    14546705U,    50250765U,   158819253U,   464387817U,  1267854873U,  3256957317U,
+    /* n = 16 */
+              0U,           1U,          31U,         481U,        4991U,       39041U,      246047U,     1303777U,
+        5984767U,    24331777U,    89129247U,   298199265U,   921406335U,  2653649025U,
+    /* n = 17 */
+              0U,           1U,          33U,         545U,        6017U,       50049U,      335137U,     1884961U,
+        9173505U,    39490049U,   152951073U,   540279585U,  1759885185U,
+    /* n = 18 */
+              0U,           1U,          35U,         613U,        7175U,       63241U,      448427U,     2668525U,
+       13726991U,    62390545U,   254831667U,   948062325U,  3248227095U,
+    /* n = 19 */
+              0U,           1U,          37U,         685U,        8473U,       78889U,      590557U,     3707509U,
+       20103025U,    96220561U,   413442773U,  1616336765U,
+    /* n = 20 */
+              0U,           1U,          39U,         761U,        9919U,       97281U,      766727U,     5064793U,
+       28875327U,   145198913U,   654862247U,  2684641785U,
+    /* n = 21 */
+              0U,           1U,          41U,         841U,       11521U,      118721U,      982729U,     6814249U,
+       40754369U,   214828609U,  1014889769U,
+    /* n = 22 */
+              0U,           1U,          43U,         925U,       13287U,      143529U,     1244979U,     9041957U,
+       56610575U,   312193553U,  1541911931U,
+    /* n = 23 */
+              0U,           1U,          45U,        1013U,       15225U,      172041U,     1560549U,    11847485U,
+       77500017U,   446304145U,  2300409629U,
+    /* n = 24 */
+              0U,           1U,          47U,        1105U,       17343U,      204609U,     1937199U,    15345233U,
+      104692735U,   628496897U,  3375210671U,
+    /* n = 25 */
+              0U,           1U,          49U,        1201U,       19649U,      241601U,     2383409U,    19665841U,
+      139703809U,   872893441U,
+    /* n = 26 */
+              0U,           1U,          51U,        1301U,       22151U,      283401U,     2908411U,    24957661U,
+      184327311U,  1196924561U,
+    /* n = 27 */
+              0U,           1U,          53U,        1405U,       24857U,      330409U,     3522221U,    31388293U,
+      240673265U,  1621925137U,
+    /* n = 28 */
+              0U,           1U,          55U,        1513U,       27775U,      383041U,     4235671U,    39146185U,
+      311207743U,  2173806145U,
+    /* n = 29 */
+              0U,           1U,          57U,        1625U,       30913U,      441729U,     5060441U,    48442297U,
+      398796225U,  2883810113U,
+    /* n = 30 */
+              0U,           1U,          59U,        1741U,       34279U,      506921U,     6009091U,    59511829U,
+      506750351U,  3789356689U,
+    /* n = 31 */
+              0U,           1U,          61U,        1861U,       37881U,      579081U,     7095093U,    72616013U,
+      638878193U,
+    /* n = 32 */
+              0U,           1U,          63U,        1985U,       41727U,      658689U,     8332863U,    88043969U,
+      799538175U,
+    /* n = 33 */
+              0U,           1U,          65U,        2113U,       45825U,      746241U,     9737793U,   106114625U,
+      993696769U,
+    /* n = 34 */
+              0U,           1U,          67U,        2245U,       50183U,      842249U,    11326283U,   127178701U,
+     1226990095U,
+    /* n = 35 */
+              0U,           1U,          69U,        2381U,       54809U,      947241U,    13115773U,   151620757U,
+     1505789553U,
+    /* n = 36 */
+              0U,           1U,          71U,        2521U,       59711U,     1061761U,    15124775U,   179861305U,
+     1837271615U,
+    /* n = 37 */
+              0U,           1U,          73U,        2665U,       64897U,     1186369U,    17372905U,   212358985U,
+     2229491905U,
+    /* n = 38 */
+              0U,           1U,          75U,        2813U,       70375U,     1321641U,    19880915U,   249612805U,
+     2691463695U,
+    /* n = 39 */
+              0U,           1U,          77U,        2965U,       76153U,     1468169U,    22670725U,   292164445U,
+     3233240945U,
+    /* n = 40 */
+              0U,           1U,          79U,        3121U,       82239U,     1626561U,    25765455U,   340600625U,
+     3866006015U,
+    /* n = 41 */
+              0U,           1U,          81U,        3281U,       88641U,     1797441U,    29189457U,   395555537U,
+    /* n = 42 */
+              0U,           1U,          83U,        3445U,       95367U,     1981449U,    32968347U,   457713341U,
+    /* n = 43 */
+              0U,           1U,          85U,        3613U,      102425U,     2179241U,    37129037U,   527810725U,
+    /* n = 44 */
+              0U,           1U,          87U,        3785U,      109823U,     2391489U,    41699767U,   606639529U,
+    /* n = 45 */
+              0U,           1U,          89U,        3961U,      117569U,     2618881U,    46710137U,   695049433U,
+    /* n = 46 */
+              0U,           1U,          91U,        4141U,      125671U,     2862121U,    52191139U,   793950709U,
+    /* n = 47 */
+              0U,           1U,          93U,        4325U,      134137U,     3121929U,    58175189U,   904317037U,
+    /* n = 48 */
+              0U,           1U,          95U,        4513U,      142975U,     3399041U,    64696159U,  1027188385U,
+    /* n = 49 */
+              0U,           1U,          97U,        4705U,      152193U,     3694209U,    71789409U,  1163673953U,
+    /* n = 50 */
+              0U,           1U,          99U,        4901U,      161799U,     4008201U,    79491819U,  1314955181U,
+    /* n = 51 */
+              0U,           1U,         101U,        5101U,      171801U,     4341801U,    87841821U,  1482288821U,
+    /* n = 52 */
+              0U,           1U,         103U,        5305U,      182207U,     4695809U,    96879431U,  1667010073U,
+    /* n = 53 */
+              0U,           1U,         105U,        5513U,      193025U,     5071041U,   106646281U,  1870535785U,
+    /* n = 54 */
+              0U,           1U,         107U,        5725U,      204263U,     5468329U,   117185651U,  2094367717U,
+    /* n = 55 */
+              0U,           1U,         109U,        5941U,      215929U,     5888521U,   128542501U,  2340095869U,
+    /* n = 56 */
+              0U,           1U,         111U,        6161U,      228031U,     6332481U,   140763503U,  2609401873U,
+    /* n = 57 */
+              0U,           1U,         113U,        6385U,      240577U,     6801089U,   153897073U,  2904062449U,
+    /* n = 58 */
+              0U,           1U,         115U,        6613U,      253575U,     7295241U,   167993403U,  3225952925U,
+    /* n = 59 */
+              0U,           1U,         117U,        6845U,      267033U,     7815849U,   183104493U,  3577050821U,
+    /* n = 60 */
+              0U,           1U,         119U,        7081U,      280959U,     8363841U,   199284183U,  3959439497U,
+    /* n = 61 */
+              0U,           1U,         121U,        7321U,      295361U,     8940161U,   216588185U,
+    /* n = 62 */
+              0U,           1U,         123U,        7565U,      310247U,     9545769U,   235074115U,
+    /* n = 63 */
+              0U,           1U,         125U,        7813U,      325625U,    10181641U,   254801525U,
+    /* n = 64 */
+              0U,           1U,         127U,        8065U,      341503U,    10848769U,   275831935U
+};
+
+const Word16 pvq_a_row_fx[PVQ_MAX_BAND_SIZE+2] =   /* start of row n in pvq_a_tab_fx, n = 0..64, last entry is the table size */
+{
+        0,     0,     0,     0,    98,   196,   294,   392,   453,   494,   525,
+      550,   571,   590,   607,   623,   638,   652,   665,   678,   690,   702,
+      713,   724,   735,   746,   756,   766,   776,   786,   796,   806,   815,
+      824,   833,   842,   851,   860,   869,   878,   887,   896,   904,   912,
+      920,   928,   936,   944,   952,   960,   968,   976,   984,   992,  1000,
+     1008,  1016,  1024,  1032,  1040,  1048,  1056,  1063,  1070,  1077,  1084
+};
+
 
 const Word32 thren_fx[39] =   /* Q8 */
 {
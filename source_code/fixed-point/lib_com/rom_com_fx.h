@@ -173,6 +173,12 @@ extern const Word16 sigma_MSLVQ_fx[][16];
 
 extern const Word16 pi0_fx[];
 extern const Word32 table_no_cv_fx[];
+extern const Word32 offset_scale1_fx[MAX_NO_MODES+1][MAX_NO_SCALES+1];
+extern const Word32 offset_scale2_fx[MAX_NO_MODES+1][MAX_NO_SCALES+1];
+extern const Word32 offset_scale1_p_fx[MAX_NO_MODES_p+1][MAX_NO_SCALES+1];
+extern const Word32 offset_scale2_p_fx[MAX_NO_MODES_p+1][MAX_NO_SCALES+1];
+extern const Word16 no_scales_fx[MAX_NO_MODES][2];
+extern const Word16 no_scales_p_fx[MAX_NO_MODES_p][2];
 extern const Word16 pl_par_fx[];	       /* 1 if even number of signs */
 extern const Word16 C_VQ_fx[LATTICE_DIM+1][LATTICE_DIM+1];
 extern const Word16 no_vals_ind_fx[NO_LEADERS][MAX_NO_VALS];
@@ -631,6 +637,24 @@ extern const Word16 Asr_LP48_fx[61];
 extern const Word16 window_8_16_32kHz_fx[];
 extern const Word16 window_48kHz_fx[];
 extern const Word16 window_256kHz[];
+extern const Word16 window_aldo_1_160_fx[45];
+extern const PWord16 window_aldo_1_trunc_160_fx[35];
+extern const PWord16 window_aldo_2_160_fx[35];
+extern const Word16 window_aldo_1_256_fx[72];
+extern const PWord16 window_aldo_1_trunc_256_fx[56];
+extern const PWord16 window_aldo_2_256_fx[56];
+extern const Word16 window_aldo_1_320_fx[90];
+extern const PWord16 window_aldo_1_trunc_320_fx[70];
+extern const PWord16 window_aldo_2_320_fx[70];
+extern const Word16 window_aldo_1_512_fx[144];
+extern const PWord16 window_aldo_1_trunc_512_fx[112];
+extern const PWord16 window_aldo_2_512_fx[112];
+extern const Word16 window_aldo_1_640_fx[180];
+extern const PWord16 window_aldo_1_trunc_640_fx[140];
+extern const PWord16 window_aldo_2_640_fx[140];
+extern const Word16 window_aldo_1_960_fx[270];
+extern const PWord16 window_aldo_1_trunc_960_fx[210];
+extern const PWord16 window_aldo_2_960_fx[210];
 extern const Word16 half_overlap_25[];
 extern const Word16 half_overlap_48[];
 extern const Word16 half_overlap_int[];
@@ -744,6 +768,8 @@ extern const Word16 gain_cb_size[];
 
 /* PVQ tables */
 extern const UWord32 exactdivodd_fx[ODD_DIV_SIZE_FX];
+extern const UWord32 pvq_a_tab_fx[PVQ_A_TAB_SIZE_FX];
+extern const Word16 pvq_a_row_fx[PVQ_MAX_BAND_SIZE+2];
 
 
 
@@ -23,6 +23,7 @@ typedef struct
 {
     Word16 on;                            /* On/off flag           */
     Word16 reset;                         /* reset flag           */
+    Word16 bypass;                        /* bypass flag (decoder option) */
     Word16 mem_pf_in[L_SUBFR];                  /* Input memory          */
     Word16 mem_stp[L_SUBFR];              /*  1/A(gamma1) memory   */
     Word16 mem_res2[DECMEM_RES2];         /* A(gamma2) residual    */
@@ -178,9 +179,9 @@ typedef struct
     const PWord16 *tcx_mdct_window_half;
     const PWord16 *tcx_mdct_window_minimum;
     const PWord16 *tcx_mdct_window_trans;
-    Word16 tcx_aldo_window_1[L_FRAME32k*9/32];
-    PWord16 tcx_aldo_window_1_trunc[L_FRAME32k*7/32];
-    PWord16 tcx_aldo_window_2[L_FRAME32k*7/32];
+    const Word16 *tcx_aldo_window_1;
+    const PWord16 *tcx_aldo_window_1_trunc;
+    const PWord16 *tcx_aldo_window_2;
     Word16 last_aldo;
 
     Word16 tcx5Size;  /* Size of the TCX5 spectrum. Always 5ms. */
@@ -200,9 +201,9 @@ typedef struct
     const PWord16 *tcx_mdct_window_halfFB;
     const PWord16 *tcx_mdct_window_minimumFB;
     const PWord16 *tcx_mdct_window_transFB;
-    Word16 tcx_aldo_window_1_FB[L_FRAME_MAX*9/32];
-    PWord16 tcx_aldo_window_1_FB_trunc[L_FRAME_MAX*7/32];
-    PWord16 tcx_aldo_window_2_FB[L_FRAME_MAX*7/32];
+    const Word16 *tcx_aldo_window_1_FB;
+    const PWord16 *tcx_aldo_window_1_FB_trunc;
+    const PWord16 *tcx_aldo_window_2_FB;
 
     Word16 tcx5SizeFB;  /* Size of the TCX5 spectrum. Always 5ms. */
 
@@ -337,6 +338,16 @@ typedef struct
     Word16  cngNoiseLevelExp;
     Word16  seed;           /* Seed memory (for random function) */
 
+    Word32  sqrtNoiseLevel[FFTCLDFBLEN];     /* Square roots of cngNoiseLevel, kept between SID updates */
+    Word16  sqrtNoiseLevelExp[FFTCLDFBLEN];  /* Exponents of sqrtNoiseLevel */
+    Word32  sqrtNoiseLevelRef[FFTCLDFBLEN];  /* cngNoiseLevel the square roots were computed from */
+    Word16  sqrtNoiseLevelRefExp;            /* cngNoiseLevelExp the square roots were computed from */
+    Word16  sqrtNoiseLevelRefScale;          /* CLDFB scaling the square roots were computed with */
+    Word16  sqrtNoiseLevelStartBand;         /* startBand of the cached square roots */
+    Word16  sqrtNoiseLevelBins;              /* Number of cached FFT bins */
+    Word16  sqrtNoiseLevelBands;             /* Number of cached CLDFB bands */
+    Word16  sqrtNoiseLevelValid;             /* Flag indicating valid square roots */
+
     Word16  npart;          /* Number of partitions */
     Word16  midband[NPART];        /* Central band of each partition */
     Word16  nFFTpart;       /* Number of hybrid spectral partitions */
@@ -21,9 +21,9 @@ static void flip_spectrum_fx( const Word16 input[], Word16 output[], const Word1
 
 static void Calc_st_filt_tbe(Word16 * apond2,Word16 * apond1,Word16 * parcor0,Word16 * sig_ltp_ptr,Word16 * mem_zero );
 
-static void Hilbert_transform_fx( Word32 tmp_R[], Word32 tmp_I[], Word32 *tmpi_R, Word32 *tmpi_I, const Word16 length, const Word16 HB_stage_id );
+static void Hilbert_transform_cascade_fx( const Word16 x[], Word32 y1_R[], Word32 y1_I[], Word32 y3_R[], Word32 y3_I[], const Word16 length );
 
-static void Hilbert_transform_sp_fx(  Word16 tmp_R[], Word16 tmp_I[], Word32 *tmpi_R, Word32 *tmpi_I, const Word16 length, const Word16 HB_stage_id );
+static Word32 L_sat40_fx( const Word40 L40_var );
 
 void Estimate_mix_factors_fx( const Word16 *shb_res, const Word16 Q_shb, const Word16 *exc16kWhtnd, const Word16 Q_bwe_exc, const Word16 *White_exc16k_frac,
                               const Word16 Q_frac, const Word32 pow1, const Word16 Q_pow1, const Word32 pow22, const Word16 Q_pow22, Word16 *vf_modified, Word16 *vf_ind );
@@ -259,8 +259,6 @@ void flip_and_downmix_generic_fx( Word16 input[],   /* i : input spectrum Qx*/
 {
     Word16 i, j;
     Word16 tmp_16[L_FRAME32k + HILBERT_ORDER1];
-    Word32 tmpi_R[L_FRAME32k];
-    Word32 tmpi_I[L_FRAME32k];
     Word32 tmpi2_R[L_FRAME32k + HILBERT_ORDER2];
     Word32 tmpi2_I[L_FRAME32k + HILBERT_ORDER2];
     Word32 tmp_R[L_FRAME32k + HILBERT_ORDER2];
@@ -278,7 +276,7 @@ void flip_and_downmix_generic_fx( Word16 input[],   /* i : input spectrum Qx*/
                                     -19519,   -8739,   3212,   14732,   24279,   30571
                                    };   /* Q15 */
     Word16 *local_negsin_table, *local_cos_table;
-    Word32 L_tmp;
+    Word40 L_tmp;
 
     /* 1850 Hz downmix */
     period = 17;
@@ -301,52 +299,21 @@ void flip_and_downmix_generic_fx( Word16 input[],   /* i : input spectrum Qx*/
         tmp_16[i] = extract_h(mem1_ext[i]); /* mem1_ext (Qx+16) tmp16 (Qx) */
     }
 
-    /* Hilber transform stage - 0 - single precision */
-    Hilbert_transform_sp_fx(  tmp_16,                /* i: Real component of HB */
-                              tmp_16,                /* i: Imag component of HB */
-                              tmpi_R,                /* o: Real component of HB */
-                              tmpi_I,                /* o: Imag. component of HB */
-                              length,                /* i: length of the spectra */
-                              0);                    /* i: HB transform stage */
-
-    FOR (i=0; i<HILBERT_ORDER1; i++)
-    {
-        mem1_ext[i] = L_deposit_h(tmp_16[i+length]); /* mem1_ext (Qx+16) tmp16 (Qx) */
-    }
-
+    /* Hilbert transform stages 0..3, with the memories of the two denominator stages */
     Copy32( mem2_ext, tmpi2_R, HILBERT_ORDER2 );
     Copy32( mem3_ext, tmpi2_I, HILBERT_ORDER2 );
-
-    /* Hilber transform stage - 1 */
-    Hilbert_transform_fx( tmpi_R,             /* i: Real component of HB */
-                          tmpi_I,             /* i: Imag component of HB */
-                          tmpi2_R,            /* o: Real component of HB */
-                          tmpi2_I,            /* o: Imag. component of HB */
-                          length,             /* i: length of the spectra */
-                          1);                 /* i: HB transform stage */
-
     Copy32( mem2_ext+HILBERT_ORDER2, tmp_R, HILBERT_ORDER2 );
     Copy32( mem3_ext+HILBERT_ORDER2, tmp_I, HILBERT_ORDER2 );
 
-    /* Hilber transform stage - 2 */
-    Hilbert_transform_fx( tmpi2_R,            /* i: Real component of HB */
-                          tmpi2_I,            /* i: Imag component of HB */
-                          tmpi_R,             /* o: Real component of HB */
-                          tmpi_I,             /* o: Imag. component of HB */
-                          length,             /* i: length of the spectra */
-                          2);                 /* i: HB transform stage */
+    Hilbert_transform_cascade_fx( tmp_16, tmpi2_R, tmpi2_I, tmp_R, tmp_I, length );
+
+    FOR (i=0; i<HILBERT_ORDER1; i++)
+    {
+        mem1_ext[i] = L_deposit_h(tmp_16[i+length]); /* mem1_ext (Qx+16) tmp16 (Qx) */
+    }
 
     Copy32( tmpi2_R + length, mem2_ext, HILBERT_ORDER2 );
     Copy32( tmpi2_I + length, mem3_ext, HILBERT_ORDER2 );
-
-    /* Hilber transform stage - 3 */
-    Hilbert_transform_fx( tmpi_R,             /* i: Real component of HB */
-                          tmpi_I,             /* i: Imag component of HB */
-                          tmp_R,              /* o: Real component of HB */
-                          tmp_I,              /* o: Imag. component of HB */
-                          length,             /* i: length of the spectra */
-                          3);                 /* i: HB transform stage */
-
     Copy32( tmp_R + length, mem2_ext+HILBERT_ORDER2, HILBERT_ORDER2 );
     Copy32( tmp_I + length, mem3_ext+HILBERT_ORDER2, HILBERT_ORDER2 );
 
@@ -365,9 +332,10 @@ void flip_and_downmix_generic_fx( Word16 input[],   /* i : input spectrum Qx*/
     {
         WHILE ( ( j < period ) && ( i < length ) )
         {
-            L_tmp = Mult_32_16( tmp_R[i + 4], local_cos_table[j] ); /*//Qx+16 */
-            L_tmp = Madd_32_16( L_tmp, tmp_I[i + 4], local_negsin_table[j] ); /*Qx+16 */
-            output[i] = round_fx( L_tmp ); /*Qx */
+            /* round_fx( Madd_32_16( Mult_32_16( tmp_R[i + 4], cos ), tmp_I[i + 4], negsin ) ), Qx */
+            L_tmp = L_sat40_fx( (((Word40)tmp_R[i + 4] * local_cos_table[j]) >> 15)
+                                + (((Word40)tmp_I[i + 4] * local_negsin_table[j]) >> 15) );
+            output[i] = (Word16)(L_sat40_fx( L_tmp + 0x8000 ) >> 16);
             i++ ;
             j++ ;
         }
@@ -385,107 +353,104 @@ void flip_and_downmix_generic_fx( Word16 input[],   /* i : input spectrum Qx*/
 }
 
 
-/*----------------------------------------------
- * Hilbert transform - Double precision
- *------------------------------------------------*/
-static void Hilbert_transform_fx( Word32 tmp_R[],              /* i: Real component of HB */
-                                  Word32 tmp_I[],              /* i: Real component of HB */
-                                  Word32 tmpi_R[],             /* o: Real component of HB */
-                                  Word32 tmpi_I[],             /* o: Imag. component of HB */
-                                  const Word16 length,               /* i: input length */
-                                  const Word16 HB_stage_id           /* i: HB transform stage */
-                                )
+/*--------------------------------------------------------------------------
+ *  L_sat40_fx()
+ *
+ *  Saturate a 40-bit accumulator to 32 bits, as the BASOP operators do
+ *--------------------------------------------------------------------------*/
+static Word32 L_sat40_fx( const Word40 L40_var )
 {
-    Word16 i, hb_filter_stage, offset;
-    Word32 L_tmp;
-
-    hb_filter_stage = 2*HB_stage_id;
-    offset = 0;
-    move16();
-    if( HB_stage_id == 0 )
+    if ( L40_var > MAX_32 )
     {
-        offset = 1;
-        move16();
-    }
-
-    test();
-    test();
-    IF (HB_stage_id == 0 || HB_stage_id == 2)
-    {
-        FOR ( i = 0; i < length; i++ )
-        {
-            L_tmp     = Mult_32_16(        tmp_R[i + 4], Hilbert_coeffs_fx[hb_filter_stage][0 + offset] ); /*Qx+15 */
-            L_tmp     = Madd_32_16( L_tmp, tmp_R[i + 2], Hilbert_coeffs_fx[hb_filter_stage][2 + offset] ); /*Qx+15 */
-            L_tmp     = Madd_32_16( L_tmp, tmp_R[i]    , Hilbert_coeffs_fx[hb_filter_stage][4 + offset] );/*Qx+15 */
-            tmpi_R[i] = L_shl( L_tmp, 1 );
-            move32(); /*Qx+16 */
-
-            L_tmp     = Mult_32_16(        tmp_I[i + 4 + offset], Hilbert_coeffs_fx[hb_filter_stage+1][0] ); /*Qx+15 */
-            L_tmp     = Madd_32_16( L_tmp, tmp_I[i + 2 + offset], Hilbert_coeffs_fx[hb_filter_stage+1][2] ); /*Qx+15 */
-            L_tmp     = Madd_32_16( L_tmp, tmp_I[i + offset]    , Hilbert_coeffs_fx[hb_filter_stage+1][4] ); /*Qx+15 */
-            tmpi_I[i] = L_shl( L_tmp, 1 );
-            move32(); /*Qx+16 */
-        }
+        return MAX_32;
     }
-    ELSE IF (HB_stage_id == 1 || HB_stage_id == 3)
+    if ( L40_var < MIN_32 )
     {
-        FOR ( i = 0; i < length; i++ )
-        {
-
-            L_tmp           = Mult_32_16(        tmpi_R[i + 2], Hilbert_coeffs_fx[hb_filter_stage][2] ); /*Qx+15 */
-            L_tmp           = Madd_32_16( L_tmp, tmpi_R[i]    , Hilbert_coeffs_fx[hb_filter_stage][4] ); /*Qx+15 */
-            tmpi_R[i + 4]   = L_sub( tmp_R[i], L_shl( L_tmp, 1 ) );
-            move32();/*Qx+16 */
-
-            L_tmp           = Mult_32_16(        tmpi_I[i + 2], Hilbert_coeffs_fx[hb_filter_stage+1][2] ); /*Qx+15 */
-            L_tmp           = Madd_32_16( L_tmp, tmpi_I[i]    , Hilbert_coeffs_fx[hb_filter_stage+1][4] ); /*Qx+15 */
-            tmpi_I[i + 4]   = L_sub( tmp_I[i], L_shl( L_tmp, 1 ) );
-            move32(); /*Qx+16 */
-        }
+        return MIN_32;
     }
+    return (Word32) L40_var;
 }
 
 
 /*----------------------------------------------
-* Hilbert transform - Single precision Stage 0
-*------------------------------------------------*/
-static void Hilbert_transform_sp_fx( Word16 tmp_R[],              /* i: Real component of HB */
-                                     Word16 tmp_I[],              /* i: Real component of HB */
-                                     Word32 tmpi_R[],             /* o: Real component of HB */
-                                     Word32 tmpi_I[],             /* o: Imag. component of HB */
-                                     const Word16 length,               /* i: input length */
-                                     const Word16 HB_stage_id           /* i: HB transform stage */
-                                   )
+ * Hilbert transform - all stages
+ *
+ * Runs the single precision stage 0 and the double
+ * precision stages 1..3 in one pass over the frame:
+ * stages 0 and 2 are FIR sections, stages 1 and 3
+ * recursive sections with taps at lags 2 and 4.
+ * Each sample goes through all four sections before
+ * the next one, which keeps the recursions of the
+ * two denominator stages interleaved and avoids the
+ * intermediate buffers.
+ *
+ * Rounding and saturation follow the basic operators
+ * of the stage-wise version (L_mult/L_mac for stage 0,
+ * Mult_32_16/Madd_32_16/L_shl/L_sub for stages 1..3);
+ * the products are exact as no coefficient is -1.
+ *------------------------------------------------*/
+static void Hilbert_transform_cascade_fx(
+    const Word16 x[],          /* i  : input, HILBERT_ORDER1 samples of memory first, Qx */
+    Word32 y1_R[],             /* i/o: real part after stage 1, HILBERT_ORDER2 samples of memory first, Qx+16 */
+    Word32 y1_I[],             /* i/o: imag part after stage 1, HILBERT_ORDER2 samples of memory first, Qx+16 */
+    Word32 y3_R[],             /* i/o: real part after stage 3, HILBERT_ORDER2 samples of memory first, Qx+16 */
+    Word32 y3_I[],             /* i/o: imag part after stage 3, HILBERT_ORDER2 samples of memory first, Qx+16 */
+    const Word16 length        /* i  : input length */
+)
 {
-    Word16 i, hb_filter_stage, offset;
-    Word32 L_tmp;
-
-    hb_filter_stage = shl(HB_stage_id,1);
-    offset = 0;
-    move16();
-    if( HB_stage_id == 0 )
-    {
-        offset = 1;
-        move16();
-    }
+    Word16 i;
+    Word32 r, m;
+    const Word16 *num0_R, *num0_I, *den0_R, *den0_I, *num1_R, *num1_I, *den1_R, *den1_I;
+
+    num0_R = Hilbert_coeffs_fx[0];
+    num0_I = Hilbert_coeffs_fx[1];
+    den0_R = Hilbert_coeffs_fx[2];
+    den0_I = Hilbert_coeffs_fx[3];
+    num1_R = Hilbert_coeffs_fx[4];
+    num1_I = Hilbert_coeffs_fx[5];
+    den1_R = Hilbert_coeffs_fx[6];
+    den1_I = Hilbert_coeffs_fx[7];
 
-    /* Hilbert single precision stage 0 */
     FOR ( i = 0; i < length; i++ )
     {
-        L_tmp     = L_mult(        tmp_R[i + 4], Hilbert_coeffs_fx[hb_filter_stage][0 + offset] ); /*Qx */
-        L_tmp     = L_mac ( L_tmp, tmp_R[i + 2], Hilbert_coeffs_fx[hb_filter_stage][2 + offset] ); /*Qx */
-        L_tmp     = L_mac ( L_tmp, tmp_R[i]    , Hilbert_coeffs_fx[hb_filter_stage][4 + offset] ); /*Qx */
-        tmpi_R[i] = L_shl ( L_tmp, 1 );
-        move32(); /*Qx+16 */
+        /* stage 0 (single precision), real part */
+        r = L_sat40_fx( 2 * ((Word40)x[i + 4] * num0_R[1] + (Word40)x[i + 2] * num0_R[3]) );
+        r = L_sat40_fx( (Word40)r + 2 * (Word40)x[i] * num0_R[5] );
+        r = L_sat40_fx( 2 * (Word40)r );
 
-        L_tmp     = L_mult(        tmp_I[i + 4 + offset], Hilbert_coeffs_fx[hb_filter_stage+1][0] ); /*Qx */
-        L_tmp     = L_mac ( L_tmp, tmp_I[i + 2 + offset], Hilbert_coeffs_fx[hb_filter_stage+1][2] ); /*Qx */
-        L_tmp     = L_mac ( L_tmp, tmp_I[i + offset]    , Hilbert_coeffs_fx[hb_filter_stage+1][4] ); /*Qx */
-        tmpi_I[i] = L_shl ( L_tmp, 1 );
-        move32(); /*Qx+16 */
-    }
+        /* stage 1, real part */
+        m = L_sat40_fx( (((Word40)y1_R[i + 2] * den0_R[2]) >> 15) + (((Word40)y1_R[i] * den0_R[4]) >> 15) );
+        y1_R[i + 4] = L_sat40_fx( (Word40)r - L_sat40_fx( 2 * (Word40)m ) );
+        move32();
 
-    return;
+        /* stage 0 (single precision), imaginary part */
+        r = L_sat40_fx( 2 * ((Word40)x[i + 5] * num0_I[0] + (Word40)x[i + 3] * num0_I[2]) );
+        r = L_sat40_fx( (Word40)r + 2 * (Word40)x[i + 1] * num0_I[4] );
+        r = L_sat40_fx( 2 * (Word40)r );
+
+        /* stage 1, imaginary part */
+        m = L_sat40_fx( (((Word40)y1_I[i + 2] * den0_I[2]) >> 15) + (((Word40)y1_I[i] * den0_I[4]) >> 15) );
+        y1_I[i + 4] = L_sat40_fx( (Word40)r - L_sat40_fx( 2 * (Word40)m ) );
+        move32();
+
+        /* stage 2 and 3, real part */
+        r = L_sat40_fx( (((Word40)y1_R[i + 4] * num1_R[0]) >> 15) + (((Word40)y1_R[i + 2] * num1_R[2]) >> 15) );
+        r = L_sat40_fx( (Word40)r + (((Word40)y1_R[i] * num1_R[4]) >> 15) );
+        r = L_sat40_fx( 2 * (Word40)r );
+
+        m = L_sat40_fx( (((Word40)y3_R[i + 2] * den1_R[2]) >> 15) + (((Word40)y3_R[i] * den1_R[4]) >> 15) );
+        y3_R[i + 4] = L_sat40_fx( (Word40)r - L_sat40_fx( 2 * (Word40)m ) );
+        move32();
+
+        /* stage 2 and 3, imaginary part */
+        r = L_sat40_fx( (((Word40)y1_I[i + 4] * num1_I[0]) >> 15) + (((Word40)y1_I[i + 2] * num1_I[2]) >> 15) );
+        r = L_sat40_fx( (Word40)r + (((Word40)y1_I[i] * num1_I[4]) >> 15) );
+        r = L_sat40_fx( 2 * (Word40)r );
+
+        m = L_sat40_fx( (((Word40)y3_I[i + 2] * den1_I[2]) >> 15) + (((Word40)y3_I[i] * den1_I[4]) >> 15) );
+        y3_I[i + 4] = L_sat40_fx( (Word40)r - L_sat40_fx( 2 * (Word40)m ) );
+        move32();
+    }
 }
 
 
@@ -32,6 +32,12 @@ Word32 ar_div(Word32 num, Word32 denum)
     {
         return 1;
     }
+    ELSE IF (L_sub(num, 0x40000000) < 0)
+    {
+        /* The shift-and-subtract loop below cannot saturate while num < 2^30
+           and then yields the truncated quotient */
+        varout = num / denum;
+    }
     ELSE
     {
         exp1 = norm_l(num);
@@ -65,6 +71,18 @@ Word32 ar_div(Word32 num, Word32 denum)
     return varout;
 }
 
+/* div_l( L_deposit_h(num), den ) for 0 <= num and 0 < den: the restoring
+   division then returns floor(num * 2^15 / den), or MAX_16 when num >= den */
+static Word16 div_frac_fx( Word16 num, Word16 den )
+{
+    IF ( sub(num, den) >= 0 )
+    {
+        return MAX_16;
+    }
+
+    return (Word16)( L_deposit_h(num) / L_shl(den, 1) );
+}
+
 static void bitstream_save_bit(PBITSTREAM_FX pBS, Word32 bit)
 {
     UWord8 cur;
@@ -494,97 +512,108 @@ void TCQnew_fx( Word32 *v_fx, Word32 scale_fx, Word16 Qscale,
     Word16 path_fx[STATES][TCQ_MAX_BAND_SIZE];
     Word16 quant_fx[STATES][TCQ_MAX_BAND_SIZE];
     Word16 pused_fx[STATES][TCQ_MAX_BAND_SIZE];
+    Word16 quantD_fx[4], distD_fx[4];
     Word16 quantum1_fx, quantum2_fx, newdist1_fx, newdist2_fx/*, signq_fx*/;
+    Word16 prev1, prev2, D;
     Word32 /*scale_fx, */tmp32, dmin_fx, curdist1_fx, curdist2_fx;
-    Word16 value_fx, exp;
+    Word16 value_fx, scale_hi, exp;
     Word16 exp1, exp2;
 
-    set32_fx(*metric_fx, 0, STATES * TCQ_MAX_BAND_SIZE);
-    set16_fx( *path_fx, 0, STATES*TCQ_MAX_BAND_SIZE );
-    set16_fx( *quant_fx, 0, STATES*TCQ_MAX_BAND_SIZE );
-    set16_fx( *pused_fx, 0, STATES*TCQ_MAX_BAND_SIZE );
-
-    /* Initialize metric */
+    /* Only the first column has to be set: every later column of
+       metric/path/quant/pused is written for all states before it is read */
+    metric_fx[0][0] = 0;
+    move32();
+    pused_fx[0][0] = 0;
+    move16();
     FOR ( st = 1; st < STATES; st++)
     {
         metric_fx[st][0] = MAX_32>>1;
         move32();
+        pused_fx[st][0] = 0;
+        move16();
     }
-    FOR ( st = 2; st < STATES; st++)
-    {
-        metric_fx[st][1] = MAX_32>>1;
-        move32();
-    }
-    FOR ( st = 4; st < STATES; st++)
-    {
-        metric_fx[st][2] = MAX_32>>1;
-        move32();
-    }
+
+    /* Scale normalization does not depend on the symbol */
+    exp = norm_l(scale_fx);
+    scale_hi = extract_h(L_shl(scale_fx, exp));
+    exp1 = 26-(exp-19+Qscale);
+
     /* Viterbi for input sequence */
     FOR ( i = 0; i < length; i++) /* cycle over symbols */
     {
+        tmp32 = Mult_32_16(v_fx[i], scale_hi);/*12 + 20 + exp - 16 - 15 + Qscale */
+        exp2 = norm_l(tmp32);
+        IF( sub(exp2, exp1) >= 0 )
+        {
+            value_fx = extract_h(L_shl(tmp32, sub(26, add(sub(exp, 19), Qscale))));/*exp -19 + Qscale*/ /*10*/
+        }
+        ELSE
+        {
+            value_fx = extract_h(L_shl(tmp32, exp2));/*exp -19 + Qscale*/ /*10*/
+        }
+
+        /* The value and hence its quantization and distance only depend on the
+           union offset D, so the four candidates are computed once per symbol */
+        FOR ( D = 0; D < 4; D++ )
+        {
+            quantD_fx[D] = quantize_fx(value_fx, D);
+            move16();
+            distD_fx[D] = sub(shl(quantD_fx[D], 10), abs_s(value_fx));/*10*/
+            distD_fx[D] = mult(distD_fx[D], distD_fx[D]); /* 5 */
+            move16();
+        }
+
+        /* Add-compare-select over the states: quantum <= 35 and metrics stay
+           below (MAX_32>>1) + TCQ_MAX_BAND_SIZE*MAX_16, so no operation saturates */
         FOR ( st = 0; st < STATES; st++) /* cycle over conditions */
         {
-            curdist1_fx = L_add(metric_fx[ step_tcq_fx[st][0]][i], 0);
-            curdist2_fx = L_add(metric_fx[ step_tcq_fx[st][1]][i], 0);
+            prev1 = step_tcq_fx[st][0];
+            prev2 = step_tcq_fx[st][1];
+            curdist1_fx = metric_fx[prev1][i];
+            curdist2_fx = metric_fx[prev2][i];
 
-            exp = norm_l(scale_fx);
-            tmp32 = L_shl(scale_fx, exp);
-            tmp32 = Mult_32_16(v_fx[i], extract_h(tmp32));/*12 + 20 + exp - 16 - 15 + Qscale */
-            exp1 = 26-(exp-19+Qscale);
-            exp2 = norm_l(tmp32);
-            IF( sub(exp2, exp1) >= 0 )
-            {
-                value_fx = extract_h(L_shl(tmp32, sub(26, add(sub(exp, 19), Qscale))));/*exp -19 + Qscale*/ /*10*/
-            }
-            ELSE
-            {
-                value_fx = extract_h(L_shl(tmp32, exp2));/*exp -19 + Qscale*/ /*10*/
-            }
             /* step 1 */
-            quantum1_fx = quantize_fx(value_fx, denc_fx[st][0]);
-            newdist1_fx = sub(shl(quantum1_fx, 10), abs_s(value_fx));/*10*/
-            newdist1_fx = mult(newdist1_fx, newdist1_fx); /* 5 */
-
+            quantum1_fx = quantD_fx[denc_fx[st][0]];
+            newdist1_fx = distD_fx[denc_fx[st][0]];
             test();
-            if (sub(add(quantum1_fx , pused_fx[step_tcq_fx[st][0]][i]), pulses) > 0 && terminate)
+            if (quantum1_fx + pused_fx[prev1][i] > pulses && terminate)
             {
                 newdist1_fx = MAX_16;
                 move16();
             }
             /* step 2 */
-            quantum2_fx = quantize_fx(value_fx, denc_fx[st][1]);
-            newdist2_fx = sub(shl(quantum2_fx, 10), abs_s(value_fx));/*10*/
-            newdist2_fx = mult(newdist2_fx, newdist2_fx);/*5*/
-
+            quantum2_fx = quantD_fx[denc_fx[st][1]];
+            newdist2_fx = distD_fx[denc_fx[st][1]];
             test();
-            if (sub(add(quantum2_fx , pused_fx[step_tcq_fx[st][1]][i]), pulses) > 0 && terminate)
+            if (quantum2_fx + pused_fx[prev2][i] > pulses && terminate)
             {
                 newdist2_fx = MAX_16;
                 move16();
             }
 
             /* decision */
-            IF (L_sub(L_add(curdist1_fx, newdist1_fx), L_add(curdist2_fx, newdist2_fx)) < 0)
+            curdist1_fx += newdist1_fx;
+            curdist2_fx += newdist2_fx;
+            IF (curdist1_fx < curdist2_fx)
             {
-                path_fx[st][i+1] = step_tcq_fx[st][0];
+                path_fx[st][i+1] = prev1;
                 move16();
-                metric_fx[st][i+1] = L_add(curdist1_fx, newdist1_fx);
+                metric_fx[st][i+1] = curdist1_fx;
                 move32();
-                quant_fx[st][i+1] = quantize_fx(value_fx, denc_fx[st][0]);
+                quant_fx[st][i+1] = quantum1_fx;
                 move16();
-                pused_fx[st][i+1] = add(pused_fx[ step_tcq_fx[st][0]][i], abs_s( quant_fx[st][i+1] ));
+                pused_fx[st][i+1] = pused_fx[prev1][i] + quantum1_fx;
                 move16();
             }
             ELSE
             {
-                path_fx[st][i+1] = step_tcq_fx[st][1];
+                path_fx[st][i+1] = prev2;
                 move16();
-                metric_fx[st][i+1] = L_add(curdist2_fx, newdist2_fx);
+                metric_fx[st][i+1] = curdist2_fx;
                 move32();
-                quant_fx[st][i+1] = quantize_fx(value_fx, denc_fx[st][1]);
+                quant_fx[st][i+1] = quantum2_fx;
                 move16();
-                pused_fx[st][i+1] = add(pused_fx[ step_tcq_fx[st][1]][i], abs_s( quant_fx[st][i+1] ));
+                pused_fx[st][i+1] = pused_fx[prev2][i] + quantum2_fx;
                 move16();
             }
         }
@@ -1675,7 +1704,7 @@ Word32 encode_position_ari_fx(PARCODEC_FX parenc, Word16* quants, Word16 size, W
             }
             ELSE
             {
-                cp = L_sub( fxone, div_l( L_deposit_h(nz), (size - i)) );
+                cp = L_sub( fxone, div_frac_fx( nz, size - i ) );
             }
             scp = Mult_32_16( scp, extract_l(cp) );
             model_num_nz[pos+1] = round_fx( L_shl( scp, 6) );
@@ -1722,7 +1751,7 @@ Word32 encode_position_ari_fx(PARCODEC_FX parenc, Word16* quants, Word16 size, W
         move16();
         FOR( i = 0; i < size; i++)
         {
-            model_num_nz[i+1] = round_fx( L_shr( L_deposit_h( div_l( L_deposit_h(size - i - 1), size)), 1) );
+            model_num_nz[i+1] = round_fx( L_shr( L_deposit_h( div_frac_fx( size - i - 1, size )), 1) );
 
             if( cur_quants[i] != 0 )
             {
@@ -1798,7 +1827,7 @@ Word32 encode_magnitude_usq_fx(ARCODEC_FX* parenc, Word16* magn_fx, Word16 size,
         }
         ELSE
         {
-            cp = L_sub( fxone, div_l( L_deposit_h(magnzp), magnp) );
+            cp = L_sub( fxone, div_frac_fx( magnzp, magnp ) );
         }
         scp = Mult_32_16( scp, extract_l(cp) );
         model_m[pos+1] = round_fx( L_shl( scp, 6) );
@@ -2028,7 +2057,7 @@ void decode_position_ari_fx(PARCODEC_FX pardec, Word16 size, Word16 npulses, Wor
             move16();
             FOR (i = 0; i < size; i ++)
             {
-                mode_num_nz[i+1] = round_fx( L_shr( L_deposit_h( div_l( L_deposit_h(size - i - 1), size)), 1) );
+                mode_num_nz[i+1] = round_fx( L_shr( L_deposit_h( div_frac_fx( size - i - 1, size )), 1) );
             }
 
             position[ ar_decode_fx(pardec, mode_num_nz) ] = 1;
@@ -2058,7 +2087,7 @@ void decode_position_ari_fx(PARCODEC_FX pardec, Word16 size, Word16 npulses, Wor
                     }
                     ELSE
                     {
-                        cp = L_sub( fxone, div_l( L_deposit_h(nzp), (size - i)) );
+                        cp = L_sub( fxone, div_frac_fx( nzp, size - i ) );
                     }
                     scp = Mult_32_16( scp, extract_l(cp) );
                     mode_num_nz[i+1-storepos-stpos] = round_fx( L_shl( scp, 6) );
@@ -2116,7 +2145,7 @@ void decode_position_ari_fx(PARCODEC_FX pardec, Word16 size, Word16 npulses, Wor
         move16();
         FOR (i = 0; i < size; i ++)
         {
-            mode_num_nz[i+1] = round_fx( L_shr( L_deposit_h( div_l( L_deposit_h(size - i - 1), size)), 1) );
+            mode_num_nz[i+1] = round_fx( L_shr( L_deposit_h( div_frac_fx( size - i - 1, size )), 1) );
         }
 
         position[ ar_decode_fx(pardec, mode_num_nz) ] = 1;
@@ -2197,7 +2226,7 @@ void decode_magnitude_usq_fx(ARCODEC_FX* pardec, Word16 size, Word16 npulses, Wo
                 }
                 ELSE
                 {
-                    cp = L_sub( fxone, div_l( L_deposit_h(magnzp), magnp-i) );
+                    cp = L_sub( fxone, div_frac_fx( magnzp, magnp-i ) );
                 }
 
                 IF( cp == fxone )
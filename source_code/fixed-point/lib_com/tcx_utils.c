@@ -1624,7 +1624,7 @@ void init_TCX_config(TCX_config *tcx_cfg,
     mdct_window_sine( &tcx_cfg->tcx_mdct_window_transFB, tcx_cfg->tcx_mdct_window_trans_lengthFB );
 
     /*ALDO windows for MODE2*/
-    mdct_window_aldo(tcx_cfg->tcx_aldo_window_1, tcx_cfg->tcx_aldo_window_1_trunc, tcx_cfg->tcx_aldo_window_2, L_frame);
-    mdct_window_aldo(tcx_cfg->tcx_aldo_window_1_FB, tcx_cfg->tcx_aldo_window_1_FB_trunc, tcx_cfg->tcx_aldo_window_2_FB, L_frameTCX);
+    mdct_window_aldo(&tcx_cfg->tcx_aldo_window_1, &tcx_cfg->tcx_aldo_window_1_trunc, &tcx_cfg->tcx_aldo_window_2, L_frame);
+    mdct_window_aldo(&tcx_cfg->tcx_aldo_window_1_FB, &tcx_cfg->tcx_aldo_window_1_FB_trunc, &tcx_cfg->tcx_aldo_window_2_FB, L_frameTCX);
 }
 
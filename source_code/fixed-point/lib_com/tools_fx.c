@@ -87,16 +87,51 @@ Word32 Dot_product(     /* o  : Sum              */
     const Word16 y[],   /* i  : 12bits: y vector */
     const Word16 lg     /* i  : vector length    */
 )
+{
+    return Dot_product_mac(1L, x, y, lg);
+}
+
+/*-------------------------------------------------------------------*
+* Dot_product_mac:
+*
+* Bit-exact equivalent of L_sum = L_mac(L_sum, x[i], y[i]), i = 0..lg-1.
+* The chain can only saturate if one of the partial sums leaves the
+* 32-bit range, which cannot happen while |L_sum| + SUM(|2*x[i]*y[i]|)
+* stays within MAX_32. That bound is checked on the fly with a wide
+* accumulator; the saturating recurrence is only run when it fails.
+*-------------------------------------------------------------------*/
+Word32 Dot_product_mac(     /* o  : L_sum + <x,y>, as chained L_mac() */
+    const Word32 L_sum,     /* i  : initial accumulator               */
+    const Word16 x[],       /* i  : x vector                          */
+    const Word16 y[],       /* i  : y vector                          */
+    const Word16 lg         /* i  : vector length                     */
+)
 {
     Word16 i;
-    Word32 L_sum;
+    Word32 L_prod, L_acc;
+    Word40 L40_sum, L40_abs;
 
-    L_sum = L_mac(1L, x[0], y[0]);
-    FOR (i = 1; i < lg; i++)
+    L40_sum = 0;
+    L40_abs = 0;
+    FOR (i = 0; i < lg; i++)
     {
-        L_sum = L_mac(L_sum, x[i], y[i]);
+        L_prod = (Word32) x[i] * (Word32) y[i];
+        L40_sum += L_prod;
+        L40_abs += (L_prod < 0) ? -L_prod : L_prod;
     }
-    return L_sum;
+
+    L40_abs = 2 * L40_abs + ((L_sum < 0) ? -(Word40) L_sum : (Word40) L_sum);
+    IF (L40_abs <= MAX_32)
+    {
+        return (Word32) (L_sum + 2 * L40_sum);
+    }
+
+    L_acc = L_sum;
+    FOR (i = 0; i < lg; i++)
+    {
+        L_acc = L_mac(L_acc, x[i], y[i]);
+    }
+    return L_acc;
 }
 /*---------------------------------------------------------------------*
  * dotp_fx()
@@ -895,6 +930,35 @@ Word16 std_fx(                       /* o: standard deviation
     return extract_h(stdev);
 }
 
+/*-------------------------------------------------------------------*
+ * Madd_32_16_nocall()
+ *
+ * Madd_32_16() without the basic-op calls: the 32x16 product is exact
+ * in 40 bits, it is only clipped for MIN_32 * MIN_16, and the sum
+ * saturates to 32 bits as L_add() does.
+ *-------------------------------------------------------------------*/
+static Word32 Madd_32_16_nocall(Word32 L_num, Word32 a, Word16 b)
+{
+    Word40 L40_tmp;
+
+    L40_tmp = ((Word40) a * b) >> 15;
+    if (L40_tmp > MAX_32)
+    {
+        L40_tmp = MAX_32;
+    }
+    L40_tmp += L_num;
+    if (L40_tmp > MAX_32)
+    {
+        L40_tmp = MAX_32;
+    }
+    if (L40_tmp < MIN_32)
+    {
+        L40_tmp = MIN_32;
+    }
+
+    return (Word32) L40_tmp;
+}
+
 Word32 dot_product_mat_fx(    /* o  : the dot product x'*A*x        */
     const Word16  *x,      /* i  : vector x                     Q15 */
     const Word32  *A,      /* i  : matrix A                     Q0*/
@@ -916,11 +980,11 @@ Word32 dot_product_mat_fx(    /* o  : the dot product x'*A*x        */
         pt_x = x;
         FOR(j=0; j<m; j++)
         {
-            tmp_sum = Madd_32_16(tmp_sum,*pt_A,*pt_x);   /*Q0 */
+            tmp_sum = Madd_32_16_nocall(tmp_sum,*pt_A,*pt_x);   /*Q0 */
             pt_A++;
             pt_x++;
         }
-        suma = Madd_32_16(suma,tmp_sum,x[i]);          /*Q0 */
+        suma = Madd_32_16_nocall(suma,tmp_sum,x[i]);          /*Q0 */
     }
     return suma;
 }
@@ -180,7 +180,7 @@ Word16 ACcontextMapping_decode2_no_mem_s17_LC(
             assert(tmp >= 0 && tmp < 4096);
             pki = ari_lookup_s17_LC[tmp];
             move16();
-            r = ari_decode_14bits_s17_ext(st, &as, ari_pk_s17_LC_ext[pki]);
+            r = ari_decode_14bits_s17_LC(st, &as, pki);
 
             IF (sub(r, VAL_ESC) < 0)
             {
@@ -26,6 +26,9 @@ struct EVS_RX
     Word16                   samplesPerMs;              /* sampleRate / 1000 */
     PCMDSP_APA_HANDLE        hTimeScaler;
     PCMDSP_FIFO_HANDLE       hFifoAfterTimeScaler;
+    Word32                   nDecoded;                  /* frame statistics, not instrumented */
+    Word32                   nConcealed;
+    Word32                   nPartialCopy;
 #ifdef SUPPORT_JBM_TRACEFILE
     FILE                    *jbmTraceFile;
 #endif
@@ -334,6 +337,20 @@ EVS_RX_GetSamples(EVS_RX_HANDLE hEvsRX,
             read_indices_from_djb_fx( st, NULL, 0, 0, 0 );
         }
 
+        /* frame statistics (not instrumented) */
+        if( st->codec_mode != 0 )
+        {
+            hEvsRX->nDecoded++;
+            if( dataUnit != NULL && dataUnit->partial_frame != 0 )
+            {
+                hEvsRX->nPartialCopy++;
+            }
+            else if( st->bfi_fx == 1 )
+            {
+                hEvsRX->nConcealed++;
+            }
+        }
+
         /* run the main decoding routine */
         SUB_WMOPS_INIT("evs_dec");
         IF( sub(st->codec_mode, MODE1) == 0 )
@@ -344,25 +361,33 @@ EVS_RX_GetSamples(EVS_RX_HANDLE hEvsRX,
             }
             ELSE
             {
-                evs_dec_fx( st, pcmBuf, FRAMEMODE_NORMAL );
+                result = evs_dec_fx( st, pcmBuf, FRAMEMODE_NORMAL );
             }
         }
         ELSE IF( sub(st->codec_mode, MODE2) == 0 )
         {
             IF(st->bfi_fx == 0)
             {
-                evs_dec_fx(st, pcmBuf, FRAMEMODE_NORMAL);
+                result = evs_dec_fx(st, pcmBuf, FRAMEMODE_NORMAL);
             }
             ELSE IF ( sub(st->bfi_fx,2) == 0 )
             {
-                evs_dec_fx(st, pcmBuf, FRAMEMODE_FUTURE);   /* FRAMEMODE_FUTURE */
+                result = evs_dec_fx(st, pcmBuf, FRAMEMODE_FUTURE);   /* FRAMEMODE_FUTURE */
             }
             ELSE /* conceal */
             {
-                evs_dec_fx(st, pcmBuf, FRAMEMODE_MISSING);
+                result = evs_dec_fx(st, pcmBuf, FRAMEMODE_MISSING);
             }
         }
         END_SUB_WMOPS;
+        IF( result != 0 )
+        {
+            if( dataUnit != NULL )
+            {
+                JB4_FreeDataUnit(hEvsRX->hJBM, dataUnit);
+            }
+            return EVS_RX_MEMORY_ERROR;
+        }
         test();
         IF( sub(st->codec_mode, MODE1) == 0 || sub(st->codec_mode, MODE2) == 0 )
         {
@@ -473,6 +498,15 @@ EVS_RX_Get_FEC_offset( EVS_RX_HANDLE hEvsRX, Word16 *offset, Word16 *FEC_hi)
     return 0;
 }
 
+/* Returns the frame statistics of the receiver. */
+void
+EVS_RX_GetStatistics(EVS_RX_HANDLE hEvsRX, Word32 *nDecoded, Word32 *nConcealed, Word32 *nPartialCopy)
+{
+    /* statistics are only collected for the application and not instrumented */
+    *nDecoded = hEvsRX->nDecoded;
+    *nConcealed = hEvsRX->nConcealed;
+    *nPartialCopy = hEvsRX->nPartialCopy;
+}
 
 /* Returns 1 if the jitter buffer is empty, otherwise 0. */
 Word8
@@ -69,6 +69,10 @@ EVS_RX_GetSamples(EVS_RX_HANDLE hEvsRX,
 Word16
 EVS_RX_Get_FEC_offset( EVS_RX_HANDLE hEvsRX, Word16 *offset, Word16 *FEC_hi);
 
+/*! Returns the number of frames decoded so far, of those concealed and of those recovered from a partial copy. */
+void
+EVS_RX_GetStatistics(EVS_RX_HANDLE hEvsRX, Word32 *nDecoded, Word32 *nConcealed, Word32 *nPartialCopy);
+
 /*! Returns 1 if the jitter buffer is empty, otherwise 0. */
 /*  Intended for flushing at the end of the main loop but not during normal operation! */
 Word8
@@ -170,7 +170,7 @@ void HQ_FEC_processing_fx(
             {
                 FOR (i=0; i < output_frame; i++)
                 {
-                    t_audio_q_fx[i] = st_fx->old_coeffs_fx[i];
+                    t_audio_q_fx[i] = st_fx->hHqFec->old_coeffs_fx[i];
                     move32();
                 }
             }
@@ -178,8 +178,8 @@ void HQ_FEC_processing_fx(
             {
                 FOR (i=0; i < output_frame; i++)
                 {
-                    st_fx->old_coeffs_fx[i] = Mult_32_16(st_fx->old_coeffs_fx[i], 23170);/*23170, 3dB, Q15*/
-                    t_audio_q_fx[i] = st_fx->old_coeffs_fx[i];
+                    st_fx->hHqFec->old_coeffs_fx[i] = Mult_32_16(st_fx->hHqFec->old_coeffs_fx[i], 23170);/*23170, 3dB, Q15*/
+                    t_audio_q_fx[i] = st_fx->hHqFec->old_coeffs_fx[i];
                     move32();
                 }
             }
@@ -234,8 +234,8 @@ void HQ_FEC_processing_fx(
             {
                 FOR (i=0; i < output_frame; i++)
                 {
-                    st_fx->old_coeffs_fx[i] = Mult_32_16(st_fx->old_coeffs_fx[i], 23170);
-                    t_audio_q_fx[i] = st_fx->old_coeffs_fx[i];
+                    st_fx->hHqFec->old_coeffs_fx[i] = Mult_32_16(st_fx->hHqFec->old_coeffs_fx[i], 23170);
+                    t_audio_q_fx[i] = st_fx->hHqFec->old_coeffs_fx[i];
                     move32();
                 }
             }
@@ -243,22 +243,22 @@ void HQ_FEC_processing_fx(
             {
                 FOR (i = 0; i < RANDOM_START*8; i++)
                 {
-                    st_fx->old_coeffs_fx[i] = Mult_32_16(st_fx->old_coeffs_fx[i], 23170);
-                    t_audio_q_fx[i] = st_fx->old_coeffs_fx[i];
+                    st_fx->hHqFec->old_coeffs_fx[i] = Mult_32_16(st_fx->hHqFec->old_coeffs_fx[i], 23170);
+                    t_audio_q_fx[i] = st_fx->hHqFec->old_coeffs_fx[i];
                     move32();
                 }
 
                 FOR (i = RANDOM_START*8; i < output_frame; i++)
                 {
-                    st_fx->old_coeffs_fx[i] = Mult_32_16(st_fx->old_coeffs_fx[i], 23170);
+                    st_fx->hHqFec->old_coeffs_fx[i] = Mult_32_16(st_fx->hHqFec->old_coeffs_fx[i], 23170);
                     IF (Random(&st_fx->HQ_FEC_seed_fx) < 0)
                     {
-                        t_audio_q_fx[i] = L_negate(st_fx->old_coeffs_fx[i]);
+                        t_audio_q_fx[i] = L_negate(st_fx->hHqFec->old_coeffs_fx[i]);
                         move32();
                     }
                     ELSE
                     {
-                        t_audio_q_fx[i] = st_fx->old_coeffs_fx[i];
+                        t_audio_q_fx[i] = st_fx->hHqFec->old_coeffs_fx[i];
                         move32();
                     }
                 }
@@ -298,7 +298,7 @@ void HQ_FEC_processing_fx(
             /* Scaling */
             FOR ( i=0; i < output_frame; i++ )
             {
-                st_fx->old_coeffs_fx[i] = Mult_32_16(st_fx->old_coeffs_fx[i], 23170);
+                st_fx->hHqFec->old_coeffs_fx[i] = Mult_32_16(st_fx->hHqFec->old_coeffs_fx[i], 23170);
                 move32();
             }
         }
@@ -356,7 +356,7 @@ void HQ_FEC_processing_fx(
         }
 
         /* Scaling for core band */
-        FEC_scaling_fx( st_fx->old_coeffs_fx, t_audio_q_fx, st_fx->Norm_gain_fx, &st_fx->HQ_FEC_seed_fx, nb_sfm, sfm_start, sfm_end );
+        FEC_scaling_fx( st_fx->hHqFec->old_coeffs_fx, t_audio_q_fx, st_fx->Norm_gain_fx, &st_fx->HQ_FEC_seed_fx, nb_sfm, sfm_start, sfm_end );
 
     }
 
@@ -412,8 +412,8 @@ void HQ_FEC_Mem_update_fx(
                 test();
                 test();
                 test();
-                IF ((st_fx->old_coeffs_fx[i+j*HQ_FEC_BAND_SIZE]>0 && t_audio_q_fx[i+j*HQ_FEC_BAND_SIZE]<0)
-                || (st_fx->old_coeffs_fx[i+j*HQ_FEC_BAND_SIZE]<0 && t_audio_q_fx[i+j*HQ_FEC_BAND_SIZE]>0))
+                IF ((st_fx->hHqFec->old_coeffs_fx[i+j*HQ_FEC_BAND_SIZE]>0 && t_audio_q_fx[i+j*HQ_FEC_BAND_SIZE]<0)
+                || (st_fx->hHqFec->old_coeffs_fx[i+j*HQ_FEC_BAND_SIZE]<0 && t_audio_q_fx[i+j*HQ_FEC_BAND_SIZE]>0))
                 {
                     st_fx->prev_sign_switch_fx[j] = add(st_fx->prev_sign_switch_fx[j], 1);
                     move16();
@@ -621,7 +621,7 @@ void HQ_FEC_Mem_update_fx(
 
     FOR (i=0; i < L_FRAME8k; i++)
     {
-        st_fx->old_coeffs_fx[i] = t_audio_q_fx[i];
+        st_fx->hHqFec->old_coeffs_fx[i] = t_audio_q_fx[i];
         move32();
     }
 
@@ -875,7 +875,7 @@ Word16 FEC_phase_matching_fx(
     }
     set16_fx(ImdctOutWin_fx, 0, 2*L);
 
-    pos = Search_Max_Corr_fx(st_fx->old_auOut_2fr_fx, st_fx->old_Min_ind_fx, L);
+    pos = Search_Max_Corr_fx(st_fx->hHqFec->old_auOut_2fr_fx, st_fx->old_Min_ind_fx, L);
 
     IF (pos == 0)
     {
@@ -885,16 +885,16 @@ Word16 FEC_phase_matching_fx(
     /* Repetition */
     remain = L+N_Z_L_NB - ((2*L)-pos);
     move16();
-    Copy(&st_fx->old_auOut_2fr_fx[pos], &ImdctOutWin_fx[N_ZERO_NB], (2*L)-pos);
+    Copy(&st_fx->hHqFec->old_auOut_2fr_fx[pos], &ImdctOutWin_fx[N_ZERO_NB], (2*L)-pos);
 
     /* OldauOut without windowing */
     FOR (i = N_ZERO_NB; i < L/2; i++)
     {
-        OldauOutnoWin_fx[i-N_ZERO_NB] = extract_l( L_shr( L_negate(st_fx->oldIMDCTout_fx[L/2 - 1 - i]), 6 ) );
+        OldauOutnoWin_fx[i-N_ZERO_NB] = extract_l( L_shr( L_negate(st_fx->hHqFec->oldIMDCTout_fx[L/2 - 1 - i]), 6 ) );
     }
     FOR(i = 0; i < L/2; i++)
     {
-        OldauOutnoWin_fx[i+N_ZERO_O_NB] = extract_l( L_shr( L_negate(st_fx->oldIMDCTout_fx[i]), 6 ) );
+        OldauOutnoWin_fx[i+N_ZERO_O_NB] = extract_l( L_shr( L_negate(st_fx->hHqFec->oldIMDCTout_fx[i]), 6 ) );
     }
 
     Copy(OldauOutnoWin_fx, &ImdctOutWin_fx[N_ZERO_NB+(2*L)-pos], remain);
@@ -903,7 +903,7 @@ Word16 FEC_phase_matching_fx(
     pow22_fx = L_deposit_l(0);
     FOR (i = 0; i < L; i++)
     {
-        pow1_fx = L_add(pow1_fx, shr(abs_s(st_fx->old_auOut_2fr_fx[L+i]), 1));
+        pow1_fx = L_add(pow1_fx, shr(abs_s(st_fx->hHqFec->old_auOut_2fr_fx[L+i]), 1));
         pow22_fx = L_add(pow22_fx, shr(abs_s(ImdctOutWin_fx[N_ZERO_NB+i]), 1));
     }
     IF(pow22_fx != 0)
@@ -1455,7 +1455,7 @@ void time_domain_FEC_HQ_fx(
     test();
     IF( (sub(st_fx->nbLostCmpt, 1) == 0)&&(sub(st_fx->phase_mat_flag_fx, 1) == 0)&&(sub(st_fx->phase_mat_next_fx, 0) == 0) )
     {
-        IF (FEC_phase_matching_fx(st_fx, wtda_audio_fx, out_fx, st_fx->old_out_fx, st_fx->old_out_pha_fx) )
+        IF (FEC_phase_matching_fx(st_fx, wtda_audio_fx, out_fx, st_fx->old_out_fx, st_fx->hHqFec->old_out_pha_fx) )
         {
             /* window_ola( wtda_audio, out, st->old_out, output_frame, 0, 0, 0 ); */
             window_ola_fx(wtda_audio_fx, out_fx, Q_synth, st_fx->old_out_fx, &st_fx->Q_old_wtda, output_frame, ALDO_WINDOW, ALDO_WINDOW, 0, 0, 0 );
@@ -1472,7 +1472,7 @@ void time_domain_FEC_HQ_fx(
     }
     ELSE IF((sub(st_fx->prev_bfi_fx, 1) == 0)&&(st_fx->bfi_fx == 0) &&(sub(st_fx->phase_mat_next_fx, 1) == 0))
     {
-        FEC_phase_matching_nextgood_fx( wtda_audio_fx, out_fx, st_fx->old_out_fx, st_fx->old_out_pha_fx, mean_en_high_fx);
+        FEC_phase_matching_nextgood_fx( wtda_audio_fx, out_fx, st_fx->old_out_fx, st_fx->hHqFec->old_out_pha_fx, mean_en_high_fx);
 
         st_fx->phase_mat_next_fx = 0;
         move16();
@@ -1481,7 +1481,7 @@ void time_domain_FEC_HQ_fx(
     }
     ELSE IF((sub(st_fx->prev_bfi_fx, 1) == 0)&&(sub(st_fx->bfi_fx, 1) == 0) &&(sub(st_fx->phase_mat_next_fx, 1) == 0))
     {
-        FEC_phase_matching_burst_fx( wtda_audio_fx, out_fx, st_fx->old_out_fx, st_fx->old_out_pha_fx, st_fx->prev_oldauOut_fx);
+        FEC_phase_matching_burst_fx( wtda_audio_fx, out_fx, st_fx->old_out_fx, st_fx->hHqFec->old_out_pha_fx, st_fx->hHqFec->prev_oldauOut_fx);
         st_fx->phase_mat_next_fx = 1;
         move16();
         *Q_synth = 0;
@@ -1503,7 +1503,7 @@ void time_domain_FEC_HQ_fx(
                 {
                     tmp = 1;
                 }
-                Repetition_smoothing_nextgood_fx( wtda_audio_fx, out_fx, st_fx->oldIMDCTout_fx, st_fx->old_out_fx, tmp, N_LEAD_NB);
+                Repetition_smoothing_nextgood_fx( wtda_audio_fx, out_fx, st_fx->hHqFec->oldIMDCTout_fx, st_fx->old_out_fx, tmp, N_LEAD_NB);
                 *Q_synth = 0;
                 move16();
             }
@@ -1517,7 +1517,7 @@ void time_domain_FEC_HQ_fx(
             {
                 /*window_ola( wtda_audio, out, st->old_out, output_frame, 0, 0, 0); */
                 window_ola_fx( wtda_audio_fx, out_fx, Q_synth, st_fx->old_out_fx, &st_fx->Q_old_wtda, output_frame,
-                st_fx->tcx_cfg.tcx_last_overlap_mode, st_fx->tcx_cfg.tcx_curr_overlap_mode, st_fx->prev_bfi_fx, st_fx->oldHqVoicing_fx , st_fx->oldgapsynth_fx );
+                st_fx->tcx_cfg.tcx_last_overlap_mode, st_fx->tcx_cfg.tcx_curr_overlap_mode, st_fx->prev_bfi_fx, st_fx->oldHqVoicing_fx , st_fx->hHqFec->oldgapsynth_fx );
             }
         }
         ELSE /* if(st->bfi_fx == 1) */
@@ -1526,11 +1526,11 @@ void time_domain_FEC_HQ_fx(
             IF( (sub(st_fx->stat_mode_out_fx, 1) == 0) || (sub(st_fx->diff_energy_fx, ED_THRES_50P_fx) < 0 ))
             {
                 /* if( window_ola_bfi( wtda_audio, out, st->oldIMDCTout, st->old_out, output_frame, st->prev_oldauOut, N_LEAD_NB) ) */
-                IF( Repetition_smoothing_fx( wtda_audio_fx, out_fx, st_fx->oldIMDCTout_fx, st_fx->old_out_fx, output_frame, st_fx->prev_oldauOut_fx, N_LEAD_NB) )
+                IF( Repetition_smoothing_fx( wtda_audio_fx, out_fx, st_fx->hHqFec->oldIMDCTout_fx, st_fx->old_out_fx, output_frame, st_fx->hHqFec->prev_oldauOut_fx, N_LEAD_NB) )
                 {
                     /*window_ola( wtda_audio, out, st->old_out, output_frame, 0, 0, 0);*/
                     window_ola_fx( wtda_audio_fx, out_fx, Q_synth, st_fx->old_out_fx, &st_fx->Q_old_wtda, output_frame,
-                    st_fx->tcx_cfg.tcx_last_overlap_mode, st_fx->tcx_cfg.tcx_curr_overlap_mode, st_fx->prev_bfi_fx, st_fx->oldHqVoicing_fx , st_fx->oldgapsynth_fx );
+                    st_fx->tcx_cfg.tcx_last_overlap_mode, st_fx->tcx_cfg.tcx_curr_overlap_mode, st_fx->prev_bfi_fx, st_fx->oldHqVoicing_fx , st_fx->hHqFec->oldgapsynth_fx );
                 }
                 ELSE
                 {
@@ -1542,7 +1542,7 @@ void time_domain_FEC_HQ_fx(
             {
                 /*window_ola( wtda_audio, out, st->old_out, output_frame, 0, 0, 0 );*/
                 window_ola_fx( wtda_audio_fx, out_fx, Q_synth, st_fx->old_out_fx, &st_fx->Q_old_wtda, output_frame,
-                st_fx->tcx_cfg.tcx_last_overlap_mode, st_fx->tcx_cfg.tcx_curr_overlap_mode, st_fx->prev_bfi_fx, st_fx->oldHqVoicing_fx , st_fx->oldgapsynth_fx );
+                st_fx->tcx_cfg.tcx_last_overlap_mode, st_fx->tcx_cfg.tcx_curr_overlap_mode, st_fx->prev_bfi_fx, st_fx->oldHqVoicing_fx , st_fx->hHqFec->oldgapsynth_fx );
             }
         }
         st_fx->phase_mat_next_fx = 0;
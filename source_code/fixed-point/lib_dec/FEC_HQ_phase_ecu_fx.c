@@ -1979,60 +1979,98 @@ void fec_ecu_dft_fx(
     return;
 }
 
+/*--------------------------------------------------------------------------
+ *  L_sat40_fx()
+ *
+ *  Saturate a 40-bit accumulator to 32 bits, as the BASOP operators do
+ *--------------------------------------------------------------------------*/
+static
+Word32 L_sat40_fx(const Word40 L40_var)
+{
+    if (L40_var > MAX_32)
+    {
+        return MAX_32;
+    }
+    if (L40_var < MIN_32)
+    {
+        return MIN_32;
+    }
+    return (Word32) L40_var;
+}
+
+/*--------------------------------------------------------------------------
+ *  singenerator_fx()
+ *
+ *  Bank of sinusoidal oscillators, one per selected pulse, added to xx[].
+ *  All oscillators are advanced together, one sample at a time, and their
+ *  outputs are added to xx[n] in pulse order, so every output sample sees
+ *  the same saturating accumulation as with one oscillator run after the
+ *  other. The L_mult/L_msu/mac_r/L_add recursion is evaluated on a 40-bit
+ *  accumulator with explicit saturation, which is bit-exact.
+ *--------------------------------------------------------------------------*/
 static
 void singenerator_fx(
-    const Word16 L,       /* i  : size of output */
-    const Word16 cosfreq, /* i  : cosine of 1-sample dephasing at the given frequency */
-    const Word16 sinfreq, /* i  : sine   of 1-sample dephasing at the given frequency */
-    const Word16 a_re,    /* i  : real part of complex spectral coefficient at the given frequency */ /*Qin */
-    const Word16 a_im,    /* i  : imag part of complex spectral coefficient at the given frequency */ /*Qin */
-    Word32 xx[]      /* o  : output vector */ /*Qin+16 */
+    const Word16 L,         /* i  : size of output */
+    const Word16 nb_osc,    /* i  : number of oscillators */
+    const Word16 *cosfreq,  /* i  : cosine of 1-sample dephasing at the given frequencies */
+    const Word16 *sinfreq,  /* i  : sine   of 1-sample dephasing at the given frequencies */
+    const Word16 *a_re,     /* i  : real part of complex spectral coefficients at the given frequencies */ /*Qin */
+    const Word16 *a_im,     /* i  : imag part of complex spectral coefficients at the given frequencies */ /*Qin */
+    Word32 xx[]             /* o  : output vector */ /*Qin+16 */
 )
 {
+    Word32 L_C[FEC_NB_PULSE_MAX], L_S[FEC_NB_PULSE_MAX];
+    Word16 C[FEC_NB_PULSE_MAX], S[FEC_NB_PULSE_MAX];
+    Word32 L_acc, L_mc, L_ms;
+    Word16 i, k;
 
-    Word32 *ptr, L_C0, L_S0, L_C1, L_S1;
-    Word16 C0, S0, C1, S1;
-    Word16 i;
-
-    L_S0 = L_deposit_l(0);  /*prevent warning*/
-    L_C0 = L_deposit_h(a_re); /*Qin+16 */
-    S0 = a_im;
-    move16();
+    L_acc = xx[0];
+    move32();
+    FOR (k = 0; k < nb_osc; k++)
+    {
+        L_C[k] = L_deposit_h(a_re[k]); /*Qin+16 */
+        L_S[k] = L_deposit_l(0);
+        S[k] = a_im[k];
+        move16();
+        L_acc = L_add(L_acc, L_C[k]);
+    }
+    xx[0] = L_acc;
+    move32();
 
-    ptr = xx;
+    /* C(n) = C(n-1) cosfreq - S(n-1) sinfreq, S(n) = C(n-1) sinfreq + S(n-1) cosfreq */
+    FOR (i = 1; i < L-1; i++)
+    {
+        FOR (k = 0; k < nb_osc; k++)
+        {
+            C[k] = extract_h(L_C[k]);
+            L_mc = L_sat40_fx(2 * (Word40) C[k] * cosfreq[k]);
+            L_ms = L_sat40_fx(2 * (Word40) S[k] * sinfreq[k]);
+            L_C[k] = L_sat40_fx((Word40) L_mc - L_ms);                 /* L_msu(L_mult(C, cosfreq), S, sinfreq) */
+            L_S[k] = L_sat40_fx(2 * (Word40) C[k] * sinfreq[k]);
+            L_mc = L_sat40_fx((Word40) L_S[k] + L_sat40_fx(2 * (Word40) S[k] * cosfreq[k]));
+            S[k] = (Word16) (L_sat40_fx((Word40) L_mc + 0x8000) >> 16); /* mac_r(L_S, S, cosfreq) */
+        }
 
-    *ptr = L_add(*ptr, L_C0);
-    move32();
-    ptr++;
-
-    FOR (i=0; i<L/2-1; i++)
-    {
-        C0 = extract_h(L_C0); /*Qin */
-        L_C1 = L_mult(C0, cosfreq); /*Qin+16 */
-        L_C1 = L_msu(L_C1, S0, sinfreq); /*Qin+16 */
-        L_S1 = L_mult(C0, sinfreq);
-        S1 = mac_r(L_S1, S0, cosfreq);
-        *ptr = L_add(*ptr, L_C1);
-        move32(); /*Qin+16 */
-        ptr++;
-
-        C1 = extract_h(L_C1);
-        L_C0 = L_mult(C1, cosfreq);
-        L_C0 = L_msu(L_C0, S1, sinfreq);
-        L_S0 = L_mult(C1, sinfreq);
-        S0 = mac_r(L_S0, S1, cosfreq);
-        *ptr = L_add(*ptr, L_C0);
-        move32();
-        ptr++;
+        L_acc = xx[i];
+        FOR (k = 0; k < nb_osc; k++)
+        {
+            L_acc = L_sat40_fx((Word40) L_acc + L_C[k]);
+        }
+        xx[i] = L_acc;
     }
 
-    C0 = extract_h(L_C0);
-    S0 = extract_h(L_S0);
-    L_C1 = L_mult(C0, cosfreq);
-    L_C1 = L_msu(L_C1, S0, sinfreq);
-    *ptr = L_add(*ptr, L_C1);
+    /* last sample: the sine part is taken without its S(n-1) cosfreq term */
+    L_acc = xx[L-1];
+    FOR (k = 0; k < nb_osc; k++)
+    {
+        C[k] = extract_h(L_C[k]);
+        S[k] = extract_h(L_S[k]);
+        L_mc = L_mult(C[k], cosfreq[k]);
+        L_mc = L_msu(L_mc, S[k], sinfreq[k]);
+        L_acc = L_add(L_acc, L_mc);
+    }
+    xx[L-1] = L_acc;
     move32();
-    ptr++;
 
     return;
 }
@@ -2060,7 +2098,7 @@ void sinusoidal_synthesis_fx(
     Word16 a_re[FEC_NB_PULSE_MAX], a_im[FEC_NB_PULSE_MAX];
     Word16 Lon20_10 = 80;
     Word16 flag, Len;
-    Word16 cosfreq, sinfreq, sN,PL,glued;
+    Word16 cosfreq[FEC_NB_PULSE_MAX], sinfreq[FEC_NB_PULSE_MAX], sN,PL,glued;
     Word32 synthesis_fx[2*L_FRAME48k];
     Word16 *pt1, *pt2, *pt3, *pt4;
 
@@ -2230,8 +2268,6 @@ void sinusoidal_synthesis_fx(
     exp = add(exp,sN);
 
 
-    pt1 = a_re;
-    pt2 = a_im;
     pt3 = freqi;
     q = shr_r(N,2);
     if (sub(N,shl(q,2))>0)
@@ -2249,13 +2285,11 @@ void sinusoidal_synthesis_fx(
 
         tmp = div_s(shl(*pt3,1),inv_den); /*Q15 */  /* ind*2/(N*decim) */
         freq = L_shl(L_mult(tmp, 25736),1); /*Q30 */ /* ind*2/(N*decim)*pi/4*4    never greater than PI/2 */
-        sin_cos_est_fx(freq, &cosfreq, &sinfreq); /*cosfreq & sinfreq in Q15 */
-        singenerator_fx( Len, cosfreq, sinfreq, *pt1, *pt2, synthesis_fx);  /*Qin      */
+        sin_cos_est_fx(freq, &cosfreq[i], &sinfreq[i]); /*cosfreq & sinfreq in Q15 */
 
-        pt1++;
-        pt2++;
         pt3++;
     }
+    singenerator_fx( Len, nb_pulses_final, cosfreq, sinfreq, a_re, a_im, synthesis_fx);  /*Qin      */
     Copy_Scale_sig_32_16(synthesis_fx, synthesis, Len, negate(add(exp,16))); /*Qin */
 
 
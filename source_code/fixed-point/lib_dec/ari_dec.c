@@ -8,6 +8,7 @@
 #include "basop_mpy.h"
 #include "cnst_fx.h"
 #include "rom_com_fx.h"
+#include "rom_dec_fx.h"
 #include "prot_fx.h"
 
 /*---------------------------------------------------------------
@@ -237,6 +238,143 @@ static Word16 ari_lookup_bit(Word32 cum, Word32 range, UWord16 const *cum_freq)
     return symbol;
 }
 
+/*---------------------------------------------------------------
+ * ari_get_bits_14bits()
+ *
+ * Read nbits bits in a row from the bitstream, with the same
+ * bitstream overrun detection as get_next_indice_1_fx()
+ -------------------------------------------------------------*/
+static Word32 ari_get_bits_14bits(Decoder_State_fx *st, Word16 nbits)
+{
+    Word32 bits;
+    Word16 i, n, limit;
+    const UWord16 *p;
+
+    limit = 0x7FFF;
+    move16();
+    if (sub(st->codec_mode, MODE1) == 0)
+    {
+        limit = st->total_num_bits;
+        move16();
+    }
+    if (sub(st->codec_mode, MODE2) == 0)
+    {
+        limit = add(st->total_num_bits, 2*8); /* add two zero bytes for arithmetic coder flush */
+    }
+    n = s_max(s_min(nbits, sub(limit, st->next_bit_pos_fx)), 0);
+
+    bits = 0;
+    p = &st->bit_stream_fx[st->next_bit_pos_fx];
+    FOR (i = 0; i < n; i++)
+    {
+        bits = (bits << 1) + p[i];
+    }
+    st->next_bit_pos_fx = add(st->next_bit_pos_fx, n);
+
+    IF (sub(n, nbits) < 0)
+    {
+        /* reads past the end return zeros */
+        st->BER_detect = 1;
+        move16();
+        bits = bits << sub(nbits, n);
+    }
+
+    return bits;
+}
+
+/*---------------------------------------------------------------
+ * ari_renorm_14bits()
+ *
+ * Renormalization of the decoder interval. Consecutive shifts on
+ * which the MSBs of low and high-1 agree are done in one step,
+ * only the straddle case low in [q1,q2), high-1 in [q2,q3) is
+ * resolved bit by bit. Equivalent to the tab_ari_qnew[][] loop:
+ * all values stay within 17 bits, so plain integer ops are exact.
+ -------------------------------------------------------------*/
+static void ari_renorm_14bits(
+    Decoder_State_fx *st,   /* i/o: bitstream source, or NULL      */
+    Word16 *ptr,            /* i  : bit buffer if st is NULL       */
+    Word16 *bp,             /* i/o: position in ptr                */
+    Word16 bits,            /* i  : size of ptr                    */
+    Word32 *low,
+    Word32 *high,
+    Word32 *value
+)
+{
+    Word32 l, h, v, diff, in, off;
+    Word16 i, n, k;
+
+    l = *low;
+    h = *high;
+    v = *value;
+
+    i = 0;
+    move16();
+    WHILE (sub(i, 0x7FFF) < 0)
+    {
+        diff = l ^ (h - 1);
+
+        IF ((diff & 0x8000) == 0)
+        {
+            /* MSBs agree: shift out all leading agreeing bits at once */
+            n = 16;
+            move16();
+            if (diff != 0)
+            {
+                n = add(norm_s(extract_l(diff)), 1);
+            }
+            n = s_min(n, sub(0x7FFF, i));
+            off = 0;
+        }
+        ELSE IF ( (l >= ari_q1new) && (h - 1 < ari_q3new) )
+        {
+            /* straddle around the half point: one bit with offset */
+            n = 1;
+            move16();
+            off = ari_q1new;
+        }
+        ELSE
+        {
+            BREAK;
+        }
+
+        IF (st == NULL)
+        {
+            n = s_min(n, sub(bits, *bp));
+            IF (n <= 0)
+            {
+                BREAK;
+            }
+            in = 0;
+            FOR (k = 0; k < n; k++)
+            {
+                in = (in << 1) + ptr[*bp + k];
+            }
+            *bp = add(*bp, n);
+        }
+        ELSE
+        {
+            in = ari_get_bits_14bits(st, n);
+        }
+
+        /* the distances to low double per shifted bit */
+        v = ((v - l) << n) + in;
+        h = (h - l) << n;
+        l = ((l - off) << n) & 0xFFFF;
+        v = v + l;
+        h = h + l;
+
+        i = add(i, n);
+    }
+
+    *low = l;
+    move32();
+    *high = h;
+    move32();
+    *value = v;
+    move32();
+}
+
 static Word16 ari_decode_14bits_ext(
     Decoder_State_fx *st,
     TastatDec *s,
@@ -250,7 +388,6 @@ static Word16 ari_decode_14bits_ext(
     Word32  high;
     Word32  range;
     Word32  value;
-    Word16 i;
 
     low   = L_add(0,s->low);
     high  = L_add(0,s->high);
@@ -269,27 +406,56 @@ static Word16 ari_decode_14bits_ext(
     high = L_add(low,mul_sbc_14bits(range,cum_freq[symbol]));
     low  = L_add(low,mul_sbc_14bits(range,cum_freq[symbol+1]));
 
-    FOR (i = 0; i < 0x7FFF; i++)
-    {
-        Word32 L_msb_diff, L_msb_low, L_msb_high;
+    ari_renorm_14bits(st, NULL, NULL, 0, &low, &high, &value);
 
-        L_msb_high = L_shr(L_sub(high,1),14);
-        L_msb_low  = L_shr(low,14);
-        L_msb_diff = L_sub(L_msb_high, L_msb_low);
-        IF (L_sub(L_msb_diff,2) >= 0)
-        {
-            BREAK;
-        }
-        assert (tab_ari_qnew[L_msb_high][L_msb_low] != 0x0CCC);
-        assert (tab_ari_qnew[L_msb_high][L_msb_low] != 0x0BBB);
-        low   = L_msu(low,1,tab_ari_qnew[L_msb_high][L_msb_low]);
-        low   = L_shl(low,1);
-        high  = L_msu(high,1,tab_ari_qnew[L_msb_high][L_msb_low]);
-        high  = L_shl(high,1);
-        value = L_msu(value,1,tab_ari_qnew[L_msb_high][L_msb_low]);
-        value = L_mac0(L_shl(value,1),1,get_next_indice_1_fx(st));
+    s->low  = low;
+    move32();
+    s->high = high;
+    move32();
+    s->vobf = value;
+    move32();
+
+    return symbol;
+}
+
+
+/**
+ * \brief Only for the 17 symbol TCX spectral models ari_pk_s17_LC_ext[pki]
+ *
+ * Same result as ari_decode_14bits_s17_ext(), but the symbol search is a
+ * direct lookup in ari_lut_s17_LC_ext[] on (cum/range) followed by a short
+ * linear refinement: range*cum_freq[p] > cum  <=>  cum_freq[p] > cum/range.
+ * low < 2^16 and range <= 2^16, so all products fit in 31 bits.
+ */
+Word16 ari_decode_14bits_s17_LC(Decoder_State_fx *st, TastatDec *s, Word16 pki)
+{
+    Word32 cum, range, low, high, value, t;
+    Word16 symbol;
+    const UWord16 *cum_freq;
+
+    cum_freq = ari_pk_s17_LC_ext[pki];
+
+    low   = s->low;
+    high  = s->high;
+    value = s->vobf;
+
+    range = high - low;
+    cum = ((value - low) << stat_bitsnew) + ((1 << stat_bitsnew) - 1);
+
+    t = cum / range;
+    assert(t >= 0 && t < (1 << stat_bitsnew));
+
+    symbol = ari_lut_s17_LC_ext[pki][t >> ARI_S17_LUT_SHIFT];
+    WHILE ( (symbol < VAL_ESC) && (cum_freq[symbol+1] > t) )
+    {
+        symbol++;
     }
 
+    high = low + ((range * cum_freq[symbol]) >> stat_bitsnew);
+    low  = low + ((range * cum_freq[symbol+1]) >> stat_bitsnew);
+
+    ari_renorm_14bits(st, NULL, NULL, 0, &low, &high, &value);
+
     s->low  = low;
     move32();
     s->high = high;
@@ -300,7 +466,6 @@ static Word16 ari_decode_14bits_ext(
     return symbol;
 }
 
-
 /**
  * \brief Only for 17 symbols with new extended Tables
  */
@@ -453,26 +618,7 @@ static Word16 ari_decode_14bits_notbl(
     high = L_add(s->high, 0);
     value = L_add(s->vobf, 0);
 
-    FOR (; bp<bits; ++bp)
-    {
-        Word32 L_msb_diff, L_msb_low, L_msb_high;
-
-        L_msb_high = L_shr(L_sub(high,1),14);
-        L_msb_low  = L_shr(low,14);
-        L_msb_diff = L_sub(L_msb_high, L_msb_low);
-        IF (L_sub(L_msb_diff,2) >= 0)
-        {
-            BREAK;
-        }
-        assert (tab_ari_qnew[L_msb_high][L_msb_low] != 0x0CCC);
-        assert (tab_ari_qnew[L_msb_high][L_msb_low] != 0x0BBB);
-        low   = L_msu(low,1,tab_ari_qnew[L_msb_high][L_msb_low]);
-        low   = L_shl(low,1);
-        high  = L_msu(high,1,tab_ari_qnew[L_msb_high][L_msb_low]);
-        high  = L_shl(high,1);
-        value = L_msu(value,1,tab_ari_qnew[L_msb_high][L_msb_low]);
-        value = L_mac0(L_shl(value,1),1,ptr[bp]);
-    }
+    ari_renorm_14bits(NULL, ptr, &bp, bits, &low, &high, &value);
 
     test();
     test();
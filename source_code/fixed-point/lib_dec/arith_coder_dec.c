@@ -194,7 +194,7 @@ void tcx_arith_decode_envelope(
     move16();
     if (st->igf)
     {
-        L_spec_core = s_min(L_spec_core, st->hIGFDec.infoIGFStartLine);
+        L_spec_core = s_min(L_spec_core, st->hIGFDec->infoIGFStartLine);
     }
     envelope = (Word16*)env;
 
@@ -25,6 +25,7 @@ void open_decoder_LPD( Decoder_State_fx *st, Word32 bit_rate, Word16 bandwidth_m
     Word16 mem_syn_r_size_new;
     Word16 mem_syn_r_size_old;
     Word16 fscaleFB;
+    Word16 igfStopFreq;
 
 
 
@@ -168,7 +169,14 @@ void open_decoder_LPD( Decoder_State_fx *st, Word32 bit_rate, Word16 bandwidth_m
 
     IF (st->tcx_cfg.fIsTNSAllowed != 0)
     {
-        InitTnsConfigs(bwMode2fs[st->bwidth_fx], st->tcx_cfg.tcx_coded_lines, st->tcx_cfg.tnsConfig, st->hIGFDec.infoIGFStopFreq, st->total_brate_fx);
+        igfStopFreq = -1;
+        move16();
+        if (st->hIGFDec != NULL)
+        {
+            igfStopFreq = st->hIGFDec->infoIGFStopFreq;
+            move16();
+        }
+        InitTnsConfigs(bwMode2fs[st->bwidth_fx], st->tcx_cfg.tcx_coded_lines, st->tcx_cfg.tnsConfig, igfStopFreq, st->total_brate_fx);
     }
 
     resetTecDec_Fx( &(st->tecDec_fx) );
@@ -12,13 +12,14 @@
 #include "rom_com_fx.h"
 
 
-void mode_switch_decoder_LPD( Decoder_State_fx *st, Word16 bandwidth, Word32 bitrate, Word16 frame_size_index
-                            )
+Word16 mode_switch_decoder_LPD( Decoder_State_fx *st, Word16 bandwidth, Word32 bitrate, Word16 frame_size_index
+                              )
 {
     Word16 fscale, switchWB;
     Word32 sr_core;
     Word8 bSwitchFromAmrwbIO;
     Word16 frame_size;
+    Word16 igfStopFreq;
 
 
     switchWB = 0;
@@ -64,12 +65,27 @@ void mode_switch_decoder_LPD( Decoder_State_fx *st, Word16 bandwidth, Word32 bit
 
     st->igf = getIgfPresent(bitrate, bandwidth, st->rf_flag);
 
-    st->hIGFDec.infoIGFStopFreq = -1;
-    move16();
+    IF( st->hIGFDec != NULL )
+    {
+        st->hIGFDec->infoIGFStopFreq = -1;
+        move16();
+    }
     IF( st->igf )
     {
+        /* IGF state is only allocated once a mode actually uses it */
+        IF( st->hIGFDec == NULL )
+        {
+            IF( createIgfDec( &st->hIGFDec ) != 0 )
+            {
+                /* out of memory: no IGF without its state */
+                st->igf = 0;
+                move16();
+                return 1;
+            }
+        }
+
         /* switch IGF configuration */
-        IGFDecSetMode( &st->hIGFDec, st->total_brate_fx, bandwidth, -1, -1, st->rf_flag);
+        IGFDecSetMode( st->hIGFDec, st->total_brate_fx, bandwidth, -1, -1, st->rf_flag);
 
     }
 
@@ -117,7 +133,14 @@ void mode_switch_decoder_LPD( Decoder_State_fx *st, Word16 bandwidth, Word32 bit
 
         IF (st->tcx_cfg.fIsTNSAllowed != 0)
         {
-            InitTnsConfigs(bwMode2fs[bandwidth], st->tcx_cfg.tcx_coded_lines, st->tcx_cfg.tnsConfig, st->hIGFDec.infoIGFStopFreq, st->total_brate_fx);
+            igfStopFreq = -1;
+            move16();
+            if (st->hIGFDec != NULL)
+            {
+                igfStopFreq = st->hIGFDec->infoIGFStopFreq;
+                move16();
+            }
+            InitTnsConfigs(bwMode2fs[bandwidth], st->tcx_cfg.tcx_coded_lines, st->tcx_cfg.tnsConfig, igfStopFreq, st->total_brate_fx);
         }
     }
 
@@ -223,5 +246,5 @@ void mode_switch_decoder_LPD( Decoder_State_fx *st, Word16 bandwidth, Word32 bit
     move16();
     st->dec_glr_idx = 0;
 
+    return 0;
 }
-
@@ -748,7 +748,7 @@ void decoder_LPD(
 
             /* TCX decoder */
 
-            IGFDecRestoreTCX10SubFrameData( &st->hIGFDec, k );
+            IGFDecRestoreTCX10SubFrameData( st->hIGFDec, k );
             decoder_tcx(&st->tcx_cfg,
                         prm,
                         Aq,
@@ -12,7 +12,7 @@
 #include "basop_util.h"
 
 static
-void decode_frame_type(Decoder_State_fx *st)
+Word16 decode_frame_type(Decoder_State_fx *st)
 {
     Word32 L_tmp;
     Word16 num_bits;
@@ -199,7 +199,10 @@ void decode_frame_type(Decoder_State_fx *st)
             move16();
 
             /* Reconf Core */
-            mode_switch_decoder_LPD( st, st->bwidth_fx, st->total_brate_fx, frame_size_index );
+            IF( mode_switch_decoder_LPD( st, st->bwidth_fx, st->total_brate_fx, frame_size_index ) != 0 )
+            {
+                return 1;
+            }
 
             /* Reconf CLDFB */
             IF( sub (i_mult(st->cldfbAna_fx->no_channels,st->cldfbAna_fx->no_col), st->L_frame_fx) != 0 )
@@ -274,6 +277,7 @@ void decode_frame_type(Decoder_State_fx *st)
 
     st->total_brate_fx = total_brate;
 
+    return 0;
 }
 
 
@@ -330,7 +334,10 @@ Word16 dec_acelp_tcx_frame(Decoder_State_fx *st,
         Word16 L_frame = st->L_frame_fx;
         Word32 total_brate = st->last_total_brate_fx;
 
-        decode_frame_type( st );
+        IF( decode_frame_type( st ) != 0 )
+        {
+            return 1;
+        }
 
         st->force_lpd_reset = 0;
 
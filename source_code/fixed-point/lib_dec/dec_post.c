@@ -55,6 +55,9 @@ void Init_post_filter(
     /* Reset */
     pfstat->reset = 0;
 
+    /* Enabled unless the application asks otherwise */
+    pfstat->bypass = 0;
+
     /* Initialize arrays and pointers */
     set16_fx(pfstat->mem_pf_in, 0, L_SUBFR);
 
@@ -107,7 +110,9 @@ void nb_post_filt(
 
     modify_pst_param( *psf_lp_noise, &Post_G1, &Post_G2, coder_type, &Gain_factor );
 
-    if(Pfstat->reset)
+    /* a bypassed post-filter only tracks its memories, as on a reset */
+    test();
+    IF( Pfstat->reset || Pfstat->bypass )
     {
         set16_fx(Pfstat->mem_res2, 0, DECMEM_RES2);
         Copy( &Synth[L_frame-L_SYN_MEM], Pfstat->mem_pf_in, L_SYN_MEM);
@@ -349,8 +354,9 @@ void formant_post_filt(
         move16();
     }
 
-    /* Reset post filter */
-    if( pfstat->reset != 0 )
+    /* Reset post filter; a bypassed post-filter only tracks its memories */
+    test();
+    IF( pfstat->reset != 0 || pfstat->bypass != 0 )
     {
         post_G1 = MAX16B;
         move16();
@@ -722,11 +728,7 @@ static void search_del(
      * Computes energy of current signal
      *-------------------------------------*/
 
-    L_acc = L_mult(ptr_sig_in[0], ptr_sig_in[0]);
-    FOR(i = 1; i < L_SUBFR; i++)
-    {
-        L_acc = L_mac(L_acc, ptr_sig_in[i], ptr_sig_in[i]);
-    }
+    L_acc = Dot_product_mac(0, ptr_sig_in, ptr_sig_in, L_SUBFR);
     IF (L_acc == 0)
     {
         *num_gltp = 0;
@@ -759,12 +761,7 @@ static void search_del(
 
     FOR (i = 0; i < 3; i++)
     {
-        L_acc = L_mult(ptr_sig_in[0], ptr_sig_past[0]);
-        FOR (n = 1; n < L_SUBFR; n++)
-        {
-            L_acc = L_mac(L_acc, ptr_sig_in[n], ptr_sig_past[n]);
-        }
-
+        L_acc = Dot_product_mac(0, ptr_sig_in, ptr_sig_past, L_SUBFR);
 
         L_acc = L_max(L_acc, 0);
         L_temp = L_sub(L_acc, L_num_int);
@@ -794,15 +791,7 @@ static void search_del(
     /* Compute den for i_max */
     lambda = add(lambda, (Word16) i_max);
     ptr_sig_past = ptr_sig_in - lambda;
-    temp = *ptr_sig_past++;
-    move16();
-    L_acc = L_mult(temp, temp);
-    FOR (i = 1; i < L_SUBFR; i++)
-    {
-        temp = *ptr_sig_past++;
-        move16();
-        L_acc = L_mac(L_acc, temp, temp);
-    }
+    L_acc = Dot_product_mac(0, ptr_sig_past, ptr_sig_past, L_SUBFR);
     IF (L_acc == 0L)
     {
         *num_gltp = 0;
@@ -838,27 +827,25 @@ static void search_del(
         /* Compute y_up for lambda+1 - phi/F_UP_PST */
         /* and lambda - phi/F_UP_PST */
 
+        /* the input is justified on 13 bits and SUM(|h|) < 2^16 :  */
+        /* the L_mac() chain and the rounding cannot saturate     */
         ptr_sig_past = ptr_sig_past0;
         FOR (n = 0; n <= L_SUBFR; n++)
         {
             ptr1 = ptr_sig_past++;
 
-            L_acc = L_mult(ptr_h[0], ptr1[0]);
+            L_acc = (Word32) ptr_h[0] * ptr1[0];
             FOR (i = 1; i < LH2_S; i++)
             {
-                L_acc = L_mac(L_acc, ptr_h[i], ptr1[-i]);
+                L_acc += (Word32) ptr_h[i] * ptr1[-i];
             }
-            ptr_y_up[n] = round_fx(L_acc);
+            ptr_y_up[n] = (Word16) ((2 * L_acc + 0x8000L) >> 16);
         }
 
         /* compute den0 (lambda+1) and den1 (lambda) */
 
         /* part common to den0 and den1 */
-        L_acc = L_mult(ptr_y_up[1], ptr_y_up[1]);
-        FOR (n = 2; n < L_SUBFR; n++)
-        {
-            L_acc = L_mac(L_acc, ptr_y_up[n], ptr_y_up[n]);
-        }
+        L_acc = Dot_product_mac(0, &ptr_y_up[1], &ptr_y_up[1], L_SUBFR-1);
         L_temp0 = L_add(0, L_acc); /* sets to 'L_acc' in 1 clock (saved for den1) */
 
         /* den0 */
@@ -955,11 +942,7 @@ static void search_del(
     FOR (phi = 1; phi < F_UP_PST; phi++)
     {
         /* compute num for lambda+1 - phi/F_UP_PST */
-        L_acc = L_mult(ptr_sig_in[0], ptr_y_up[0]);
-        FOR (n = 1; n < L_SUBFR; n++)
-        {
-            L_acc = L_mac(L_acc, ptr_sig_in[n], ptr_y_up[n]);
-        }
+        L_acc = Dot_product_mac(0, ptr_sig_in, ptr_y_up, L_SUBFR);
         L_acc = L_shr(L_acc, sh_num); /* sh_num > 0 */
         L_acc = L_max(0, L_acc);
         num = extract_l(L_acc);
@@ -987,11 +970,7 @@ static void search_del(
         /* compute num for lambda - phi/F_UP_PST */
         ptr_y_up++;
 
-        L_acc = L_mult(ptr_sig_in[0], ptr_y_up[0]);
-        FOR (n = 1; n < L_SUBFR; n++)
-        {
-            L_acc = L_mac(L_acc, ptr_sig_in[n], ptr_y_up[n]);
-        }
+        L_acc = Dot_product_mac(0, ptr_sig_in, ptr_y_up, L_SUBFR);
         L_acc = L_shr(L_acc, sh_num); /* sh_num > 0 */
         L_acc = L_max(0, L_acc);
         num = extract_l(L_acc);
@@ -1160,25 +1139,23 @@ static void compute_ltp_l(
     temp = sub(LH_UP_L, ltpdel);
     ptr2 = s_in + temp;
 
-    /* Compute y_up */
+    /* Compute y_up                                                       */
+    /* s_in is justified on 13 bits and SUM(|h|) < 2^17 : the L_mac() chain */
+    /* and the rounding cannot saturate                                   */
     FOR (n = 0; n < L_SUBFR; n++)
     {
-        L_acc = L_mult(ptr_h[0], *ptr2--);
+        L_acc = (Word32) ptr_h[0] * *ptr2--;
 
         FOR (i = 1; i < LH2_L; i++)
         {
-            L_acc = L_mac(L_acc, ptr_h[i], *ptr2--);
+            L_acc += (Word32) ptr_h[i] * *ptr2--;
         }
-        y_up[n] = round_fx(L_acc);
+        y_up[n] = (Word16) ((2 * L_acc + 0x8000L) >> 16);
         ptr2 += LH2_L_P1;
     }
 
     /* Compute num */
-    L_acc = L_mult(y_up[0], s_in[0]);
-    FOR (n = 1; n < L_SUBFR; n++)
-    {
-        L_acc = L_mac(L_acc, y_up[n], s_in[n]);
-    }
+    L_acc = Dot_product_mac(0, y_up, s_in, L_SUBFR);
     IF (L_acc < 0L)
     {
         *num = 0;
@@ -1197,11 +1174,7 @@ static void compute_ltp_l(
     }
 
     /* Compute den */
-    L_acc = L_mult(y_up[0], y_up[0]);
-    FOR (n = 1; n < L_SUBFR; n++)
-    {
-        L_acc = L_mac(L_acc, y_up[n], y_up[n]);
-    }
+    L_acc = Dot_product_mac(0, y_up, y_up, L_SUBFR);
     temp = sub(16, norm_l(L_acc));
     temp = s_max(temp, 0);
     L_acc = L_shr(L_acc, temp); /* with temp >= 0 */
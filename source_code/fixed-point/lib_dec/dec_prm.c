@@ -864,14 +864,14 @@ void dec_prm(
             move16();
             IF (sub(st->last_core_fx, ACELP_CORE) == 0)
             {
-                IGFDecReadLevel( &st->hIGFDec, st, IGF_GRID_LB_TRAN, 1 );
-                IGFDecReadData( &st->hIGFDec, st, IGF_GRID_LB_TRAN, 1 );
+                IGFDecReadLevel( st->hIGFDec, st, IGF_GRID_LB_TRAN, 1 );
+                IGFDecReadData( st->hIGFDec, st, IGF_GRID_LB_TRAN, 1 );
 
             }
             ELSE
             {
-                IGFDecReadLevel( &st->hIGFDec, st, IGF_GRID_LB_NORM, 1 );
-                IGFDecReadData( &st->hIGFDec, st, IGF_GRID_LB_NORM, 1 );
+                IGFDecReadLevel( st->hIGFDec, st, IGF_GRID_LB_NORM, 1 );
+                IGFDecReadData( st->hIGFDec, st, IGF_GRID_LB_NORM, 1 );
             }
 
             nbits_tcx = sub(nbits_tcx, sub(st->next_bit_pos_fx, n));
@@ -998,13 +998,13 @@ void dec_prm(
             n = st->next_bit_pos_fx;
             move16();
 
-            IGFDecReadLevel( &st->hIGFDec, st, IGF_GRID_LB_SHORT, 1);
-            IGFDecReadData( &st->hIGFDec, st, IGF_GRID_LB_SHORT, 1);
-            IGFDecStoreTCX10SubFrameData( &st->hIGFDec, 0 );
+            IGFDecReadLevel( st->hIGFDec, st, IGF_GRID_LB_SHORT, 1);
+            IGFDecReadData( st->hIGFDec, st, IGF_GRID_LB_SHORT, 1);
+            IGFDecStoreTCX10SubFrameData( st->hIGFDec, 0 );
 
-            IGFDecReadLevel( &st->hIGFDec, st, IGF_GRID_LB_SHORT, 0);
-            IGFDecReadData( &st->hIGFDec, st, IGF_GRID_LB_SHORT, 0);
-            IGFDecStoreTCX10SubFrameData( &st->hIGFDec, 1 );
+            IGFDecReadLevel( st->hIGFDec, st, IGF_GRID_LB_SHORT, 0);
+            IGFDecReadData( st->hIGFDec, st, IGF_GRID_LB_SHORT, 0);
+            IGFDecStoreTCX10SubFrameData( st->hIGFDec, 1 );
 
             nbits_igf  = sub(st->next_bit_pos_fx, n);
 
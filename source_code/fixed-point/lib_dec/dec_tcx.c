@@ -226,7 +226,7 @@ void decoder_tcx(
     IF ( (sub(L_frame, shr(st->L_frame_fx, 1)) == 0) && (st->tcxonly))
     {
         IGFDecUpdateInfo(
-            &st->hIGFDec,
+            st->hIGFDec,
             IGF_GRID_LB_SHORT
         );
     }
@@ -237,14 +237,14 @@ void decoder_tcx(
         IF ((sub(st->last_core_fx, ACELP_CORE) == 0) || (left_rect && st->bfi_fx))
         {
             IGFDecUpdateInfo(
-                &st->hIGFDec,
+                st->hIGFDec,
                 IGF_GRID_LB_TRAN
             );
         }
         ELSE
         {
             IGFDecUpdateInfo(
-                &st->hIGFDec,
+                st->hIGFDec,
                 IGF_GRID_LB_NORM
             );
         }
@@ -267,7 +267,7 @@ void decoder_tcx(
     }
     ELSE
     {
-        infoIGFStartLine = s_min(st->hIGFDec.infoIGFStartLine,L_frameTCX);
+        infoIGFStartLine = s_min(st->hIGFDec->infoIGFStartLine,L_frameTCX);
         move16();
     }
 
@@ -275,7 +275,7 @@ void decoder_tcx(
     move16();
     if (st->igf != 0)
     {
-        noiseFillingSize = st->hIGFDec.infoIGFStartLine;
+        noiseFillingSize = st->hIGFDec->infoIGFStartLine;
         move16();
     }
 
@@ -770,7 +770,7 @@ void decoder_tcx(
         pInfoTCXNoise = NULL;
         if (st->igf)
         {
-            pInfoTCXNoise = st->hIGFDec.infoTCXNoise;
+            pInfoTCXNoise = st->hIGFDec->infoTCXNoise;
             move16();
         }
         tcx_noise_filling(x, x_e,
@@ -967,12 +967,12 @@ void decoder_tcx(
          && (tcx_cfg->tcx_curr_overlap_mode != FULL_OVERLAP) )
     {
         IGFDecCopyLPCFlatSpectrum(
-            &st->hIGFDec,
+            st->hIGFDec,
             x,
             x_e,
             IGF_GRID_LB_SHORT
         );
-        Copy(st->hIGFDec.igfData.igf_curr_subframe[0][0], st->hIGFDec.igfData.igf_curr_subframe[1][0], IGF_MAX_SFB);
+        Copy(st->hIGFDec->igfData.igf_curr_subframe[0][0], st->hIGFDec->igfData.igf_curr_subframe[1][0], IGF_MAX_SFB);
     }
 
     /*-----------------------------------------------------------*
@@ -985,7 +985,7 @@ void decoder_tcx(
         IF ( (sub(L_frame, shr(st->L_frame_fx, 1)) == 0) && (st->tcxonly))
         {
             IGFDecCopyLPCFlatSpectrum(
-                &st->hIGFDec,
+                st->hIGFDec,
                 x,
                 x_e,
                 IGF_GRID_LB_SHORT
@@ -996,7 +996,7 @@ void decoder_tcx(
             IF (sub(st->last_core_fx, ACELP_CORE) == 0)
             {
                 IGFDecCopyLPCFlatSpectrum(
-                    &st->hIGFDec,
+                    st->hIGFDec,
                     x,
                     x_e,
                     IGF_GRID_LB_TRAN
@@ -1005,7 +1005,7 @@ void decoder_tcx(
             ELSE
             {
                 IGFDecCopyLPCFlatSpectrum(
-                    &st->hIGFDec,
+                    st->hIGFDec,
                     x,
                     x_e,
                     IGF_GRID_LB_NORM
@@ -1101,10 +1101,10 @@ void decoder_tcx(
             igfGridIdx = IGF_GRID_LB_NORM;
         }
 
-        st->hIGFDec.igfData.igfInfo.nfSeed = extract_l(L_mac0(13849L, nf_seed, 31821));
+        st->hIGFDec->igfData.igfInfo.nfSeed = extract_l(L_mac0(13849L, nf_seed, 31821));
 
         IGFDecApplyMono(
-            &st->hIGFDec,
+            st->hIGFDec,
             x,
             &x_e,
             igfGridIdx,
@@ -1115,9 +1115,9 @@ void decoder_tcx(
     test();
     IF (st->igf && ((sub(L_frame, shr(st->L_frame_fx, 1)) == 0) && (st->tcxonly)))
     {
-        st->hIGFDec.igfData.igfInfo.nfSeed = extract_l(L_mac0(13849L, nf_seed, 31821));
+        st->hIGFDec->igfData.igfInfo.nfSeed = extract_l(L_mac0(13849L, nf_seed, 31821));
         IGFDecApplyMono(
-            &st->hIGFDec,
+            st->hIGFDec,
             x,
             &x_e,
             IGF_GRID_LB_SHORT,
@@ -1136,15 +1136,15 @@ void decoder_tcx(
     IF(st->igf)
     {
         test();
-        IF(st->hIGFDec.flatteningTrigger != 0 && fUseTns == 0)
+        IF(st->hIGFDec->flatteningTrigger != 0 && fUseTns == 0)
         {
-            Word16 startLine = st->hIGFDec.infoIGFStartLine;
-            Word16 endLine = st->hIGFDec.infoIGFStopLine;
+            Word16 startLine = st->hIGFDec->infoIGFStartLine;
+            Word16 endLine = st->hIGFDec->infoIGFStopLine;
             Word32 x_itf[N_MAX_TCX-IGF_START_MN];
             Word16 j;
 
-            const Word16* chk_sparse = st->hIGFDec.flag_sparse;
-            const Word32* virtualSpec = st->hIGFDec.virtualSpec;
+            const Word16* chk_sparse = st->hIGFDec->flag_sparse;
+            const Word32* virtualSpec = st->hIGFDec->virtualSpec;
 
             const Word16 maxOrder = 8;
             Word16 curr_order = 0; /* not counted */
@@ -1281,7 +1281,7 @@ void decoder_tcx(
 
     IF(st->igf != 0)
     {
-        set32_fx( xn_buf32+st->hIGFDec.infoIGFStartLine, 0, sub(L_frameTCX, st->hIGFDec.infoIGFStartLine) );
+        set32_fx( xn_buf32+st->hIGFDec->infoIGFStartLine, 0, sub(L_frameTCX, st->hIGFDec->infoIGFStartLine) );
     }
     IMDCT(xn_buf32, x_e,
           st->syn_Overl,
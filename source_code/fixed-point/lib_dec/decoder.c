@@ -29,7 +29,7 @@ int main(int argc, char *argv[])
 {
 #if 1
     Decoder_State_fx  *st_fx;                             /* decoder state structure     */
-    Word16            zero_pad, dec_delay,output_frame;
+    Word16            zero_pad, dec_delay,output_frame, ret;
     FILE              *f_stream;                          /* input bitstream file        */
     FILE              *f_synth;                           /* output synthesis file       */
     UWord16           bit_stream[MAX_BITS_PER_FRAME+16];
@@ -154,6 +154,8 @@ int main(int argc, char *argv[])
             SUB_WMOPS_INIT("evs_dec");
 
             /* run the main encoding routine */
+            ret = 0;
+            move16();
             IF(sub(st_fx->codec_mode, MODE1) == 0)
             {
                 IF ( st_fx->Opt_AMR_WB_fx )
@@ -162,23 +164,29 @@ int main(int argc, char *argv[])
                 }
                 ELSE
                 {
-                    evs_dec_fx( st_fx, output, FRAMEMODE_NORMAL);
+                    ret = evs_dec_fx( st_fx, output, FRAMEMODE_NORMAL);
                 }
             }
             ELSE
             {
                 IF(st_fx->bfi_fx == 0)
                 {
-                    evs_dec_fx( st_fx, output, FRAMEMODE_NORMAL);
+                    ret = evs_dec_fx( st_fx, output, FRAMEMODE_NORMAL);
                 }
                 ELSE /* conceal */
                 {
-                    evs_dec_fx( st_fx, output, FRAMEMODE_MISSING);
+                    ret = evs_dec_fx( st_fx, output, FRAMEMODE_MISSING);
                 }
             }
 
             END_SUB_WMOPS;
 
+            IF( ret != 0 )
+            {
+                fprintf(stderr, "Can not allocate memory for decoder state structure\n");
+                exit(-1);
+            }
+
 
 
             /* increase the counter of initialization frames */
@@ -66,22 +66,22 @@ void lpc_unquantize(
         IF ((L_sub(sr_core, INT_FS_16k) == 0) && (sub(coder_type, UNVOICED) == 0 ))
         {
             lsf_end_dec_fx( st, 1, GENERIC, sub(1,narrow_band) /* st->bwidth */ , 31, &lsf[m], mem_AR, mem_MA, sr_core, st->core_brate_fx,
-                            &st->offset_scale1_fx[0][0], &st->offset_scale2_fx[0][0], &st->offset_scale1_p_fx[0][0], &st->offset_scale2_p_fx[0][0],
-                            &st->no_scales_fx[0][0], &st->no_scales_p_fx[0][0], &st->safety_net_fx, param_lpc, LSF_Q_prediction, &nb_indices );
+                            &offset_scale1_fx[0][0], &offset_scale2_fx[0][0], &offset_scale1_p_fx[0][0], &offset_scale2_p_fx[0][0],
+                            &no_scales_fx[0][0], &no_scales_p_fx[0][0], &st->safety_net_fx, param_lpc, LSF_Q_prediction, &nb_indices );
         }
         ELSE
         {
             IF (sub(st->core_fx, TCX_20_CORE)==0)
             {
                 lsf_end_dec_fx( st, 1, AUDIO, sub(1, narrow_band) /* st->bwidth */ , 31, &lsf[m], mem_AR, mem_MA, sr_core, st->core_brate_fx,
-                &st->offset_scale1_fx[0][0], &st->offset_scale2_fx[0][0], &st->offset_scale1_p_fx[0][0], &st->offset_scale2_p_fx[0][0],
-                &st->no_scales_fx[0][0], &st->no_scales_p_fx[0][0], &st->safety_net_fx, param_lpc, LSF_Q_prediction, &nb_indices);
+                &offset_scale1_fx[0][0], &offset_scale2_fx[0][0], &offset_scale1_p_fx[0][0], &offset_scale2_p_fx[0][0],
+                &no_scales_fx[0][0], &no_scales_p_fx[0][0], &st->safety_net_fx, param_lpc, LSF_Q_prediction, &nb_indices);
             }
             ELSE
             {
                 lsf_end_dec_fx( st, 1, coder_type, sub(1, narrow_band) /* st->bwidth */ , 31, &lsf[m], mem_AR, mem_MA, sr_core, st->core_brate_fx,
-                &st->offset_scale1_fx[0][0], &st->offset_scale2_fx[0][0], &st->offset_scale1_p_fx[0][0], &st->offset_scale2_p_fx[0][0],
-                &st->no_scales_fx[0][0], &st->no_scales_p_fx[0][0], &st->safety_net_fx, param_lpc, LSF_Q_prediction, &nb_indices);
+                &offset_scale1_fx[0][0], &offset_scale2_fx[0][0], &offset_scale1_p_fx[0][0], &offset_scale2_p_fx[0][0],
+                &no_scales_fx[0][0], &no_scales_p_fx[0][0], &st->safety_net_fx, param_lpc, LSF_Q_prediction, &nb_indices);
             }
         }
 
@@ -14,14 +14,49 @@
 /*--------------------------------------------------------------------------*
  * evs_dec()
  *
- * Principal decoder routine
+ * Principal decoder routine, returns 1 if the state of a core cannot be allocated
  *--------------------------------------------------------------------------*/
 
-void evs_dec_fx(
+Word16 evs_dec_fx(
     Decoder_State_fx *st_fx,             /* i/o  : Decoder state structure  */
     Word16 output_sp[],                  /* o    : output synthesis signal  */
     frameMode_fx frameMode               /* i    : Decoder frame mode       */
 )
+{
+    DEC_FRAME_SYNTH dsyn;
+
+    IF( evs_dec_synth_fx( st_fx, output_sp, frameMode, &dsyn ) != 0 )
+    {
+        return 1;
+    }
+
+    /*----------------------------------------------------------------*
+     * HP filtering
+     *----------------------------------------------------------------*/
+
+    hp20( dsyn.synth, 1/*stride*/, dsyn.output_frame, st_fx->L_mem_hp_out_fx, L_mult0(dsyn.output_frame, 50) );
+
+    evs_dec_output_fx( st_fx, output_sp, &dsyn );
+
+    return 0;
+}
+
+/*--------------------------------------------------------------------------*
+ * evs_dec_synth_fx()
+ *
+ * Decode a frame up to the synthesis at the output sampling rate, before
+ * the output high-pass filter. The synthesis and what evs_dec_output_fx()
+ * needs of the frame are kept in dsyn, so that the lane decoder can run
+ * hp20_lanes_fx() across the streams in between. Returns 1 if the state of
+ * a core cannot be allocated, dsyn is not set then.
+ *--------------------------------------------------------------------------*/
+
+Word16 evs_dec_synth_fx(
+    Decoder_State_fx *st_fx,             /* i/o  : Decoder state structure  */
+    Word16 output_sp[],                  /* o    : output synthesis signal  */
+    frameMode_fx frameMode,              /* i    : Decoder frame mode       */
+    DEC_FRAME_SYNTH *dsyn                /* o    : frame synthesis          */
+)
 {
     Word16 i, j, output_frame, coder_type;
     Word16 sharpFlag;
@@ -38,7 +73,7 @@ void evs_dec_fx(
     Word16 exp,fra;
     Word16 tmp_buffer_fx[L_FRAME48k];
     Word16 tmp16,tmp16_2;
-    Word16 synth_fx[L_FRAME48k + HQ_DELTA_MAX*HQ_DELAY_COMP];
+    Word16 *synth_fx = dsyn->synth;
     Word16 fb_exc_fx[L_FRAME16k];
     Word16 pitch_buf_fx[NB_SUBFR16k];
     Word16 Q_fb_exc;
@@ -304,7 +339,10 @@ void evs_dec_fx(
         }
         ELSE
         {
-            hq_core_dec_fx( st_fx, synth_fx, &Q_synth, output_frame, hq_core_type, core_switching_flag );
+            IF( hq_core_dec_fx( st_fx, synth_fx, &Q_synth, output_frame, hq_core_type, core_switching_flag ) != 0 )
+            {
+                return 1;
+            }
             Qpostd = Q_synth;
             move16();
         }
@@ -728,8 +766,11 @@ void evs_dec_fx(
         /* DECODE CORE                                                    */
         /* -------------------------------------------------------------- */
 
-        dec_acelp_tcx_frame( st_fx, &coder_type, &concealWholeFrame, output_sp,
-                             st_fx->p_bpf_noise_buf, pcmbufFB, bwe_exc_extended_fx, voice_factors_fx, pitch_buf_fx );
+        IF( dec_acelp_tcx_frame( st_fx, &coder_type, &concealWholeFrame, output_sp,
+                                 st_fx->p_bpf_noise_buf, pcmbufFB, bwe_exc_extended_fx, voice_factors_fx, pitch_buf_fx ) != 0 )
+        {
+            return 1;
+        }
 
         concealWholeFrameTmp = concealWholeFrame;
         move16();
@@ -1323,13 +1364,51 @@ void evs_dec_fx(
     }
 
     /*----------------------------------------------------------------*
-     * HP filtering
+     * HP filter memory at the synthesis scale
      *----------------------------------------------------------------*/
 
     st_fx->Qprev_synth_buffer_fx=Qpostd;
     move16();
     Scale_sig32(st_fx->L_mem_hp_out_fx, 4, sub(Qpostd, Qpostd_prev));
-    hp20(synth_fx, 1/*stride*/, output_frame, st_fx->L_mem_hp_out_fx, L_mult0(output_frame, 50));
+
+    dsyn->output_frame = output_frame;
+    move16();
+    dsyn->Qpostd = Qpostd;
+    move16();
+    dsyn->coder_type = coder_type;
+    move16();
+    dsyn->hq_core_type = hq_core_type;
+    move16();
+    dsyn->concealWholeFrameTmp = concealWholeFrameTmp;
+    move16();
+    dsyn->frameMode = frameMode;
+    move16();
+
+    return 0;
+}
+
+/*--------------------------------------------------------------------------*
+ * evs_dec_output_fx()
+ *
+ * Write the high-pass filtered synthesis of evs_dec_synth_fx() to the
+ * output and update the decoder state at the end of the frame
+ *--------------------------------------------------------------------------*/
+
+void evs_dec_output_fx(
+    Decoder_State_fx *st_fx,             /* i/o  : Decoder state structure  */
+    Word16 output_sp[],                  /* o    : output synthesis signal  */
+    DEC_FRAME_SYNTH *dsyn                /* i/o  : filtered frame synthesis */
+)
+{
+    Word16 i;
+    Word32 L_tmp;
+    Word16 *synth_fx = dsyn->synth;
+    Word16 output_frame = dsyn->output_frame;
+    Word16 Qpostd = dsyn->Qpostd;
+    Word16 coder_type = dsyn->coder_type;
+    Word16 hq_core_type = dsyn->hq_core_type;
+    Word16 concealWholeFrameTmp = dsyn->concealWholeFrameTmp;
+    frameMode_fx frameMode = dsyn->frameMode;
 
     /*----------------------------------------------------------------*
      * Synthesis output
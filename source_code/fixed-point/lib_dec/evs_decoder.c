@@ -7,6 +7,7 @@
 #endif
 
 #include "evs_decoder.h"
+#include "mime.h"
 
 /************************************************************
 Usage : EVS_dec.exe[Options] Fs bitstream_file output_file
@@ -50,6 +51,23 @@ int InitDecoder(EvsDecoderContext* dec,int sample,int bitRate,int isG192Format)
 {
     char *strSample;
     int argc;
+
+    /* re-initialization of a running decoder starts from a fresh state */
+    if (dec->hRX != NULL)
+    {
+        EVS_RX_Close(&dec->hRX);
+        free(dec->rxPcm);
+        dec->rxPcm = NULL;
+    }
+    else if (dec->st_fx != NULL)
+    {
+        destroy_decoder(dec->st_fx);
+    }
+    free(dec->st_fx);
+    dec->st_fx = NULL;
+    free(dec->buf);
+    dec->buf = NULL;
+
     if ( (dec->st_fx = (Decoder_State_fx *) calloc(1, sizeof(Decoder_State_fx) ) ) == NULL )
     {
         fprintf(stderr, "Can not allocate memory for Decoder_State_fx state structure\n");
@@ -59,6 +77,8 @@ int InitDecoder(EvsDecoderContext* dec,int sample,int bitRate,int isG192Format)
      if ( (dec->buf = (DecoderDataBuf *) calloc( 1, sizeof(DecoderDataBuf) ) ) == NULL )
     {
         fprintf(stderr, "Can not allocate memory for EncoderDataBuf state structure\n");
+        free(dec->st_fx);
+        dec->st_fx = NULL;
         return -1;
     }
 
@@ -68,7 +88,7 @@ int InitDecoder(EvsDecoderContext* dec,int sample,int bitRate,int isG192Format)
     dec->f_synth = NULL;
     dec->jbmFECoffsetFileName = NULL;
     dec->jbmTraceFileName = NULL;
-    dec->quietMode = 0;
+    dec->quietMode = dec->quiet;
     dec-> noDelayCmp = 0;
     dec->frame  = 0;
 
@@ -158,7 +178,7 @@ int InitDecoder(EvsDecoderContext* dec,int sample,int bitRate,int isG192Format)
          fprintf( stdout, "\n------ Running the decoder ------\n\n" );
          fprintf( stdout, "Decoder Frames processed:       \n" );
      }
-     else {
+     else if (!dec->quiet) {
          fprintf( stdout, "\n-- Start the decoder (quiet mode) --\n\n" );
      }
      BASOP_end_noprint;
@@ -179,22 +199,14 @@ int InitDecoder(EvsDecoderContext* dec,int sample,int bitRate,int isG192Format)
     * - Run the decoder
     * - Write the synthesized signal into output buf
     *------------------------------------------------------------------------------------------*/
-int EvsStartDecoder(EvsDecoderContext *dec,char* data)
+/* unpack a frame into the decoder state, buf->size is -1 if it is invalid */
+static Word16 EvsReadFrame(EvsDecoderContext *dec,char* data)
 {
-    Word16   output_frame;
     Word16   ret  = 0;
 
-     if (dec == NULL && dec->st_fx  == NULL)
-     {
-         fprintf(stdout,"EvsStartDecoder dec is NULL\n");
-         return -1;
-     }
-
     /* output frame length */
-    output_frame = dec->st_fx->output_frame_fx;
-    dec->buf->size = output_frame;
+    dec->buf->size = dec->st_fx->output_frame_fx;
 
-    /*----- loop: decode-a-frame -----*/
 	if (dec->st_fx->bitstreamformat == G192)
 		ret = read_indices_fx_real(dec->st_fx, (UWord16*)data, 0);
 	else
@@ -202,8 +214,58 @@ int EvsStartDecoder(EvsDecoderContext *dec,char* data)
 
     if (ret < 0){
 		dec->buf->size = -1;
+    }
+    return ret;
+}
+
+/* count a decoded frame */
+static void EvsFrameDone(EvsDecoderContext *dec)
+{
+    /* increase the counter of initialization frames */
+    if( sub(dec->st_fx->ini_frame_fx,MAX_FRAME_COUNTER) < 0 )
+    {
+        dec->st_fx->ini_frame_fx = add(dec->st_fx->ini_frame_fx,1);
+    }
+    dec->frame++;
+}
+
+/* a frame aborted by a failed allocation leaves the decoder state inconsistent:
+   release it, the context decodes again after InitDecoder() */
+static void EvsOutOfMemory(EvsDecoderContext *dec)
+{
+    fprintf(stdout,"EvsDecoder out of memory, InitDecoder is needed\n");
+    if (dec->hRX != NULL)
+    {
+        /* closing the receiver destroys the decoder as well */
+        EVS_RX_Close(&dec->hRX);
+        free(dec->rxPcm);
+        dec->rxPcm = NULL;
+    }
+    else
+    {
+        destroy_decoder(dec->st_fx);
+    }
+    free(dec->st_fx);
+    dec->st_fx = NULL;
+    dec->buf->size = -1;
+}
+
+int EvsStartDecoder(EvsDecoderContext *dec,char* data)
+{
+    Word16   ret  = 0;
+
+     if (dec == NULL || dec->st_fx  == NULL)
+     {
+         fprintf(stdout,"EvsStartDecoder dec is NULL\n");
+         return -1;
+     }
+
+    /*----- loop: decode-a-frame -----*/
+    ret = EvsReadFrame(dec, data);
+    if (ret < 0){
         return ret;
     }
+    ret = 0;
         
 #if (WMOPS)
             fwc();
@@ -222,18 +284,18 @@ int EvsStartDecoder(EvsDecoderContext *dec,char* data)
                     }
                     else
                     {
-                       evs_dec_fx( dec->st_fx, dec->buf->data, FRAMEMODE_NORMAL);
+                       ret = evs_dec_fx( dec->st_fx, dec->buf->data, FRAMEMODE_NORMAL);
                     }
                 }
                 else
                {
                     if(dec->st_fx->bfi_fx == 0)
                     {
-                        evs_dec_fx( dec->st_fx, dec->buf->data, FRAMEMODE_NORMAL);
+                        ret = evs_dec_fx( dec->st_fx, dec->buf->data, FRAMEMODE_NORMAL);
                     }
                     else /* conceal */
                     {
-                       evs_dec_fx( dec->st_fx, dec->buf->data, FRAMEMODE_MISSING);
+                       ret = evs_dec_fx( dec->st_fx, dec->buf->data, FRAMEMODE_MISSING);
                     }
                }
             }
@@ -241,13 +303,14 @@ int EvsStartDecoder(EvsDecoderContext *dec,char* data)
 
             END_SUB_WMOPS;
 
-            /* increase the counter of initialization frames */
-            if( dec != NULL && sub(dec->st_fx->ini_frame_fx,MAX_FRAME_COUNTER) < 0 )
+            if (ret != 0)
             {
-                if(dec->st_fx != NULL)
-                dec->st_fx->ini_frame_fx = add(dec->st_fx->ini_frame_fx,1);
+                EvsOutOfMemory(dec);
+                return -1;
             }
 
+            EvsFrameDone(dec);
+
              /* write the synthesized signal into output file */
              /* do final delay compensation */
               /*if( dec->dec_delay == 0 )
@@ -267,14 +330,598 @@ int EvsStartDecoder(EvsDecoderContext *dec,char* data)
                          dec->dec_delay = sub(dec->dec_delay, output_frame);
                      }
                }*/
-            dec->frame++;
         
     return 0;
 }
 
-      
+/*------------------------------------------------------------------------------------------*
+    * Decode a frame period without payload (NO_DATA): a DTX pause between SID updates or a
+    * frame that was not received. The decoder runs comfort noise generation in DTX and
+    * frame loss concealment otherwise.
+    *------------------------------------------------------------------------------------------*/
+static char* EvsNoDataFrame(const EvsDecoderContext *dec,UWord16 frame[2])
+{
+    if (dec->st_fx->bitstreamformat == G192)
+    {
+        frame[0] = SYNC_GOOD_FRAME;
+        frame[1] = 0;
+        return (char*)frame;
+    }
+
+    *(UWord8*)frame = NO_DATA_TYPE;
+    if (dec->st_fx->amrwb_rfc4867_flag == 1)
+    {
+        *(UWord8*)frame = NO_DATA_TYPE << 3;   /* FT field of the RFC 4867 frame header */
+    }
+    return (char*)frame;
+}
+
+int EvsDecodeNoData(EvsDecoderContext *dec)
+{
+    UWord16 frame[2];
+
+    if (dec == NULL || dec->st_fx == NULL)
+    {
+        fprintf(stdout,"EvsDecodeNoData dec is NULL\n");
+        return -1;
+    }
+
+    return EvsStartDecoder(dec, EvsNoDataFrame(dec, frame));
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Decode one frame on each of n decoders, e.g. all participants of a conference in a 20 ms
+    * tick. The frames lie back to back in data, size[i] bytes for dec[i] (G.192 frames start
+    * on a word boundary), 0 for a frame period without payload as in EvsDecodeNoData().
+    * The streams are decoded in lanes of up to EVS_LANES_MAX: each runs evs_dec_synth_fx()
+    * on its own, then the streams with the same output rate run the output high-pass filter
+    * in lockstep (hp20_lanes_fx()), then each finishes its frame with evs_dec_output_fx().
+    * A stream alone at its output rate takes the scalar filter, an AMR-WB IO frame the whole
+    * scalar decoder. Every stream keeps its own state and output buf, bit-exact to
+    * EvsStartDecoder(). Returns the number of streams not decoded, their buf->size is -1.
+    *------------------------------------------------------------------------------------------*/
+int EvsDecodeLanes(EvsDecoderContext **dec,char* data,const int *size,int n)
+{
+    DEC_FRAME_SYNTH dsyn[EVS_LANES_MAX];
+    Word16 pending[EVS_LANES_MAX];
+    Word16 *signal[EVS_LANES_MAX];
+    Word32 *mem[EVS_LANES_MAX];
+    UWord16 noData[2];
+    EvsDecoderContext *d;
+    Decoder_State_fx *st;
+    char *frame;
+    int i, j, m, count, lanes, offset = 0, failed = 0;
+
+    for (m = 0; m < n; m += EVS_LANES_MAX)
+    {
+        count = n - m < EVS_LANES_MAX ? n - m : EVS_LANES_MAX;
+
+        /* synthesis of each stream up to the output high-pass filter */
+        for (i = 0; i < count; offset += size[m + i], i++)
+        {
+            d = dec[m + i];
+            pending[i] = 0;
+            if (d == NULL || d->st_fx == NULL || d->hRX != NULL)
+            {
+                /* the receiver of EvsRxOpen() decodes in EvsRxGetSamples() */
+                if (d != NULL && d->buf != NULL)
+                {
+                    d->buf->size = -1;
+                }
+                failed++;
+                continue;
+            }
+            frame = size[m + i] > 0 ? data + offset : EvsNoDataFrame(d, noData);
+            if (EvsReadFrame(d, frame) < 0)
+            {
+                failed++;
+                continue;
+            }
+            st = d->st_fx;
+            if (sub(st->codec_mode, MODE1) == 0 && st->Opt_AMR_WB_fx)
+            {
+                amr_wb_dec_fx(d->buf->data, st);
+                EvsFrameDone(d);
+                continue;
+            }
+            if (evs_dec_synth_fx(st, d->buf->data, sub(st->codec_mode, MODE1) != 0 && st->bfi_fx != 0 ? FRAMEMODE_MISSING : FRAMEMODE_NORMAL, &dsyn[i]) != 0)
+            {
+                EvsOutOfMemory(d);
+                failed++;
+                continue;
+            }
+            pending[i] = 1;
+        }
+
+        /* output high-pass filter in lockstep across the streams of each output rate */
+        for (i = 0; i < count; i++)
+        {
+            if (pending[i] != 1)
+            {
+                continue;
+            }
+            lanes = 0;
+            for (j = i; j < count; j++)
+            {
+                if (pending[j] == 1 && dsyn[j].output_frame == dsyn[i].output_frame)
+                {
+                    signal[lanes] = dsyn[j].synth;
+                    mem[lanes] = dec[m + j]->st_fx->L_mem_hp_out_fx;
+                    lanes++;
+                    pending[j] = 2;
+                }
+            }
+            if (lanes > 1)
+            {
+                hp20_lanes_fx(signal, lanes, dsyn[i].output_frame, mem, L_mult0(dsyn[i].output_frame, 50));
+            }
+            else
+            {
+                hp20(signal[0], 1/*stride*/, dsyn[i].output_frame, mem[0], L_mult0(dsyn[i].output_frame, 50));
+            }
+        }
+
+        /* end of the frame of each stream */
+        for (i = 0; i < count; i++)
+        {
+            if (pending[i] != 0)
+            {
+                d = dec[m + i];
+                evs_dec_output_fx(d->st_fx, d->buf->data, &dsyn[i]);
+                EvsFrameDone(d);
+            }
+        }
+    }
+
+    return failed;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Decode one frame on each of n decoders as EvsDecodeLanes() and mix the pcm, e.g. for a
+    * conference bridge. Participant i is scaled by gain[i] (Q12, EVS_MIX_GAIN_UNITY = 0 dB,
+    * NULL: all 0 dB) and added to bus b of the nBus (up to EVS_MIX_BUS_MAX) 32 bit mix buses
+    * if bit b of busMask[i] is set (NULL: all on bus 0). mix receives the nBus frames back to
+    * back, nMinusOne (may be NULL) n frames: bus 0 without the participant's own contribution.
+    * Sums are saturated to 16 bit once, at the output. All decoders need the same output rate,
+    * a stream that is not decoded adds nothing. Returns the number of streams not decoded,
+    * -1 for invalid arguments.
+    *------------------------------------------------------------------------------------------*/
+int EvsDecodeMix(EvsDecoderContext **dec,char* data,const int *size,int n,const Word16 *gain,const unsigned int *busMask,int nBus,Word16 *mix,Word16 *nMinusOne)
+{
+    Word32 bus[EVS_MIX_BUS_MAX * L_FRAME48k];
+    Word32 *acc, s;
+    const Word16 *pcm;
+    Word32 g;
+    unsigned int mask;
+    int i, j, b, failed, frameLen;
+
+    if (n <= 0 || dec == NULL || dec[0] == NULL || dec[0]->st_fx == NULL ||
+        nBus <= 0 || nBus > EVS_MIX_BUS_MAX || mix == NULL)
+    {
+        fprintf(stderr,"EvsDecodeMix invalid arguments\n");
+        return -1;
+    }
+    frameLen = dec[0]->st_fx->output_frame_fx;
+    for (i = 1; i < n; i++)
+    {
+        if (dec[i] == NULL || dec[i]->st_fx == NULL || dec[i]->st_fx->output_frame_fx != frameLen)
+        {
+            fprintf(stderr,"EvsDecodeMix needs decoders of the same output rate\n");
+            return -1;
+        }
+    }
+
+    failed = EvsDecodeLanes(dec, data, size, n);
+
+    /* mix in 32 bit without saturation, plain C so that the compiler can vectorize the loops */
+    memset(bus, 0, nBus * frameLen * sizeof(Word32));
+    for (i = 0; i < n; i++)
+    {
+        if (dec[i]->buf->size != frameLen)
+        {
+            continue;
+        }
+        pcm = dec[i]->buf->data;
+        g = gain != NULL ? gain[i] : EVS_MIX_GAIN_UNITY;
+        mask = busMask != NULL ? busMask[i] : 1;
+        for (b = 0; b < nBus; b++)
+        {
+            if ((mask >> b) & 1)
+            {
+                acc = bus + b * frameLen;
+                for (j = 0; j < frameLen; j++)
+                {
+                    acc[j] += (pcm[j] * g) >> 12;
+                }
+            }
+        }
+    }
+
+    for (j = 0; j < nBus * frameLen; j++)
+    {
+        s = bus[j];
+        mix[j] = (Word16)(s > MAX_16 ? MAX_16 : (s < MIN_16 ? MIN_16 : s));
+    }
+
+    if (nMinusOne != NULL)
+    {
+        for (i = 0; i < n; i++)
+        {
+            pcm = dec[i]->buf->data;
+            g = gain != NULL ? gain[i] : EVS_MIX_GAIN_UNITY;
+            mask = busMask != NULL ? busMask[i] : 1;
+            if (dec[i]->buf->size != frameLen || (mask & 1) == 0)
+            {
+                g = 0;                              /* not heard on bus 0 */
+            }
+            for (j = 0; j < frameLen; j++)
+            {
+                s = bus[j] - ((pcm[j] * g) >> 12);
+                nMinusOne[i * frameLen + j] = (Word16)(s > MAX_16 ? MAX_16 : (s < MIN_16 ? MIN_16 : s));
+            }
+        }
+    }
+
+    return failed;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Decode AMR-WB frames in the RFC 4867 storage format (clause 5.3: frame header |P|FT|Q|P|P|
+    * and the speech bits) instead of EVS MIME frames, as read from a "#!AMR-WB\n" file by the
+    * reference decoder. The frames are decoded in AMR-WB IO mode. Set after InitDecoder() with
+    * the MIME format, before the first frame; not available with the receiver of EvsRxOpen().
+    *------------------------------------------------------------------------------------------*/
+int EvsSetAmrWbInput(EvsDecoderContext *dec,int enable)
+{
+    if (dec == NULL || dec->st_fx == NULL)
+    {
+        fprintf(stdout,"EvsSetAmrWbInput dec is NULL\n");
+        return -1;
+    }
+
+    if (dec->st_fx->bitstreamformat == G192 || dec->hRX != NULL)
+    {
+        fprintf(stderr,"EvsSetAmrWbInput needs the MIME format without receiver\n");
+        return -1;
+    }
+
+    if (enable)
+    {
+        dec->st_fx->amrwb_rfc4867_flag = 1;
+        dec->st_fx->Opt_AMR_WB_fx = 1;   /* in case the first frames are lost */
+    }
+    else
+    {
+        dec->st_fx->amrwb_rfc4867_flag = 0;
+    }
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Enable or disable the NB/WB formant and pitch post-filter (enabled after InitDecoder).
+    * With the post-filter off the core synthesis is output as decoded, e.g. for transcoding
+    * chains where the next encoder analyses the signal again.
+    *------------------------------------------------------------------------------------------*/
+int EvsSetPostFilter(EvsDecoderContext *dec,int enable)
+{
+    if (dec == NULL || dec->st_fx == NULL)
+    {
+        fprintf(stdout,"EvsSetPostFilter dec is NULL\n");
+        return -1;
+    }
+
+    dec->st_fx->pfstat.bypass = (enable == 0);
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Leave out the information printouts of InitDecoder() and StopDecoder(), e.g. when many
+    * streams are decoded at once. Set before InitDecoder(), kept across re-initializations.
+    *------------------------------------------------------------------------------------------*/
+int EvsSetDecoderQuiet(EvsDecoderContext *dec,int enable)
+{
+    if (dec == NULL)
+    {
+        fprintf(stderr,"EvsSetDecoderQuiet dec is NULL\n");
+        return -1;
+    }
+
+    dec->quiet = (Word16)(enable != 0);
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Packet-based receive path, opened after InitDecoder(): received packets go through the
+    * jitter buffer manager (JBM) of the EVS VoIP receiver, which orders them by RTP timestamp,
+    * adapts the playout delay by time scaling and replaces a lost frame by the partial copy of
+    * a later channel-aware packet, or conceals it. jbmSafetyMargin is the delay reserve in ms
+    * in addition to the network jitter (60 in the reference VoIP decoder). Frames are fed with
+    * EvsRxFeedPacket() and played out every 20 ms with EvsRxGetSamples(), EvsStartDecoder()
+    * is not used on the context anymore.
+    *------------------------------------------------------------------------------------------*/
+int EvsRxOpen(EvsDecoderContext *dec,int jbmSafetyMargin)
+{
+    Word16 bypass;
+
+    if (dec == NULL || dec->st_fx == NULL)
+    {
+        fprintf(stdout,"EvsRxOpen dec is NULL\n");
+        return -1;
+    }
+
+    if (dec->hRX != NULL)
+    {
+        fprintf(stdout,"EvsRxOpen receiver is already open\n");
+        return -1;
+    }
+
+    if ( (dec->rxPcm = (Word16 *) calloc( EVS_RX_PCM_BUF_SIZE, sizeof(Word16) ) ) == NULL )
+    {
+        fprintf(stderr, "Can not allocate memory for the receiver output buffer\n");
+        return -1;
+    }
+
+    if (EVS_RX_Open(&dec->hRX, dec->st_fx, (Word16)jbmSafetyMargin) != EVS_RX_NO_ERROR)
+    {
+        /* a failed open closes the receiver, which destroys the decoder state: initialize it
+           again, so that the context keeps decoding frame by frame */
+        fprintf(stderr, "EvsRxOpen unable to open receiver\n");
+        bypass = dec->st_fx->pfstat.bypass;
+        destroy_decoder( dec->st_fx );
+        init_decoder_fx( dec->st_fx );
+        dec->st_fx->pfstat.bypass = bypass;
+        free(dec->rxPcm);
+        dec->rxPcm = NULL;
+        return -1;
+    }
+
+    /* the receiver initializes the decoder again with the first received frame */
+    destroy_decoder( dec->st_fx );
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Unpack a frame in the input format of the decoder (MIME ToC byte and payload, or G.192)
+    * into the compact codec bit order of the receiver, AMR-WB IO payloads are sorted back
+    * from the RFC 4867 bit order. Returns the number of bits, 0 for a frame without data
+    * (NO_DATA, SPEECH_LOST, bad frame or AMR-WB IO SID_FIRST) and -1 for an invalid frame.
+    *------------------------------------------------------------------------------------------*/
+static Word16 rx_unpack_frame(const EvsDecoderContext *dec, const char *data, UWord8 *au)
+{
+    const UWord16 *g192;
+    const UWord8 *payload;
+    UWord8 header;
+    Word16 k, pos, num_bits, core_mode, isAMRWB_IOmode;
+    Word32 total_brate;
+
+    memset(au, 0, (MAX_BITS_PER_FRAME + 7) >> 3);
+
+    if (dec->st_fx->bitstreamformat == G192)
+    {
+        g192 = (const UWord16*)data;
+        num_bits = (Word16)g192[1];
+        if (g192[0] != SYNC_GOOD_FRAME)
+        {
+            return 0;
+        }
+        if (num_bits < 0 || num_bits > MAX_BITS_PER_FRAME)
+        {
+            return -1;
+        }
+        for (k = 0; k < num_bits; k++)
+        {
+            if (g192[2 + k] == G192_BIN1)
+            {
+                au[k >> 3] |= 0x80 >> (k & 7);
+            }
+        }
+        return num_bits;
+    }
+
+    header = (UWord8)data[0];
+    payload = (const UWord8*)data + 1;
+    isAMRWB_IOmode = (header & 0x20) != 0;
+    core_mode = header & 0x0F;
+
+    if ((header & 0xC0) != 0 || (isAMRWB_IOmode == 0 && (header & 0x10) != 0))
+    {
+        return -1;
+    }
+
+    if (isAMRWB_IOmode)
+    {
+        if ((header & 0x10) == 0)
+        {
+            /* Q bit cleared: damaged frame, concealed like a lost one */
+            return 0;
+        }
+        total_brate = AMRWB_IOmode2rate[core_mode];
+    }
+    else
+    {
+        total_brate = PRIMARYmode2rate[core_mode];
+    }
+
+    if (total_brate < 0)
+    {
+        return -1;
+    }
+
+    num_bits = (Word16)(total_brate / 50);
+    for (k = 0; k < num_bits; k++)
+    {
+        pos = isAMRWB_IOmode ? sort_ptr[core_mode][k] : k;
+        if ((payload[k >> 3] >> (7 - (k & 7))) & 0x1)
+        {
+            au[pos >> 3] |= 0x80 >> (pos & 7);
+        }
+    }
+
+    /* the STI bit after the AMR-WB IO SID parameters tells SID_FIRST, which carries none */
+    if (isAMRWB_IOmode && total_brate == SID_1k75 && ((payload[num_bits >> 3] >> (7 - (num_bits & 7))) & 0x1) == 0)
+    {
+        return 0;
+    }
+
+    return num_bits;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Feed a received packet of one frame into the jitter buffer: data is a frame as for
+    * EvsStartDecoder(), seq the RTP sequence number, timeStamp the RTP timestamp in ms and
+    * rcvTime the arrival time in ms on the EvsRxGetSamples() clock. Frames without data are
+    * not buffered, the receiver fills their period with comfort noise or concealment.
+    *------------------------------------------------------------------------------------------*/
+int EvsRxFeedPacket(EvsDecoderContext *dec,char* data,int seq,unsigned int timeStamp,unsigned int rcvTime)
+{
+    UWord8 au[(MAX_BITS_PER_FRAME + 7) >> 3];
+    Word16 num_bits;
+
+    if (dec == NULL || dec->hRX == NULL || data == NULL)
+    {
+        fprintf(stdout,"EvsRxFeedPacket receiver is not open\n");
+        return -1;
+    }
+
+    num_bits = rx_unpack_frame(dec, data, au);
+    if (num_bits < 0)
+    {
+        fprintf(stdout,"EvsRxFeedPacket invalid frame header\n");
+        return -1;
+    }
+    if (num_bits == 0)
+    {
+        return 0;
+    }
+
+    if (EVS_RX_FeedFrame(dec->hRX, au, num_bits, (Word16)seq, (Word32)timeStamp, (Word32)rcvTime) != EVS_RX_NO_ERROR)
+    {
+        fprintf(stdout,"EvsRxFeedPacket error in feeding access unit\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Play out the next 20 ms into the output buf at systemTime (ms, advanced by 20 per call):
+    * decodes, conceals or recovers from a partial copy as many frames as the time scaling
+    * needs. The first frames are silence until the jitter buffer is filled.
+    *------------------------------------------------------------------------------------------*/
+int EvsRxGetSamples(EvsDecoderContext *dec,unsigned int systemTime)
+{
+    Word16 nSamples = 0;
+    EVS_RX_ERROR err;
+
+    if (dec == NULL || dec->hRX == NULL)
+    {
+        fprintf(stdout,"EvsRxGetSamples receiver is not open\n");
+        return -1;
+    }
+
+    err = EVS_RX_GetSamples(dec->hRX, &nSamples, dec->rxPcm, EVS_RX_PCM_BUF_SIZE, (Word32)systemTime);
+    if (err == EVS_RX_MEMORY_ERROR)
+    {
+        EvsOutOfMemory(dec);
+        return -1;
+    }
+    if (err != EVS_RX_NO_ERROR)
+    {
+        fprintf(stdout,"EvsRxGetSamples error in getting samples\n");
+        dec->buf->size = -1;
+        return -1;
+    }
+
+    memcpy(dec->buf->data, dec->rxPcm, nSamples * sizeof(Word16));
+    dec->buf->size = nSamples;
+    dec->frame++;
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Channel-aware configuration the JBM finds best for the observed losses (TS 26.448 6.3.1),
+    * for the far end's encoder, e.g. as CMR: FEC indicator 0 (LO) or 1 (HI) and offset 2, 3,
+    * 5 or 7 frames, 0 before an offset could be derived.
+    *------------------------------------------------------------------------------------------*/
+int EvsRxGetFecOffset(EvsDecoderContext *dec,int *fecIndicator,int *offset)
+{
+    Word16 optimum_offset, FEC_hi;
+
+    if (dec == NULL || dec->hRX == NULL)
+    {
+        fprintf(stdout,"EvsRxGetFecOffset receiver is not open\n");
+        return -1;
+    }
+
+    EVS_RX_Get_FEC_offset(dec->hRX, &optimum_offset, &FEC_hi);
+
+    if ( optimum_offset == 1 || optimum_offset == 2 )
+    {
+        optimum_offset = 2;
+    }
+    else if ( optimum_offset == 3 || optimum_offset == 4 )
+    {
+        optimum_offset = 3;
+    }
+    else if ( optimum_offset == 5 || optimum_offset == 6 )
+    {
+        optimum_offset = 5;
+    }
+    else if ( optimum_offset >= 7)
+    {
+        optimum_offset = 7;
+    }
+
+    *fecIndicator = FEC_hi;
+    *offset = optimum_offset;
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Number of frames the receiver decoded, of those concealed (lost, late or inserted by the
+    * time scaling) and of those recovered from a partial copy
+    *------------------------------------------------------------------------------------------*/
+int EvsRxGetStatistics(EvsDecoderContext *dec,int *decoded,int *concealed,int *partialCopy)
+{
+    Word32 nDecoded, nConcealed, nPartialCopy;
+
+    if (dec == NULL || dec->hRX == NULL)
+    {
+        fprintf(stdout,"EvsRxGetStatistics receiver is not open\n");
+        return -1;
+    }
+
+    EVS_RX_GetStatistics(dec->hRX, &nDecoded, &nConcealed, &nPartialCopy);
+    *decoded = nDecoded;
+    *concealed = nConcealed;
+    *partialCopy = nPartialCopy;
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * 1 when the jitter buffer holds no more frames, to drain it at the end of a call
+    *------------------------------------------------------------------------------------------*/
+int EvsRxIsEmpty(EvsDecoderContext *dec)
+{
+    if (dec == NULL || dec->hRX == NULL)
+    {
+        return 1;
+    }
+
+    return EVS_RX_IsEmpty(dec->hRX);
+}
+
 int StopDecoder(EvsDecoderContext *dec)
 {
+    Word16 quiet;
+
     if(dec == NULL){
        return -1;
     }
@@ -287,7 +934,7 @@ int StopDecoder(EvsDecoderContext *dec)
           fprintf( stdout, "\n\n" );
           fprintf( stdout, "EVS Decoding finished:       " );
     }
-    else
+    else if (!dec->quiet)
     {
          fprintf(stdout,"EVS Decoding of %ld frames finished\n\n", dec->frame);
     }
@@ -300,26 +947,51 @@ int StopDecoder(EvsDecoderContext *dec)
      fprintf("\n");
 #endif
 
+    quiet = dec->quiet;
+    FreeDecoder(dec);
+
+     if (!quiet)
+     {
+         fprintf( stdout, "EVS StopDecoder success\n\n" );
+     }
+     fflush(stdout);
+     fflush(stderr);
+
+     return 0;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Release a decoder context at once, e.g. in batch processing. StopDecoder() first waits
+    * for calls still running on the context.
+    *------------------------------------------------------------------------------------------*/
+int FreeDecoder(EvsDecoderContext *dec)
+{
+    if (dec == NULL)
+    {
+        return -1;
+    }
+
     if(dec->f_synth){
      fwrite( dec->buf->data, sizeof(Word16), dec->zero_pad, dec->f_synth );
      fclose( dec->f_synth );
     }
 
      /* free memory etc. */
-     if(dec->st_fx)
+     if(dec->hRX)
+     {
+        /* closing the receiver destroys the decoder as well */
+        EVS_RX_Close( &dec->hRX );
+        free( dec->rxPcm );
+     }
+     else if(dec->st_fx)
      {
         destroy_decoder( dec->st_fx );
      }
+     free( dec->st_fx );
+     free( dec->buf );
 
      if(dec->f_stream)  fclose( dec->f_stream );
-     if(dec) {
-       free(dec);
-       dec = NULL;
-     }
-
-     fprintf( stdout, "EVS StopDecoder success\n\n" );
-     fflush(stdout);
-     fflush(stderr);
+     free(dec);
 
      return 0;
 }
@@ -20,6 +20,11 @@
 
 #include "EvsRXlib.h"
 
+#define EVS_RX_PCM_BUF_SIZE   (3*L_FRAME48k)          /* a time scaled frame is up to 2 frames long */
+#define EVS_LANES_MAX         DEC_LANES_MAX           /* streams decoded in one lane by EvsDecodeLanes() */
+#define EVS_MIX_BUS_MAX       8                       /* mix buses of EvsDecodeMix() */
+#define EVS_MIX_GAIN_UNITY    4096                    /* 0 dB participant gain of EvsDecodeMix(), Q12 */
+
 typedef struct DecoderDataBuf{
    Word16        data[L_FRAME48k];
    short size;
@@ -30,6 +35,7 @@ typedef struct EvsDecoderContext
 	int mode;
 	long frame;
 	Word16 quietMode;
+	Word16 quiet;                       /* no information printouts, EvsSetDecoderQuiet() */
 	Word16 noDelayCmp;
 	Word16 dec_delay;
 	Word16 zero_pad;
@@ -40,12 +46,27 @@ typedef struct EvsDecoderContext
 	FILE *f_synth; 						/* output synthesis file     */
 	Decoder_State_fx * st_fx;
 	DecoderDataBuf* buf;
+	EVS_RX_HANDLE hRX;                  /* jitter buffer receiver of EvsRxOpen(), NULL otherwise */
+	Word16 *rxPcm;                      /* time scaler output of the receiver, EVS_RX_PCM_BUF_SIZE */
 }EvsDecoderContext;
 
 EvsDecoderContext* NewEvsDecoder(void);
 int InitDecoder(EvsDecoderContext *dec,int sample,int bitRate, int isG192Format);
 int EvsStartDecoder(EvsDecoderContext *dec,char* data);
+int EvsDecodeNoData(EvsDecoderContext *dec);
+int EvsDecodeLanes(EvsDecoderContext **dec,char* data,const int *size,int n);
+int EvsDecodeMix(EvsDecoderContext **dec,char* data,const int *size,int n,const Word16 *gain,const unsigned int *busMask,int nBus,Word16 *mix,Word16 *nMinusOne);
+int EvsSetPostFilter(EvsDecoderContext *dec,int enable);
+int EvsSetDecoderQuiet(EvsDecoderContext *dec,int enable);
+int EvsSetAmrWbInput(EvsDecoderContext *dec,int enable);
+int EvsRxOpen(EvsDecoderContext *dec,int jbmSafetyMargin);
+int EvsRxFeedPacket(EvsDecoderContext *dec,char* data,int seq,unsigned int timeStamp,unsigned int rcvTime);
+int EvsRxGetSamples(EvsDecoderContext *dec,unsigned int systemTime);
+int EvsRxGetFecOffset(EvsDecoderContext *dec,int *fecIndicator,int *offset);
+int EvsRxGetStatistics(EvsDecoderContext *dec,int *decoded,int *concealed,int *partialCopy);
+int EvsRxIsEmpty(EvsDecoderContext *dec);
 int StopDecoder(EvsDecoderContext *dec);
+int FreeDecoder(EvsDecoderContext *dec);
 int UnitTestEvsDecoder(void);
 
 #endif
\ No newline at end of file
@@ -339,6 +339,41 @@ void deleteFdCngDec (HANDLE_FD_CNG_DEC *hFdCngDec)
 }
 
 
+/*
+   sum_noise_levels
+
+    Parameters:
+
+    x                i  : noise levels
+    n                i  : number of levels
+    L_c              o  : high word of the sum
+
+    Function:
+    64-bit sum of the noise levels as a pair of words for norm_llQ31();
+    gives the same words as accumulating with L_add_c() and L_macNs()/L_msuNs()
+
+    Returns:
+    low word of the sum
+*/
+static Word32 sum_noise_levels (const Word32 *x, Word16 n, Word32 *L_c)
+{
+    Word16 i;
+    Word40 L_sum;
+
+
+    L_sum = 0;
+    FOR (i=0; i < n; i++)
+    {
+        L_sum += x[i];
+    }
+
+    *L_c = (Word32)(L_sum >> 32);
+    move32();
+
+    return (Word32)(UWord32)L_sum;
+}
+
+
 /*
    ApplyFdCng
 
@@ -558,24 +593,7 @@ Word16 ApplyFdCng (Word16  *timeDomainInput,        /* i  : pointer to time doma
             }
             /*stdec->cngTDLevel = (float)sqrt( (sumFLOAT(cngNoiseLevel, st->hFdCngCom->stopFFTbin - st->hFdCngCom->startBand) / 2 * st->hFdCngCom->fftlen) / stdec->Mode2_L_frame);*/
             tmp_loop = sub(st->hFdCngCom->stopFFTbin , st->hFdCngCom->startBand);
-            L_tmp = L_deposit_h(0);
-            L_c = L_deposit_h(0);
-            FOR(j = 0 ; j < tmp_loop; j++)
-            {
-
-                Carry = 0;
-                L_tmp = L_add_c(L_tmp,*(cngNoiseLevel+j));
-                Overflow = 0;
-
-                if(*(cngNoiseLevel+j) < 0)
-                {
-                    L_c = L_msuNs(L_c,0,0);
-                }
-                if(*(cngNoiseLevel+j) >= 0)
-                {
-                    L_c = L_macNs(L_c,0,0);
-                }
-            }
+            L_tmp = sum_noise_levels(cngNoiseLevel, tmp_loop, &L_c);
             L_tmp = norm_llQ31(L_c,L_tmp,&L_tmp_exp);
             L_tmp_exp = sub(add(L_tmp_exp,*cngNoiseLevel_exp),1);
 
@@ -591,25 +609,28 @@ Word16 ApplyFdCng (Word16  *timeDomainInput,        /* i  : pointer to time doma
 
 
         }
+        /* the level sum is only needed in the first lost frame */
         test();
-        test();
-        L_tmp = 0;
-        FOR( j=st->hFdCngCom->startBand; j<st->hFdCngCom->stopFFTbin; j++ )
-        {
-            L_tmp = L_add(L_tmp,L_shr(cngNoiseLevel[j],16));
-        }
-        L_tmp_exp = add(*cngNoiseLevel_exp,16);
-        IF (sub(concealWholeFrame,1)==0 && sub(stdec->nbLostCmpt,1)==0 && (L_shl(L_tmp,L_tmp_exp)>21474836 /*0.01f Q31*/))
+        IF (sub(concealWholeFrame,1)==0 && sub(stdec->nbLostCmpt,1)==0)
         {
-            /* update isf cng estimate for concealment. Do that during concealment, in order to avoid addition clean channel complexity*/
-            lpc_from_spectrum(cngNoiseLevel, *cngNoiseLevel_exp, st->hFdCngCom->startBand, st->hFdCngCom->stopFFTbin, st->hFdCngCom->fftlen, st->hFdCngCom->A_cng,
-                              M, 0);
-            E_LPC_a_lsp_conversion( st->hFdCngCom->A_cng, lsp_cng, stdec->lspold_cng, M );
-            Copy( lsp_cng, stdec->lspold_cng, M);
-
-            lsp2lsf_fx( lsp_cng, stdec->lsf_cng, M, stdec->sr_core );
-            stdec->plcBackgroundNoiseUpdated = 1;
-            move16();
+            L_tmp = 0;
+            FOR( j=st->hFdCngCom->startBand; j<st->hFdCngCom->stopFFTbin; j++ )
+            {
+                L_tmp = L_add(L_tmp,L_shr(cngNoiseLevel[j],16));
+            }
+            L_tmp_exp = add(*cngNoiseLevel_exp,16);
+            IF (L_shl(L_tmp,L_tmp_exp)>21474836 /*0.01f Q31*/)
+            {
+                /* update isf cng estimate for concealment. Do that during concealment, in order to avoid addition clean channel complexity*/
+                lpc_from_spectrum(cngNoiseLevel, *cngNoiseLevel_exp, st->hFdCngCom->startBand, st->hFdCngCom->stopFFTbin, st->hFdCngCom->fftlen, st->hFdCngCom->A_cng,
+                                  M, 0);
+                E_LPC_a_lsp_conversion( st->hFdCngCom->A_cng, lsp_cng, stdec->lspold_cng, M );
+                Copy( lsp_cng, stdec->lspold_cng, M);
+
+                lsp2lsf_fx( lsp_cng, stdec->lsf_cng, M, stdec->sr_core );
+                stdec->plcBackgroundNoiseUpdated = 1;
+                move16();
+            }
         }
         BREAK;
 
@@ -639,24 +660,7 @@ Word16 ApplyFdCng (Word16  *timeDomainInput,        /* i  : pointer to time doma
 
             /*stdec->cngTDLevel = (float)sqrt( (sumFLOAT(cngNoiseLevel, st->hFdCngCom->stopFFTbin - st->hFdCngCom->startBand) / 2 * st->hFdCngCom->fftlen) / stdec->Mode2_L_frame);*/
             tmp_loop = sub(st->hFdCngCom->stopFFTbin , st->hFdCngCom->startBand);
-            L_tmp = L_deposit_h(0);
-            L_c = L_deposit_h(0);
-            FOR(j = 0 ; j < tmp_loop; j++)
-            {
-
-                Carry = 0;
-                L_tmp = L_add_c(L_tmp,*(cngNoiseLevel+j));
-                Overflow = 0;
-
-                if(*(cngNoiseLevel+j) < 0)
-                {
-                    L_c = L_msuNs(L_c,0,0);
-                }
-                if(*(cngNoiseLevel+j) >= 0)
-                {
-                    L_c = L_macNs(L_c,0,0);
-                }
-            }
+            L_tmp = sum_noise_levels(cngNoiseLevel, tmp_loop, &L_c);
             L_tmp = norm_llQ31(L_c,L_tmp,&L_tmp_exp);
             L_tmp_exp = sub(add(L_tmp_exp,*cngNoiseLevel_exp),1);
 
@@ -847,7 +851,7 @@ void perform_noise_estimation_dec (const Word16 *timeDomainInput, /* i:   pointe
                                   )
 {
     Word16  i, tmp_r, tmp_i, fac, fftBuffer_exp;
-    Word16  s, len, npart, nFFTpart;
+    Word16  s, sl, sr, len, npart, nFFTpart;
     Word16  startBand, stopFFTbin;
 
     Word16 *part, *psize_inv, *psize_norm;
@@ -911,13 +915,17 @@ void perform_noise_estimation_dec (const Word16 *timeDomainInput, /* i:   pointe
         ptr_r = fftBuffer + shl(startBand, 1);
     }
 
+    /* s keeps one bit of headroom: L_shl() cannot saturate and |tmp_r|,|tmp_i| <= 2^14,
+       so the periodogram below is exact without basic operators */
+    sl = s_max(s,0);
+    sr = sub(16,s_min(s,0));
     ptr_i = ptr_r+1;
     FOR (i=0; i < len; i++)
     {
-        tmp_r = extract_h(L_shl(*ptr_r,s));
-        tmp_i = extract_h(L_shl(*ptr_i,s));
+        tmp_r = (Word16)(((Word40)*ptr_r * ((Word40)1 << sl)) >> sr);
+        tmp_i = (Word16)(((Word40)*ptr_i * ((Word40)1 << sl)) >> sr);
 
-        tmp = L_mac(L_mult(tmp_r, tmp_r),tmp_i, tmp_i);
+        tmp = 2 * ((Word32)tmp_r * tmp_r + (Word32)tmp_i * tmp_i);
         *ptr_per = tmp;
 
         ptr_r += 2;
@@ -957,7 +965,8 @@ void perform_noise_estimation_dec (const Word16 *timeDomainInput, /* i:   pointe
     len = sub(stopFFTbin, startBand);
     FOR (i=0; i < len; i++)
     {
-        st->hFdCngCom->periodog[i] = Mpy_32_16_1(st->hFdCngCom->periodog[i],fac);
+        /* Mpy_32_16_1(), the periodogram is non-negative */
+        st->hFdCngCom->periodog[i] = (Word32)(((Word40)st->hFdCngCom->periodog[i] * fac) >> 15);
     }
     st->hFdCngCom->periodog_exp = add(st->hFdCngCom->periodog_exp,sub(2,s));
 
@@ -1272,6 +1281,162 @@ void noisy_speech_detection (const Word16 vad,
 }
 
 
+/*
+   scale_rand_gauss
+
+    Parameters:
+
+    noise            i  : Gaussian random sample from rand_gauss()
+    level            i  : amplitude
+    s                i  : shift applied to the product
+
+    Function:
+    L_shl(Mpy_32_32(noise,level),s) without basic operator calls.
+    |noise| <= 3*2^29, so Mpy_32_32() cannot saturate; the shift
+    saturates like L_shl()
+
+    Returns:
+    scaled random sample
+*/
+static Word32 scale_rand_gauss (Word32 noise, Word32 level, Word16 s)
+{
+    Word40 L_tmp;
+
+
+    L_tmp = ((Word40)noise * level) >> 31;
+
+    if ( s <= 0 )
+    {
+        return (Word32)(L_tmp >> (s < -31 ? 31 : -s));
+    }
+
+    L_tmp = L_tmp * ((Word40)1 << (s > 32 ? 32 : s));
+    if ( L_tmp > MAX_32 )
+    {
+        L_tmp = MAX_32;
+    }
+    if ( L_tmp < MIN_32 )
+    {
+        L_tmp = MIN_32;
+    }
+
+    return (Word32)L_tmp;
+}
+
+
+/*
+   get_sqrt_noise_levels
+
+    Parameters:
+
+    st               i/o: FD_CNG structure containing all buffers and variables
+    nBands           i  : number of CLDFB bands following the FFT bins
+    scaleCLDFB       i  : scaling of the CLDFB band levels
+
+    Function:
+    Square roots of the comfort noise levels, as applied by generate_comfort_noise_dec().
+    The levels only change on SID updates, so the square roots are kept in st and
+    only recomputed when the levels, their exponent or the band layout changed.
+
+    Returns:
+    void
+*/
+static void get_sqrt_noise_levels (HANDLE_FD_CNG_COM st,
+                                   Word16 nBands,
+                                   Word16 scaleCLDFB
+                                  )
+{
+    Word16 i, n, s, sn, nBins;
+    Word32 *level, *ref;
+
+
+    level = st->cngNoiseLevel;
+    ref = st->sqrtNoiseLevelRef;
+
+    nBins = sub(st->stopFFTbin, st->startBand);
+    n = add(nBins, nBands);
+
+    test();
+    test();
+    test();
+    test();
+    test();
+    IF ( st->sqrtNoiseLevelValid != 0
+         && sub(st->sqrtNoiseLevelRefExp, st->cngNoiseLevelExp) == 0
+         && sub(st->sqrtNoiseLevelStartBand, st->startBand) == 0
+         && sub(st->sqrtNoiseLevelBins, nBins) == 0
+         && sub(st->sqrtNoiseLevelBands, nBands) >= 0
+         && sub(st->sqrtNoiseLevelRefScale, scaleCLDFB) == 0 )
+    {
+        FOR (i=0; i < n; i++)
+        {
+            if ( ref[i] != level[i] )
+            {
+                BREAK;
+            }
+        }
+        IF ( sub(i, n) == 0 )
+        {
+            return;
+        }
+    }
+
+    /* even exponent needed for the square root */
+    sn = s_and(st->cngNoiseLevelExp, 1);
+
+    i = 0;
+    move16();
+    IF ( st->startBand == 0 )
+    {
+        /* DC component in FFT */
+        s = 0;
+        move16();
+        st->sqrtNoiseLevel[0] = Sqrt32(L_shr(level[0],sn), &s);
+        move32();
+        st->sqrtNoiseLevelExp[0] = s;
+        move16();
+        i = 1;
+        move16();
+    }
+
+    /* FFT bins: real and imaginary part share the level, weighting with 0.5 */
+    FOR ( ; i < nBins; i++)
+    {
+        s = 0;
+        move16();
+        st->sqrtNoiseLevel[i] = Sqrt32(L_shr(level[i],add(sn,1)), &s);
+        move32();
+        st->sqrtNoiseLevelExp[i] = s;
+        move16();
+    }
+
+    /* CLDFB bands, scaleCLDFB: CLDFBinvScalingFactor_EXP + 1 */
+    FOR ( ; i < n; i++)
+    {
+        s = 0;
+        move16();
+        st->sqrtNoiseLevel[i] = Sqrt32(L_shr(Mpy_32_16_1(level[i],scaleCLDFB),sn), &s);
+        move32();
+        st->sqrtNoiseLevelExp[i] = s;
+        move16();
+    }
+
+    Copy32(level, ref, n);
+    st->sqrtNoiseLevelRefExp = st->cngNoiseLevelExp;
+    move16();
+    st->sqrtNoiseLevelRefScale = scaleCLDFB;
+    move16();
+    st->sqrtNoiseLevelStartBand = st->startBand;
+    move16();
+    st->sqrtNoiseLevelBins = nBins;
+    move16();
+    st->sqrtNoiseLevelBands = nBands;
+    move16();
+    st->sqrtNoiseLevelValid = 1;
+    move16();
+}
+
+
 void
 generate_comfort_noise_dec (Word32 **bufferReal,         /* o   : matrix to real part of input bands */
                             Word32 **bufferImag,         /* o   : matrix to imaginary part of input bands */
@@ -1281,21 +1446,21 @@ generate_comfort_noise_dec (Word32 **bufferReal,         /* o   : matrix to real
                             Word16 gen_exc
                            )
 {
-    Word16  i, j, s, sc, sn, cnt;
+    Word16  i, j, s, sc, sn, cnt, nBands;
     Word16  startBand2;
     Word16  stopFFTbin2;
     Word16  scaleCLDFB;
     Word16  preemph_fac;
-    Word32  sqrtNoiseLevel;
+    Word32 *sqrtNoiseLevel;
+    Word16 *sqrtNoiseLevelExp;
     Word16  randGaussExp;
     Word16  fftBufferExp;
     Word16  cngNoiseLevelExp;
     Word16 *seed;
     Word16 *timeDomainOutput;
-    Word32 *ptr_r, *ptr_i;
-    Word32 *cngNoiseLevel;
-    Word32 *ptr_level;
+    Word32 *ptr_r;
     Word32 *fftBuffer;
+    Word32  randCLDFB[2*CLDFB_NO_COL_MAX];
     Word16  old_syn_pe_tmp[16];
     Word16 tcx_transition = 0;
     HANDLE_FD_CNG_DEC std = stdec->hFdCngDec_fx;
@@ -1308,9 +1473,7 @@ generate_comfort_noise_dec (Word32 **bufferReal,         /* o   : matrix to real
 
     /* pointer initialization */
 
-    cngNoiseLevel = st->cngNoiseLevel;
     cngNoiseLevelExp = st->cngNoiseLevelExp;
-    ptr_level = cngNoiseLevel;
     seed = &(st->seed);
     fftBuffer = st->fftBuffer;
     timeDomainOutput = st->timeDomainBuffer;
@@ -1334,21 +1497,33 @@ generate_comfort_noise_dec (Word32 **bufferReal,         /* o   : matrix to real
 
     randGaussExp = CNG_RAND_GAUSS_SHIFT;
     move16();
+
+    /* CLDFB bands above the core */
+    nBands = 0;
+    move16();
+    test();
+    if ( bufferReal!=NULL && (sub(st->numCoreBands,st->regularStopBand) < 0) )
+    {
+        nBands = sub(st->regularStopBand,st->numCoreBands);
+    }
+
+    /* Square roots of the noise levels, only recomputed after a SID update */
+    get_sqrt_noise_levels(st, nBands, scaleCLDFB);
+    sqrtNoiseLevel = st->sqrtNoiseLevel;
+    sqrtNoiseLevelExp = st->sqrtNoiseLevelExp;
+
     cnt = sub(st->stopFFTbin, st->startBand);
     IF ( st->startBand == 0 )
     {
         /* DC component in FFT */
-        s = 0;
-        move16();
-        sqrtNoiseLevel = Sqrt32(L_shr(*ptr_level,sn), &s);
-
-        fftBuffer[0] = L_shl(Mpy_32_32(rand_gauss(seed),sqrtNoiseLevel),s);
+        fftBuffer[0] = scale_rand_gauss(rand_gauss(seed),*sqrtNoiseLevel,*sqrtNoiseLevelExp);
         move32();
 
         /* Nyquist frequency is discarded */
         fftBuffer[1] = L_deposit_l(0);
 
-        ptr_level = ptr_level + 1;
+        sqrtNoiseLevel++;
+        sqrtNoiseLevelExp++;
         ptr_r = fftBuffer + 2;
         cnt = sub(cnt, 1);
     }
@@ -1359,25 +1534,18 @@ generate_comfort_noise_dec (Word32 **bufferReal,         /* o   : matrix to real
         ptr_r = fftBuffer + startBand2;
     }
 
-    sn = add(sn,1);
-    ptr_i = ptr_r + 1;
+    /* Real and imaginary parts in FFT bins */
+    rand_gauss_vec(ptr_r, shl(cnt,1), seed);
     FOR (i=0; i < cnt; i++)
     {
-        s = 0;
-        move16();
-        sqrtNoiseLevel = Sqrt32(L_shr(*ptr_level,sn), &s);
-
-        /* Real part in FFT bins */
-        *ptr_r = L_shl(Mpy_32_32(rand_gauss(seed),sqrtNoiseLevel),s);
+        ptr_r[0] = scale_rand_gauss(ptr_r[0],*sqrtNoiseLevel,*sqrtNoiseLevelExp);
         move32();
-
-        /* Imaginary part in FFT bins */
-        *ptr_i = L_shl(Mpy_32_32(rand_gauss(seed),sqrtNoiseLevel),s);
+        ptr_r[1] = scale_rand_gauss(ptr_r[1],*sqrtNoiseLevel,*sqrtNoiseLevelExp);
         move32();
 
         ptr_r = ptr_r + 2;
-        ptr_i = ptr_i + 2;
-        ptr_level = ptr_level + 1;
+        sqrtNoiseLevel++;
+        sqrtNoiseLevelExp++;
     }
 
     /* Remaining FFT bins are set to zero */
@@ -1457,35 +1625,29 @@ generate_comfort_noise_dec (Word32 **bufferReal,         /* o   : matrix to real
       Generate Gaussian random noise in real and imaginary parts of the CLDFB bands
       Amplitudes are adjusted to the estimated noise level cngNoiseLevel in each band
     */
-    test();
-    IF ( bufferReal!=NULL && (sub(st->numCoreBands,st->regularStopBand) < 0) )
+    IF ( nBands > 0 )
     {
 
-        sn = sub(sn,1);
         sc = add(shr(add(cngNoiseLevelExp,CLDFBinvScalingFactor_EXP+1-1),1),randGaussExp);
         move16();
         assert( ((cngNoiseLevelExp+CLDFBinvScalingFactor_EXP+1-1)&1) == 0);
 
         FOR (j=st->numCoreBands; j<st->regularStopBand; j++)
         {
-            /* scaleCLDFB:  CLDFBinvScalingFactor_EXP + 1 */
-            s = 0;
-            move16();
-            sqrtNoiseLevel = Sqrt32(L_shr(Mpy_32_16_1(*ptr_level,scaleCLDFB),sn), &s);
+            rand_gauss_vec(randCLDFB, shl(st->numSlots,1), seed);
 
             FOR (i=0; i<st->numSlots; i++)
             {
                 /* Real part in CLDFB band */
-                bufferReal[i][j] = L_shl(Mpy_32_32(rand_gauss(seed),sqrtNoiseLevel),s);
+                bufferReal[i][j] = scale_rand_gauss(randCLDFB[2*i],*sqrtNoiseLevel,*sqrtNoiseLevelExp);
                 move32();
-                /*fprintf(pFile,"%13.10f\n",WORD322FL_SCALE(bufferReal[i][j],sc));*/
 
                 /* Imaginary part in CLDFB band */
-                bufferImag[i][j] = L_shl(Mpy_32_32(rand_gauss(seed),sqrtNoiseLevel),s);
+                bufferImag[i][j] = scale_rand_gauss(randCLDFB[2*i+1],*sqrtNoiseLevel,*sqrtNoiseLevelExp);
                 move32();
-                /*fprintf(pFile,"%13.10f\n",WORD322FL_SCALE(bufferImag[i][j],sc));*/
             }
-            ptr_level = ptr_level + 1;
+            sqrtNoiseLevel++;
+            sqrtNoiseLevelExp++;
         }
         *bufferScale = sub(sc,15);
         move16();
@@ -1897,7 +2059,7 @@ void generate_masking_noise (Word16 *timeDomainBuffer, /* i/o : pointer to time
             /* -s => consider scalefactor adaptation for sqrt calculation */
             sq = sub(0,s);
             sqrtNoiseLevel = Sqrt32(Mpy_32_16_1(*cngNoiseLevel,scale),&sq);
-            st->fftBuffer[0] = L_shl(Mpy_32_32(rand_gauss(seed),sqrtNoiseLevel),sq);
+            st->fftBuffer[0] = scale_rand_gauss(rand_gauss(seed),sqrtNoiseLevel,sq);
             move32();
             st->fftBuffer[1] = 0;
             move32();
@@ -1914,26 +2076,20 @@ void generate_masking_noise (Word16 *timeDomainBuffer, /* i/o : pointer to time
             fftBuffer = st->fftBuffer + startBand2;
         }
 
+        /* real and imaginary parts in FFT bins, random noise is scaled by CNG_RAND_GAUSS_SHIFT bits */
+        rand_gauss_vec(fftBuffer, shl(cnt,1), seed);
         FOR (i=0; i<cnt; i++)
         {
             /* -1 => weighting with 0.5, -s => consider scalefactor adaptation for sqrt calculation */
             sq = sub(-1,s);
             sqrtNoiseLevel = Sqrt32(Mpy_32_16_1(*cngNoiseLevel,scale),&sq);
 
-            /* real part in FFT bins */
-
-            /* random noise is scaled by CNG_RAND_GAUSS_SHIFT bits */
-            *fftBuffer = L_shl(Mpy_32_32(rand_gauss(seed),sqrtNoiseLevel),sq);
+            fftBuffer[0] = scale_rand_gauss(fftBuffer[0],sqrtNoiseLevel,sq);
             move32();
-            fftBuffer++;
-
-            /* imaginary part in FFT bins */
-
-            /* random noise is scaled by CNG_RAND_GAUSS_SHIFT bits */
-            *fftBuffer = L_shl(Mpy_32_32(rand_gauss(seed),sqrtNoiseLevel),sq);
+            fftBuffer[1] = scale_rand_gauss(fftBuffer[1],sqrtNoiseLevel,sq);
             move32();
-            fftBuffer++;
 
+            fftBuffer += 2;
             cngNoiseLevel++;
         }
 
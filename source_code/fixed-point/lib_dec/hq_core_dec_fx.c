@@ -2,6 +2,7 @@
     EVS Codec 3GPP TS26.442 Nov 13, 2018. Version 12.12.0 / 13.7.0 / 14.3.0 / 15.1.0
   ====================================================================================*/
 
+#include <stdlib.h>
 #include "options.h"    /* Compilation switches                   */
 #include "cnst_fx.h"    /* Common constants                       */
 #include "prot_fx.h"    /* Function prototypes                    */
@@ -10,10 +11,10 @@
 /*--------------------------------------------------------------------------
  *  hq_core_dec()
  *
- *  HQ core decoder
+ *  HQ core decoder, returns 1 if the HQ concealment memories cannot be allocated
  *--------------------------------------------------------------------------*/
 
-void hq_core_dec_fx(
+Word16 hq_core_dec_fx(
     Decoder_State_fx *st_fx,                /* i/o: decoder state structure fx         */
     Word16 synth[],                 /* o  : output synthesis                   */
     Word16 *Q_synth,                /* o  : Q value of synth                   */
@@ -43,6 +44,16 @@ void hq_core_dec_fx(
      * Initializations
      *--------------------------------------------------------------------------*/
 
+    /* HQ concealment memories are only needed once the HQ core is in use */
+    IF( st_fx->hHqFec == NULL )
+    {
+        st_fx->hHqFec = (HANDLE_HQ_DEC_FEC) calloc( 1, sizeof(HQ_DEC_FEC) );
+        IF( st_fx->hHqFec == NULL )
+        {
+            return 1;
+        }
+    }
+
     set32_fx( t_audio_q, 0, L_FRAME48k );
     set16_fx( gapsynth_fx, 0, L_FRAME48k );
     set16_fx( num_bands_p, 0, MAX_SB_NB );
@@ -148,7 +159,7 @@ void hq_core_dec_fx(
         IF ( sub(output_frame, L_FRAME16k) >= 0 ) /* Apply phase ecu for WB, SWB and FB */
         {
             /* ecu_rec sent to OLA, env_stab passed in ph_ecu_st */
-            hq_ecu_fx( st_fx->prev_good_synth_fx, t_audio_q, &st_fx->time_offs_fx, st_fx->X_sav_fx, &st_fx->Q_X_sav, &st_fx->num_p_fx, st_fx->plocs_fx, st_fx->plocsi_fx, st_fx->env_stab_fx,
+            hq_ecu_fx( st_fx->prev_good_synth_fx, t_audio_q, &st_fx->time_offs_fx, st_fx->hHqFec->X_sav_fx, &st_fx->Q_X_sav, &st_fx->num_p_fx, st_fx->hHqFec->plocs_fx, st_fx->hHqFec->plocsi_fx, st_fx->env_stab_fx,
                        &st_fx->last_fec_fx, st_fx->ph_ecu_HqVoicing_fx, &st_fx->ph_ecu_active_fx, gapsynth_fx, st_fx->prev_bfi_fx, st_fx->old_is_transient_fx, st_fx->mag_chg_1st_fx,
                        st_fx->Xavg_fx, &st_fx->beta_mute_fx, output_frame, st_fx );
         }
@@ -307,11 +318,11 @@ void hq_core_dec_fx(
         test();
         IF( st_fx->bfi_fx == 0 && st_fx->prev_bfi_fx == 0)
         {
-            Copy_Scale_sig(st_fx->old_out_fx+N_ZERO_NB, st_fx->prev_oldauOut_fx, output_frame-N_ZERO_NB, negate(st_fx->Q_old_wtda) );
+            Copy_Scale_sig(st_fx->old_out_fx+N_ZERO_NB, st_fx->hHqFec->prev_oldauOut_fx, output_frame-N_ZERO_NB, negate(st_fx->Q_old_wtda) );
         }
         ELSE IF( sub(st_fx->prev_bfi_fx, 1) == 0)
         {
-            set16_fx( st_fx->prev_oldauOut_fx, 0, output_frame );
+            set16_fx( st_fx->hHqFec->prev_oldauOut_fx, 0, output_frame );
         }
 
         test();
@@ -325,7 +336,7 @@ void hq_core_dec_fx(
         ELSE
         {
             window_ola_fx( wtda_audio, synth, Q_synth, st_fx->old_out_fx, &st_fx->Q_old_wtda, output_frame,
-            st_fx->tcx_cfg.tcx_last_overlap_mode, st_fx->tcx_cfg.tcx_curr_overlap_mode, st_fx->prev_bfi_fx, st_fx->oldHqVoicing_fx , st_fx->oldgapsynth_fx );
+            st_fx->tcx_cfg.tcx_last_overlap_mode, st_fx->tcx_cfg.tcx_curr_overlap_mode, st_fx->prev_bfi_fx, st_fx->oldHqVoicing_fx , st_fx->hHqFec->oldgapsynth_fx );
             st_fx->phase_mat_next_fx = 0;
             move16();
         }
@@ -347,7 +358,7 @@ void hq_core_dec_fx(
             Q_audio = 15;
             move16();
             window_ola_fx( t_audio_q, synth, &Q_audio, st_fx->old_out_fx, &st_fx->Q_old_wtda, output_frame,
-            ALDO_WINDOW, ALDO_WINDOW, st_fx->prev_bfi_fx && !st_fx->ph_ecu_active_fx, st_fx->oldHqVoicing_fx, st_fx->oldgapsynth_fx );
+            ALDO_WINDOW, ALDO_WINDOW, st_fx->prev_bfi_fx && !st_fx->ph_ecu_active_fx, st_fx->oldHqVoicing_fx, st_fx->hHqFec->oldgapsynth_fx );
             *Q_synth = Q_audio;
             move16();
         }
@@ -355,7 +366,7 @@ void hq_core_dec_fx(
         {
             /* no BFI or baseline PLC active */
             window_ola_fx( wtda_audio, synth, Q_synth, st_fx->old_out_fx, &st_fx->Q_old_wtda, output_frame,
-            st_fx->tcx_cfg.tcx_last_overlap_mode, st_fx->tcx_cfg.tcx_curr_overlap_mode, st_fx->prev_bfi_fx && !st_fx->ph_ecu_active_fx, st_fx->oldHqVoicing_fx, st_fx->oldgapsynth_fx);
+            st_fx->tcx_cfg.tcx_last_overlap_mode, st_fx->tcx_cfg.tcx_curr_overlap_mode, st_fx->prev_bfi_fx && !st_fx->ph_ecu_active_fx, st_fx->oldHqVoicing_fx, st_fx->hHqFec->oldgapsynth_fx);
         }
 
         test();
@@ -405,7 +416,7 @@ void hq_core_dec_fx(
         {
             st_fx->oldHqVoicing_fx = 1;
             move16();
-            Copy( gapsynth_fx, st_fx->oldgapsynth_fx, L_FRAME48k );
+            Copy( gapsynth_fx, st_fx->hHqFec->oldgapsynth_fx, L_FRAME48k );
         }
         ELSE
         {
@@ -427,9 +438,9 @@ void hq_core_dec_fx(
 
     IF( sub(output_frame, L_FRAME8k) == 0)
     {
-        Copy32( wtda_audio, st_fx->oldIMDCTout_fx, L_FRAME8k/2 );
-        Copy(&st_fx->old_auOut_2fr_fx[output_frame], st_fx->old_auOut_2fr_fx, output_frame);
-        Copy_Scale_sig(synth, &st_fx->old_auOut_2fr_fx[output_frame], output_frame, negate(*Q_synth));
+        Copy32( wtda_audio, st_fx->hHqFec->oldIMDCTout_fx, L_FRAME8k/2 );
+        Copy(&st_fx->hHqFec->old_auOut_2fr_fx[output_frame], st_fx->hHqFec->old_auOut_2fr_fx, output_frame);
+        Copy_Scale_sig(synth, &st_fx->hHqFec->old_auOut_2fr_fx[output_frame], output_frame, negate(*Q_synth));
     }
 
     /* prepare synthesis output buffer (as recent as possible) for HQ FEC */
@@ -456,5 +467,5 @@ void hq_core_dec_fx(
         set16_fx( &st_fx->mem_pitch_gain[2], 0, nbsubfr );
     }
 
-    return;
+    return 0;
 }
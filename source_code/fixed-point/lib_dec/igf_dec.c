@@ -1555,6 +1555,41 @@ void IGFDecApplyMono(const IGF_DEC_INSTANCE_HANDLE                   hInstance,
 
 }
 
+/**********************************************************************/ /*
+allocates an IGF decoder instance in its reset state, returns 1 if out of memory
+**************************************************************************/
+Word16 createIgfDec(IGF_DEC_INSTANCE_HANDLE                         *hIGFDec             /**< out:    | instance handle of IGF Decoder */
+                   )
+{
+    IGF_DEC_INSTANCE_HANDLE hInstance;
+
+
+    hInstance = (IGF_DEC_INSTANCE_HANDLE) calloc(1, sizeof(IGFDEC_INSTANCE));
+    IF (hInstance == NULL)
+    {
+        return 1;
+    }
+    hInstance->igfData.igfInfo.nfSeed = 9733;
+    move16();
+
+    *hIGFDec = hInstance;
+
+    return 0;
+}
+
+/**********************************************************************/ /*
+frees an IGF decoder instance
+**************************************************************************/
+void deleteIgfDec(IGF_DEC_INSTANCE_HANDLE                           *hIGFDec             /**< in/out: | instance handle of IGF Decoder */
+                 )
+{
+    IF (*hIGFDec != NULL)
+    {
+        free(*hIGFDec);
+        *hIGFDec = NULL;
+    }
+}
+
 /**********************************************************************/ /*
 set mode is used to init the IGF dec with a new bitrate
 **************************************************************************/
@@ -1629,6 +1664,11 @@ void IGFDecUpdateInfo(const IGF_DEC_INSTANCE_HANDLE                  hInstance,
     H_IGF_GRID hGrid;
 
 
+    IF (hInstance == NULL)
+    {
+        return;
+    }
+
     hPrivateData = &hInstance->igfData;
     IF (hInstance->isIGFActive != 0)
     {
@@ -1707,6 +1747,11 @@ void IGFDecRestoreTCX10SubFrameData(const IGF_DEC_INSTANCE_HANDLE    hInstance,
     IGF_DEC_PRIVATE_DATA_HANDLE hPrivateData;
 
 
+    IF (hInstance == NULL)
+    {
+        return;
+    }
+
     hPrivateData = &hInstance->igfData;
 
     /* store igf energies for subframe*/
@@ -76,8 +76,6 @@ void init_decoder_fx(
     /* LSF initilaizations */
     Copy( GEWB_Ave_fx, st_fx->mem_AR_fx, M );
 
-    init_lvq_fx( st_fx->offset_scale1_fx, st_fx->offset_scale2_fx, st_fx->offset_scale1_p_fx, st_fx->offset_scale2_p_fx, st_fx->no_scales_fx, st_fx->no_scales_p_fx );
-
     set16_fx( st_fx->mem_MA_fx, 0, M );
 
     st_fx->dm_fx.prev_state = 0;
@@ -408,7 +406,6 @@ void init_decoder_fx(
 
     set16_fx( st_fx->old_out_fx, 0, L_FRAME48k );
     set16_fx( st_fx->old_out_LB_fx, 0, L_FRAME32k );
-    set32_fx( st_fx->old_coeffs_fx, 0, L_FRAME8k );
     st_fx->Q_old_wtda = 15;
     move16();
     st_fx->Q_old_postdec = 0;
@@ -418,9 +415,6 @@ void init_decoder_fx(
     set16_fx( st_fx->old_is_transient_fx, 0, 3 );
     st_fx->old_bfi_cnt_fx = 0;
     move16();
-    set16_fx(st_fx->old_auOut_2fr_fx, 0, L_FRAME8k*2);
-    set16_fx(st_fx->old_out_pha_fx[0], 0, N_LEAD_NB);
-    set16_fx(st_fx->old_out_pha_fx[1], 0, N_LEAD_NB);
     st_fx->prev_old_bfi_fx = 0;
     move16();
     st_fx->phase_mat_flag_fx = 0;
@@ -431,8 +425,7 @@ void init_decoder_fx(
     move16();
     st_fx->diff_energy_fx = 0;
     move16();
-    set32_fx( st_fx->oldIMDCTout_fx, 0, L_FRAME8k/2 );
-    set16_fx( st_fx->prev_oldauOut_fx, 0, L_FRAME8k );
+    st_fx->hHqFec = NULL;
     st_fx->stat_mode_out_fx = 0;
     move16();
     st_fx->stat_mode_old_fx = 0;
@@ -510,7 +503,6 @@ void init_decoder_fx(
      *----------------------------------------------------------------------------------*/
     st_fx->old_synthFB_fx = st_fx->synth_history_fx + NS2SA_fx2(st_fx->output_Fs_fx, PH_ECU_MEM_NS);
     st_fx->prev_good_synth_fx = st_fx->old_synthFB_fx + NS2SA_fx2(st_fx->output_Fs_fx, PH_ECU_LOOKAHEAD_NS);
-    set16_fx( st_fx->X_sav_fx, 0, PH_ECU_SPEC_SIZE );
     st_fx->Q_X_sav = 0;
     move16();
     st_fx->num_p_fx = 0;
@@ -523,7 +515,6 @@ void init_decoder_fx(
     move16();
     st_fx->ph_ecu_HqVoicing_fx = 0;
     move16();
-    set16_fx( st_fx->oldgapsynth_fx, 0, L_FRAME48k );
     st_fx->env_stab_fx = 0x6000;    /* 0.75 (Q15) */                           move16();
     st_fx->mem_norm_hqfec_fx[0] = 31;
     move16();
@@ -842,9 +833,7 @@ void init_decoder_fx(
     /* IGF */
     st_fx->igf = 0;
     move16();
-    set16_fx( (Word16*)&st_fx->hIGFDec, 0, (sizeof(st_fx->hIGFDec)+1)/sizeof(Word16) );
-    st_fx->hIGFDec.igfData.igfInfo.nfSeed = 9733;
-    move16();
+    st_fx->hIGFDec = NULL;
 
     st_fx->enablePlcWaveadjust = 0;
     move16();
@@ -963,5 +952,10 @@ void destroy_decoder(
 
     deleteFdCngDec( &st_fx->hFdCngDec_fx );
 
+    deleteIgfDec( &st_fx->hIGFDec );
+
+    free( st_fx->hHqFec );
+    st_fx->hHqFec = NULL;
+
     return;
 }
@@ -2,6 +2,7 @@
     EVS Codec 3GPP TS26.442 Nov 13, 2018. Version 12.12.0 / 13.7.0 / 14.3.0 / 15.1.0
   ====================================================================================*/
 
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -22,6 +23,20 @@
 static void usage_dec(void);
 static char *to_upper( char *str );
 
+/* information printout, left out in quiet initialization */
+static void print_info(Word16 quiet, FILE *f, const char *format, ...)
+{
+    va_list args;
+
+    if (quiet)
+    {
+        return;
+    }
+    va_start(args, format);
+    vfprintf(f, format, args);
+    va_end(args);
+}
+
 static char * bit_rate_to_string(char *string, Word32 bit_rate)
 {
     char *src, *dst;
@@ -53,7 +68,7 @@ void io_ini_dec_fx(
     char *argv[],             /* i  : command line arguments                    */
     FILE **f_stream,          /* o  : input bitstream file                      */
     FILE **f_synth,           /* o  : output synthesis file                     */
-    Word16 *quietMode,             /* o  : limited printouts                         */
+    Word16 *quietMode,             /* i/o: limited printouts, no information if set  */
     Word16 *noDelayCmp,            /* o  : turn off delay compensation               */
     Decoder_State_fx *st_fx,           /* o  : Decoder static variables structure        */
 #ifdef SUPPORT_JBM_TRACEFILE
@@ -66,8 +81,13 @@ void io_ini_dec_fx(
     char   stmp[50];
     Word16 evs_magic, amrwb_magic;
     char bit_rate_string[14];
+    Word16 quiet;
 
-    print_disclaimer(stderr);
+    quiet = *quietMode;
+    if( !quiet )
+    {
+        print_disclaimer(stderr);
+    }
 
     /*-----------------------------------------------------------------*
      * Initialization
@@ -261,12 +281,12 @@ void io_ini_dec_fx(
 
             if( evs_magic )
             {
-                fprintf( stderr, "Found MIME Magic number %s\n", EVS_MAGIC_NUMBER );
+                print_info(quiet, stderr, "Found MIME Magic number %s\n", EVS_MAGIC_NUMBER );
                 st_fx->amrwb_rfc4867_flag = 0;
             }
             else
             {
-                fprintf( stderr, "Found MIME Magic number %s\n",AMRWB_MAGIC_NUMBER );
+                print_info(quiet, stderr, "Found MIME Magic number %s\n",AMRWB_MAGIC_NUMBER );
                 st_fx->amrwb_rfc4867_flag = 1;
                 st_fx->Opt_AMR_WB_fx = 1;    /*  needed in case first initial RFC4867 frames/ToCs are lost */
             }
@@ -305,7 +325,7 @@ void io_ini_dec_fx(
         }
         /*  JBM format */
 
-        fprintf( stderr, "Input bitstream file:   %s\n", argv[i]);
+        print_info(quiet, stderr, "Input bitstream file:   %s\n", argv[i]);
         i++;
 
     }
@@ -331,7 +351,7 @@ void io_ini_dec_fx(
         }
        
 
-        fprintf( stdout, "Output synthesis file:  %s\n", argv[i] );
+        print_info(quiet, stdout, "Output synthesis file:  %s\n", argv[i] );
         i++;
     }
     else
@@ -339,7 +359,7 @@ void io_ini_dec_fx(
         fprintf( stderr, "Error: no output synthesis file specified\n\n" );
         usage_dec();
     }
-    fprintf( stdout, "\n" );
+    print_info(quiet, stdout, "\n" );
 
     if( !st_fx->Opt_VOIP_fx )
     {
@@ -374,23 +394,23 @@ void io_ini_dec_fx(
          * Print output sampling frequency
          *-----------------------------------------------------------------*/
 
-        fprintf( stdout, "Output sampling rate:   %d Hz\n", st_fx->output_Fs_fx );
+        print_info(quiet, stdout, "Output sampling rate:   %d Hz\n", st_fx->output_Fs_fx );
 
         /*-----------------------------------------------------------------*
          * Print bitrate
          *-----------------------------------------------------------------*/
 
-        fprintf( stdout, "Bitrate:                %s kbps\n", bit_rate_to_string(bit_rate_string, st_fx->total_brate_fx) );
+        print_info(quiet, stdout, "Bitrate:                %s kbps\n", bit_rate_to_string(bit_rate_string, st_fx->total_brate_fx) );
         if ( st_fx->total_brate_fx <= 0 )
         {
             if( st_fx->bitstreamformat == G192 )
             {
-                fprintf( stdout, "Active Bitrate not identified in bitstream file \n" );
+                print_info(quiet, stdout, "Active Bitrate not identified in bitstream file \n" );
             }
             else
             {
                 /* MIME */
-                fprintf( stdout, "Active Bitrate not identified from first MIME frame \n" );
+                print_info(quiet, stdout, "Active Bitrate not identified from first MIME frame \n" );
             }
         }
 
@@ -28,9 +28,9 @@
 static void dqlsf_CNG_fx(
     Decoder_State_fx *st_fx,           /* i/o: decoder state structure          */
     Word16 *lsf_q,                     /* o  : decoded LSFs                     */
-    Word32 * p_offset_scale1,          /* i  : offset for 1st LVQ subvector     */
-    Word32 * p_offset_scale2,          /* i  : offset for second LVQ subvector  */
-    Word16 * p_no_scales               /* i  : number of scales for LVQ struct  */
+    const Word32 * p_offset_scale1,          /* i  : offset for 1st LVQ subvector     */
+    const Word32 * p_offset_scale2,          /* i  : offset for second LVQ subvector  */
+    const Word16 * p_no_scales               /* i  : number of scales for LVQ struct  */
 )
 {
     Word16 indice[4];
@@ -158,8 +158,8 @@ void lsf_dec_fx(
 
     /* LSF de-quantization */
     lsf_end_dec_fx( st_fx, 0, coder_type, st_fx->bwidth_fx, nBits, lsf_new, st_fx->mem_AR_fx,st_fx->mem_MA_fx, int_fs, st_fx->core_brate_fx,
-                    &st_fx->offset_scale1_fx[0][0], &st_fx->offset_scale2_fx[0][0], &st_fx->offset_scale1_p_fx[0][0], &st_fx->offset_scale2_p_fx[0][0],
-                    &st_fx->no_scales_fx[0][0], &st_fx->no_scales_p_fx[0][0], &st_fx->safety_net_fx, NULL, LSF_Q_prediction, NULL );
+                    &offset_scale1_fx[0][0], &offset_scale2_fx[0][0], &offset_scale1_p_fx[0][0], &offset_scale2_p_fx[0][0],
+                    &no_scales_fx[0][0], &no_scales_p_fx[0][0], &st_fx->safety_net_fx, NULL, LSF_Q_prediction, NULL );
 
     /* convert quantized LSFs to LSPs */
 
@@ -316,12 +316,12 @@ void lsf_end_dec_fx(
     Word16 *mem_MA,             /* i/o: quantizer memory for MA model           */
     const Word32 int_fs,              /* i  : sampling frequency                      */
     Word32  core_brate,         /* i  : Coding Bit Rate                         */
-    Word32 *p_offset_scale1,
-    Word32 *p_offset_scale2,
-    Word32 *p_offset_scale1_p,
-    Word32 *p_offset_scale2_p,
-    Word16 *p_no_scales,
-    Word16 *p_no_scales_p,
+    const Word32 *p_offset_scale1,
+    const Word32 *p_offset_scale2,
+    const Word32 *p_offset_scale1_p,
+    const Word32 *p_offset_scale2_p,
+    const Word16 *p_no_scales,
+    const Word16 *p_no_scales_p,
     Word16 *safe_net,
     Word16 *lpc_param,
     Word16 *LSF_Q_prediction,  /* o  : LSF prediction mode                     */
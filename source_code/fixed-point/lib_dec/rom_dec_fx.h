@@ -74,6 +74,9 @@ extern const Word16 GR_POW_HEADROOM[];
 extern const Word16 T_256DIV_L_Frame[];
 extern const Word16 T_DIV_L_Frame[];        /*0Q15 * 2^-7 */
 
+/* ari_dec.c */
+extern const UWord8 ari_lut_s17_LC_ext[64][ARI_S17_LUT_SIZE];
+
 /* er_dec_tcx.c */
 extern const Word16 h_high3_32[L_FIR_FER2];
 extern const Word16 h_high3_16[L_FIR_FER2];
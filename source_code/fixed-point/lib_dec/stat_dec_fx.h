@@ -286,6 +286,24 @@ typedef struct
 FD_CNG_DEC;
 typedef FD_CNG_DEC *HANDLE_FD_CNG_DEC;
 
+/* HQ core concealment memories, allocated on the first HQ core frame */
+typedef struct
+{
+    Word32 oldIMDCTout_fx[L_FRAME8k/2];
+    Word16 prev_oldauOut_fx[L_FRAME8k];
+    Word16 old_auOut_2fr_fx[L_FRAME8k*2];
+    Word16 old_out_pha_fx[2][N_LEAD_NB];              /* FEC for HQ Core, 0-phase matching old_out, 1-overlapping original old_out and  phase matching old_out*/
+    Word32 old_coeffs_fx[L_FRAME8k];                      /* HQ core - old coefficients (for FEC) */
+
+    /* HQ PHASE ECU spectral memories */
+    Word16 X_sav_fx[PH_ECU_SPEC_SIZE];
+    Word16 plocs_fx[MAX_PLOCS];
+    Word32 plocsi_fx[MAX_PLOCS];
+    Word16 oldgapsynth_fx[L_FRAME48k];
+}
+HQ_DEC_FEC;
+typedef HQ_DEC_FEC *HANDLE_HQ_DEC_FEC;
+
 
 typedef struct Decoder_State_fx
 {
@@ -331,12 +349,6 @@ typedef struct Decoder_State_fx
     Word16 old_excFB_fx[L_FRAME48k];                    /* old excitation FB */
     Word16 lsp_old_fx[M];                               /* old LSP vector at the end of the frame Q15*/
     Word16 lsf_old_fx[M];                               /* old LSF vector at the end of the frame Q2.56*/
-    Word32 offset_scale1_fx[MAX_NO_MODES+1][MAX_NO_SCALES+1]; /* offsets for LSF LVQ structure 1st 8-dim subvector*/
-    Word32 offset_scale2_fx[MAX_NO_MODES+1][MAX_NO_SCALES+1]; /* offsets for LSF LVQ structure 2nd 8-dim subvector*/
-    Word32 offset_scale1_p_fx[MAX_NO_MODES_p+1][MAX_NO_SCALES+1]; /* offsets for LSF LVQ structure, pred. case, 1st 8-dim subvector*/
-    Word32 offset_scale2_p_fx[MAX_NO_MODES_p+1][MAX_NO_SCALES+1]; /* offsets for LSF LVQ structure, pred. case, 2nd 8-dim subvector*/
-    Word16 no_scales_fx[MAX_NO_MODES][2];                       /* LSF LVQ structure Q0*/
-    Word16 no_scales_p_fx[MAX_NO_MODES_p][2];                   /* LSF LVQ structure Q0*/
     Word16 tilt_code_fx;                                /* tilt of code Q15*/
     Word16 mem_syn2_fx[M];                              /* synthesis filter memory Q_syn*/
     Word16 mem_syn1_fx[M];                              /* synthesis filter memory (for core switching and FD BWE) */
@@ -565,12 +577,8 @@ typedef struct Decoder_State_fx
     Word16 Q_old_wtda;
     Word16 Q_old_postdec;                                   /*scaling of the output of core_switching_post_dec_fx() */
     Word16 Qprev_synth_buffer_fx;
-    Word32 oldIMDCTout_fx[L_FRAME8k/2];
-    Word16 prev_oldauOut_fx[L_FRAME8k];
-    Word16 old_auOut_2fr_fx[L_FRAME8k*2];
-    Word16 old_out_pha_fx[2][N_LEAD_NB];              /* FEC for HQ Core, 0-phase matching old_out, 1-overlapping original old_out and  phase matching old_out*/
+    HANDLE_HQ_DEC_FEC hHqFec;                             /* HQ core - concealment memories, NULL until the first HQ frame */
     Word16 diff_energy_fx;
-    Word32 old_coeffs_fx[L_FRAME8k];                      /* HQ core - old coefficients (for FEC) */
     Word16 stat_mode_out_fx;
     Word16 stat_mode_old_fx;
     Word16 phase_mat_flag_fx;
@@ -799,11 +807,8 @@ typedef struct Decoder_State_fx
 
     /* HQ PHASE ECU internal state */
     Word16 time_offs_fx;
-    Word16 X_sav_fx[PH_ECU_SPEC_SIZE];
     Word16 Q_X_sav;
     Word16 num_p_fx;
-    Word16 plocs_fx[MAX_PLOCS];
-    Word32 plocsi_fx[MAX_PLOCS];
     Word16 env_stab_fx;
     Word16 mem_norm_hqfec_fx[SFM_N_ENV_STAB];
     Word16 mem_env_delta_hqfec_fx;
@@ -816,7 +821,6 @@ typedef struct Decoder_State_fx
     Word16 last_fec_fx;
     Word16 ph_ecu_HqVoicing_fx;
     Word16 oldHqVoicing_fx;
-    Word16 oldgapsynth_fx[L_FRAME48k];
     Word16 ph_ecu_active_fx;      /* Set if Phase ECU was used in last bad frame */
     Word16 ni_seed_forfec;
     Word16 ber_occured_in_pvq;               /* flag for BER detection from PVQ routines */
@@ -1088,7 +1092,7 @@ typedef struct Decoder_State_fx
     Word16 tcx_lpc_shaped_ari;
 
     Word16 igf;
-    IGFDEC_INSTANCE  hIGFDec;
+    IGF_DEC_INSTANCE_HANDLE hIGFDec;                 /* allocated on first IGF configuration */
 
     CLDFB_SCALE_FACTOR scaleFactor;
 
@@ -1109,4 +1113,20 @@ typedef struct Decoder_State_fx
 
 
 } Decoder_State_fx;
+
+/*---------------------------------------------------------------*
+ * Frame synthesis between evs_dec_synth_fx() and                *
+ * evs_dec_output_fx(), before the output HP filter              *
+ *---------------------------------------------------------------*/
+
+typedef struct
+{
+    Word16 synth[L_FRAME48k + HQ_DELTA_MAX*HQ_DELAY_COMP];   /* synthesis at the output sampling rate, Qpostd */
+    Word16 output_frame;                                     /* frame length at the output sampling rate */
+    Word16 Qpostd;                                           /* Q of the synthesis */
+    Word16 coder_type;
+    Word16 hq_core_type;
+    Word16 concealWholeFrameTmp;
+    frameMode_fx frameMode;
+} DEC_FRAME_SYNTH;
 #endif
@@ -441,6 +441,39 @@ Word16 ACcontextMapping_encode2_estimate_no_mem_s17_LC(
     Word16 *stop,
     CONTEXT_HM_CONFIG *hm_cfg
 )
+{
+    return ACcontextMapping_encode2_estimate_bounded_s17_LC(x, nt, lastnz_out, nEncoded, target, stop, hm_cfg, MAX_16);
+}
+
+/**
+ * \brief Arithmetic encoder bit estimation with early exit
+ *
+ * Same as ACcontextMapping_encode2_estimate_no_mem_s17_LC(), but the estimation
+ * is abandoned as soon as the running bit count exceeds max_bits. The bit count
+ * only grows from one 2-tuple to the next, so the full estimate would exceed
+ * max_bits too. An abandoned estimate is flagged like a truncated one: *stop is
+ * non-zero on return.
+ *
+ * \param[i] x quantized spectrum
+ * \param[i] nt number of coefficients
+ * \param[o] lastnz_out last non-zero 2-tuple
+ * \param[o] nEncoded number of encoded coefficients
+ * \param[i] target target number of bits
+ * \param[i/o] stop stop mechanism on input, truncation/abandon flag on output
+ * \param[i] hm_cfg context-based harmonic model configuration
+ * \param[i] max_bits bit count above which the estimation is abandoned
+ * \return estimated number of bits
+ */
+Word16 ACcontextMapping_encode2_estimate_bounded_s17_LC(
+    const Word16 *x,
+    Word16 nt,
+    Word16 *lastnz_out,
+    Word16 *nEncoded,
+    Word16 target,
+    Word16 *stop,
+    CONTEXT_HM_CONFIG *hm_cfg,
+    Word16 max_bits
+)
 {
     Word16 a1, b1, a1_i, b1_i;
     Word16 k, t, pki, lev1;
@@ -459,6 +492,7 @@ Word16 ACcontextMapping_encode2_estimate_no_mem_s17_LC(
     Word16 p1, p2;
     Word16 ii[2], idx1, idx2, idx;
     Word16 numPeakIndicesOrig=0, numHoleIndices=0; /* initialize just to avoid compiler warning */
+    Word16 nbits_max;
     get_next_coeff_function get_next_coeff;
 
 
@@ -487,6 +521,7 @@ Word16 ACcontextMapping_encode2_estimate_no_mem_s17_LC(
     nbits_old = nbits;
     move16();
     nbits = sub(nbits, target);
+    nbits_max = sub(max_bits, target);
 
     /* Find last non-zero tuple in the mapped domain signal */
     lastnz = find_last_nz_pair(x, nt, hm_cfg);
@@ -643,6 +678,14 @@ Word16 ACcontextMapping_encode2_estimate_no_mem_s17_LC(
             }
         }
 
+        /* Abandon the estimation once max_bits is exceeded */
+        IF (sub(nbits, nbits_max) > 0)
+        {
+            stop2 = 1;
+            move16();
+            BREAK;
+        }
+
         /* Update context for next 2-tuple */
         IF (sub(p1, p2) == 0)   /* peak-peak or hole-hole context */
         {
@@ -132,6 +132,8 @@ void acelp_core_switch_enc_fx(
         st_fx->ind_list_fx[TAG_ACELP_SUBFR_LOOP_START+i].nb_bits=-1;
         move16();
     }
+    st_fx->max_ind_fx = s_max(st_fx->max_ind_fx, IND_CORE_SWITCHING_CELP_SUBFRAME+20);
+    move16();
 
     /*----------------------------------------------------------------*
      * BWE encoding
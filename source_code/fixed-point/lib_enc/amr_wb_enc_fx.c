@@ -281,6 +281,8 @@ void amr_wb_enc_fx(
 
     analy_sp( inp, Q_new, fr_bands, lf_E, &Etot, st->min_band_fx, st->max_band_fx, Le_min_scaled, Scale_fac, st->Bin_E_fx,
               st->Bin_E_old_fx, PS, st->lgBin_E_fx, st->band_energies, fft_buff );
+    FE_STATS_FRAME(st);
+    FE_STATS_TRANSFORM(st, 2);
 
     noise_est_pre_fx( Etot, st->ini_frame_fx, &st->Etot_l_fx, &st->Etot_h_fx, &st->Etot_l_lp_fx, &st->Etot_last_fx,
                       &st->Etot_v_h2_fx, &st->sign_dyn_lp_fx, st->harm_cor_cnt_fx, &st->Etot_lp_fx );
@@ -723,6 +723,7 @@ void CNG_enc_fx(
     }
 
     fft_rel_fx(fft_io, L_FFT, LOG2_L_FFT);
+    FE_STATS_TRANSFORM(st_fx, 1);
     ptR = &fft_io[1];
     ptI = &fft_io[L_FFT-1];
     FOR ( i=0; i<NUM_ENV_CNG; i++ )
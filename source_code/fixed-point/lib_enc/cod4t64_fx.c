@@ -293,6 +293,12 @@ Word16 acelp_4t64_fx(
         move16();
     }
 
+    /* bound the search effort according to the encoder complexity profile */
+    if( st_fx->cmpl_acelp_nbiter > 0 )
+    {
+        config.nbiter = s_min(config.nbiter, st_fx->cmpl_acelp_nbiter);
+    }
+
     config.codetrackpos = TRACKPOS_FIXED_FIRST;
     move16();
     config.bits = nbbits;
@@ -350,7 +350,8 @@ Word16 coder_acelp(             /* output SEGSNR for CL decision   */
                                       shift
                                       ,st->L_frame_fx,
                                       st->last_L_frame_fx,
-                                      st->total_brate_fx
+                                      st->total_brate_fx,
+                                      st->cmpl_acelp_nbiter
                                    );
 
         E_ACELP_xy2_corr(xn, y1, y2, &g_corr, L_SUBFR, Q_xn);
@@ -767,14 +767,15 @@ void QuantizeSpectrum(
                 stopCtxHm = 0;
                 move16();
 
-                /* Context Mapping */
-                sqBitsCtxHm = ACcontextMapping_encode2_estimate_no_mem_s17_LC(sqQ,
+                /* Context Mapping, abandoned as soon as it cannot be selected */
+                sqBitsCtxHm = ACcontextMapping_encode2_estimate_bounded_s17_LC(sqQ,
                               L_spec,
                               &lastnzCtxHm,
                               &nEncodedCtxHm,
                               sub(sqTargetBits, NumIndexBits),
                               &stopCtxHm,
-                              hm_cfg
+                              hm_cfg,
+                              add(sub(s_max(stop, sqBits), NumIndexBits), 2)
                                                                              );
 
                 /* Decide whether or not to use context mapping */
@@ -914,7 +915,8 @@ void QuantizeSpectrum(
                      sqBits,
                      tcx_cfg->tcxRateLoopOpt,
                      tcxonly,
-                     phm_cfg
+                     phm_cfg,
+                     st->cmpl_tcx_iter_max
                                                      );
 
             IF (ctxHmBits > 0)   /* Mapping tool is enabled */
@@ -924,17 +926,18 @@ void QuantizeSpectrum(
 
                 IF (PeriodicityIndex >= 0)   /* Mapping is used */
                 {
-                    /* Estimate non-mapped bitrate */
+                    /* Estimate non-mapped bitrate, abandoned as soon as it cannot be selected */
                     stopCtxHm = 1;
                     move16();
 
-                    sqBitsCtxHm = ACcontextMapping_encode2_estimate_no_mem_s17_LC(sqQ,
+                    sqBitsCtxHm = ACcontextMapping_encode2_estimate_bounded_s17_LC(sqQ,
                                   L_spec,
                                   &lastnz,
                                   &nEncodedCtxHm,
                                   sqTargetBits,
                                   &stopCtxHm,
-                                  NULL);
+                                  NULL,
+                                  sub(sub(sqBits, NumIndexBits), 1));
 
                     /* Decide whether or not to revert mapping */
                     Selector = sub(sqBits, add(sqBitsCtxHm, NumIndexBits));
@@ -961,16 +964,17 @@ void QuantizeSpectrum(
                 }
                 ELSE   /* Mapping is not used */
                 {
-                    /* Estimate mapped bitrate */
+                    /* Estimate mapped bitrate, abandoned as soon as it cannot be selected */
                     stopCtxHm = 1;
                     move16();
-                    sqBitsCtxHm = ACcontextMapping_encode2_estimate_no_mem_s17_LC(sqQ,
+                    sqBitsCtxHm = ACcontextMapping_encode2_estimate_bounded_s17_LC(sqQ,
                     L_spec,
                     &lastnzCtxHm,
                     &nEncodedCtxHm,
                     sub(sqTargetBits, NumIndexBits),
                     &stopCtxHm,
-                    hm_cfg
+                    hm_cfg,
+                    sub(sub(sqBits, NumIndexBits), 1)
                                                                                  );
 
                     /* Decide whether or not to use mapping */
@@ -1363,7 +1363,8 @@ void E_ACELP_4t(
     ,const Word16 L_frame,
     const Word16 last_L_frame,
     const Word32 total_brate,
-    const Word16 i_subfr
+    const Word16 i_subfr,
+    const Word16 nbiter_max
 )
 {
     PulseConfig config;
@@ -1396,6 +1397,12 @@ void E_ACELP_4t(
         config.nbiter = s_max(config.nbiter, 1);
     }
 
+    /* bound the search effort according to the encoder complexity profile */
+    if( nbiter_max > 0 )
+    {
+        config.nbiter = s_min(config.nbiter, nbiter_max);
+    }
+
     IF (acelpautoc)
     {
         E_ACELP_4tsearchx(dn, cn, R, code, &config, ind);
@@ -1773,7 +1780,8 @@ void E_ACELP_innovative_codebook(
     Word16 shift        /* i  : Scaling to get 12 bits                                */
     ,const Word16 L_frame,     /* i  : length of the frame                                   */
     const Word16 last_L_frame,/* i  : length of the last frame                              */
-    const Word32 total_brate  /* i  : ttoal bit-rate                                        */
+    const Word32 total_brate, /* i  : ttoal bit-rate                                        */
+    const Word16 nbiter_max   /* i  : max. number of search iterations, 0 = not limited     */
 )
 {
     Word16 xn2[L_SUBFR] /* Q_xn */, cn2[L_SUBFR] /* Q_xn */, dn[L_SUBFR] /* Rw2*cn2 */, h2[L_SUBFR] /* 4Q11 */;
@@ -1823,7 +1831,7 @@ void E_ACELP_innovative_codebook(
     /* Innovative codebook search */
     assert(mode < ACELP_FIXED_CDK_NB);
 
-    E_ACELP_4t( dn, cn2, h2, Rw2, acelpautoc, code, mode, *pt_indice, L_frame, last_L_frame, total_brate, i_subfr );
+    E_ACELP_4t( dn, cn2, h2, Rw2, acelpautoc, code, mode, *pt_indice, L_frame, last_L_frame, total_brate, i_subfr, nbiter_max );
 
     *pt_indice += 8;
 
@@ -435,7 +435,8 @@ void coder_acelp_rf(
                                               shift
                                               ,st->L_frame_fx,
                                               st->last_L_frame_fx,
-                                              st->total_brate_fx
+                                              st->total_brate_fx,
+                                              st->cmpl_acelp_nbiter
                                            );
             }
             ELSE
@@ -266,6 +266,9 @@ int main( int argc, char** argv )
     WMOPS_output(0);
     printf("\n");
 #endif
+#if (FE_STATS)
+    fe_stats_print_fx( st_fx );
+#endif
 
     /* Close Encoder, Close files and free ressources */
     BASOP_init
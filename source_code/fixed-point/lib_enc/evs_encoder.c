@@ -55,16 +55,43 @@ EvsEncoderContext* NewEvsEncoder(void)
         fprintf(stderr, "Can not allocate memory for EvsEncoderContext state structure\n");
         return NULL;
     }  
+    enc->req_bwidth = -1;
 
     return enc;
 }
 
-int InitEncoder(EvsEncoderContext *enc, int sample, int bitRate, char* codec, int isG192Format)
+int InitEncoder(EvsEncoderContext *enc, int sample, int bitRate, char* codec, int isG192Format, int dtx)
 {
     char *strSample;
     char bitRateParam[64];
+    char dtxParam[16];
+    char *argv[10];
     int argc;
-    fprintf(stdout,"init evs encoder  sample:%d bitRate:%d codec:%s isMimeFormat:%d \n", sample, bitRate, codec, isG192Format);
+    if (!enc->quiet)
+    {
+        fprintf(stdout,"init evs encoder  sample:%d bitRate:%d codec:%s isMimeFormat:%d dtx:%d \n", sample, bitRate, codec, isG192Format, dtx);
+    }
+
+    if (dtx != EVS_DTX_OFF && dtx != EVS_DTX_ADAPTIVE && (dtx < 3 || dtx > 100))
+    {
+        fprintf(stderr, "InitEncoder unsupported SID update interval %d (supported 3-100)\n", dtx);
+        return -1;
+    }
+
+    /* re-initialization of a running encoder starts from a fresh state */
+    if (enc->st_fx != NULL)
+    {
+        destroy_encoder_fx(enc->st_fx);
+    }
+    free(enc->st_fx);
+    enc->st_fx = NULL;
+    if (enc->buf != NULL)
+    {
+        free(enc->buf->data);
+    }
+    free(enc->buf);
+    enc->buf = NULL;
+
     if ( (enc->st_fx = (Encoder_State_fx *) calloc( 1, sizeof(Encoder_State_fx) ) ) == NULL )
     {
         fprintf(stderr, "Can not allocate memory for Encoder_State_fx state structure\n");
@@ -74,6 +101,19 @@ int InitEncoder(EvsEncoderContext *enc, int sample, int bitRate, char* codec, in
      if ( (enc->buf = (EncoderDataBuf *) calloc( 1, sizeof(EncoderDataBuf) ) ) == NULL )
     {
         fprintf(stderr, "Can not allocate memory for EncoderDataBuf state structure\n");
+        free(enc->st_fx);
+        enc->st_fx = NULL;
+        return -1;
+    }
+
+    /* only a G.192 output needs room for one word per bit */
+    if ( (enc->buf->data = (char *) calloc( 1, isG192Format ? EVS_G192_FRAME_BYTES : EVS_MIME_FRAME_BYTES ) ) == NULL )
+    {
+        fprintf(stderr, "Can not allocate memory for EncoderDataBuf data\n");
+        free(enc->buf);
+        enc->buf = NULL;
+        free(enc->st_fx);
+        enc->st_fx = NULL;
         return -1;
     }
 
@@ -81,10 +121,12 @@ int InitEncoder(EvsEncoderContext *enc, int sample, int bitRate, char* codec, in
     enc->f_rate = NULL;                                        
     enc->f_bwidth = NULL;                                      
     enc->f_rf = NULL;
-    enc->quietMode = 0;
+    enc->quietMode = enc->quiet;
     enc-> noDelayCmp = 0;
     enc->frame = 0;
     enc->f_stream = NULL;
+    enc->req_brate = 0;
+    enc->req_bwidth = -1;
 
     
     if(sample == 8000){
@@ -102,46 +144,91 @@ int InitEncoder(EvsEncoderContext *enc, int sample, int bitRate, char* codec, in
 	
 	sprintf(bitRateParam, "%d", bitRate);
 
-	if (isG192Format == 0) {
-		char *argv[8];
-		argv[0] = "Evs_cod";
-		argv[1] = "-MAX_BAND";
-		argv[2] = codec;
-		argv[3] = "-MIME";
-		argv[4] = bitRateParam;
-		argv[5] = strSample;
-		argv[6] = (char*)enc->f_input;
-		argv[7] = (char*)enc->f_stream;
-
-    argc = sizeof(argv) / sizeof(argv[0]);
-		io_ini_enc_fx(argc, argv, &enc->f_input, &enc->f_stream, &enc->f_rate, &enc->f_bwidth, &enc->f_rf,
-			&enc->quietMode, &enc->noDelayCmp, enc->st_fx);
+	argc = 0;
+	argv[argc++] = "Evs_cod";
+	if (dtx != EVS_DTX_OFF) {
+		/* the command line takes 0 for the adaptive SID update interval */
+		sprintf(dtxParam, "%d", dtx == EVS_DTX_ADAPTIVE ? 0 : dtx);
+		argv[argc++] = "-DTX";
+		argv[argc++] = dtxParam;
 	}
-	else {
-		char *argv[7];
-		argv[0] = "Evs_cod";
-		argv[1] = "-MAX_BAND";
-		argv[2] = codec;
-		argv[3] = bitRateParam;
-		argv[4] = strSample;
-		argv[5] = (char*)enc->f_input;
-		argv[6] = (char*)enc->f_stream;
-		argc = sizeof(argv) / sizeof(argv[0]);
-		io_ini_enc_fx(argc, argv, &enc->f_input, &enc->f_stream, &enc->f_rate, &enc->f_bwidth, &enc->f_rf,
-			&enc->quietMode, &enc->noDelayCmp, enc->st_fx);
+	argv[argc++] = "-MAX_BAND";
+	argv[argc++] = codec;
+	if (isG192Format == 0) {
+		argv[argc++] = "-MIME";
 	}
+	argv[argc++] = bitRateParam;
+	argv[argc++] = strSample;
+	argv[argc++] = (char*)enc->f_input;
+	argv[argc++] = (char*)enc->f_stream;
+	io_ini_enc_fx(argc, argv, &enc->f_input, &enc->f_stream, &enc->f_rate, &enc->f_bwidth, &enc->f_rf,
+		&enc->quietMode, &enc->noDelayCmp, enc->st_fx);
 
+   /* channel-aware configuration, kept across frames (taken before the init may turn it off) */
+   enc->rf_fec_offset = enc->st_fx->Opt_RF_ON ? enc->st_fx->rf_fec_offset : 0;
+   enc->rf_fec_indicator = enc->st_fx->rf_fec_indicator;
 
    enc->st_fx->input_frame_fx = extract_l(Mult_32_16(enc->st_fx->input_Fs_fx , 0x0290));
    enc->st_fx->ind_list_fx = enc->ind_list;
 
    init_encoder_fx(enc->st_fx);
-   
-   printf("init evs encoder success\n");
+
+   /* G.192 frames are written straight into the output buffer */
+   if (enc->st_fx->bitstreamformat == G192)
+   {
+       enc->st_fx->outDataG192 = (Word16 *) enc->buf->data;
+   }
+
+   if (!enc->quiet)
+   {
+      printf("init evs encoder success\n");
+   }
 
    return 0;
 }
 
+/* highest bandwidth the input sampling rate can carry */
+static Word16 max_bwidth_of_fs(Word32 input_Fs)
+{
+    if (input_Fs == 8000)
+    {
+        return NB;
+    }
+    if (input_Fs == 16000)
+    {
+        return WB;
+    }
+    if (input_Fs == 32000)
+    {
+        return SWB;
+    }
+    return FB;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Apply the bitrate and bandwidth requests of EvsSetBitrate(), EvsSetMaxBandwidth()
+    * and EvsApplyCmr() at the frame boundary. The encoder then takes
+    * the switch through its regular rate switching path, as with a bitrate profile file.
+    *------------------------------------------------------------------------------------------*/
+static void apply_runtime_requests(EvsEncoderContext *enc)
+{
+    Encoder_State_fx *st = enc->st_fx;
+
+    if (enc->req_brate != 0)
+    {
+        set_next_brate_fx( &st->total_brate_fx, enc->req_brate, st->input_Fs_fx, &st->Opt_AMR_WB_fx, &st->Opt_SC_VBR_fx, &st->codec_mode );
+        enc->req_brate = 0;
+    }
+
+    if (enc->req_bwidth >= 0)
+    {
+        st->max_bwidth_fx = enc->req_bwidth;
+        enc->req_bwidth = -1;
+    }
+
+    return;
+}
+
  /*------------------------------------------------------------------------------------------*
      * Loop for every frame of input data
      * - Read the input data
@@ -159,6 +246,7 @@ int EvsStartEncoder(EvsEncoderContext *enc,const char* data,const int len)
 
     UWord8 pFrame[(MAX_BITS_PER_FRAME + 7) >> 3];
     Word16 pFrame_size = 0;
+    Word16 nb_bits;
     
     if( enc == NULL)
     {
@@ -168,8 +256,18 @@ int EvsStartEncoder(EvsEncoderContext *enc,const char* data,const int len)
  
     /*input_frame = enc->st_fx->input_frame_fx;*/
 
-    Opt_RF_ON_loc = enc->st_fx->Opt_RF_ON;
-    rf_fec_offset_loc = enc->st_fx->rf_fec_offset;
+    apply_runtime_requests(enc);
+
+    /* channel-aware configuration: like the -rf command line option it outlives bitrate
+       switches, partial copies are sent whenever the encoder runs at 13.2 kbps WB or SWB */
+    Opt_RF_ON_loc = (enc->rf_fec_offset > 0);
+    rf_fec_offset_loc = enc->rf_fec_offset;
+    enc->st_fx->rf_fec_indicator = enc->rf_fec_indicator;
+    if (Opt_RF_ON_loc == 0)
+    {
+        /* switches a running channel-aware mode off below */
+        enc->st_fx->rf_fec_offset = 0;
+    }
 
    
     n_samples = (Word16)len;
@@ -248,13 +346,18 @@ int EvsStartEncoder(EvsEncoderContext *enc,const char* data,const int len)
     }
 
     /* write indices into bitstream file */
+    nb_bits = enc->st_fx->nb_bits_tot_fx;
     if(enc !=NULL)
     write_indices_fx( enc->st_fx, enc->f_stream, pFrame, pFrame_size );
 
 
-	if (enc->st_fx->bitstreamformat == G192) {
+	if (nb_bits == 0) {
+		/* DTX NO_DATA frame: nothing to send */
+		enc->buf->size = 0;
+	}
+	else if (enc->st_fx->bitstreamformat == G192) {
+		/* write_indices_fx() already wrote the frame into enc->buf->data */
 		enc->buf->size = enc->st_fx->outDataLenG192;
-		memcpy(enc->buf->data, enc->st_fx->outDataG192, enc->st_fx->outDataLenG192);
 	}
 	else {
 		enc->buf->size = enc->st_fx->outDataLen;
@@ -274,8 +377,257 @@ int EvsStartEncoder(EvsEncoderContext *enc,const char* data,const int len)
 }
 
 
+/*------------------------------------------------------------------------------------------*
+    * Select the encoder complexity profile (reference after InitEncoder):
+    *   0 : reference search effort
+    *   1 : balanced, reduced ACELP codebook search and TCX rate loop
+    *   2 : fast, additionally a single LSF lattice VQ candidate and a GMM-only
+    *       speech/music classifier
+    * The bitstream stays standard in all profiles, only the coding quality changes.
+    *------------------------------------------------------------------------------------------*/
+int EvsSetComplexity(EvsEncoderContext *enc,int profile)
+{
+    if (enc == NULL || enc->st_fx == NULL)
+    {
+        fprintf(stdout,"EvsSetComplexity enc is NULL\n");
+        return -1;
+    }
+
+    if (profile < ENC_CMPL_REFERENCE || profile > ENC_CMPL_FAST)
+    {
+        fprintf(stdout,"EvsSetComplexity unknown profile %d\n", profile);
+        return -1;
+    }
+
+    set_cmpl_profile_fx(enc->st_fx, (Word16)profile);
+
+    return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------*
+    * Request a new bitrate (reference after InitEncoder), applied at the next frame:
+    *   EVS primary 7200 .. 128000, 5900 (SC-VBR, DTX only) or AMR-WB IO 6600 .. 23850.
+    * With 8 kHz input or an NB bandwidth limit the bitrate is capped at 24400.
+    *------------------------------------------------------------------------------------------*/
+int EvsSetBitrate(EvsEncoderContext *enc,int bitRate)
+{
+    Word16 j;
+
+    if (enc == NULL || enc->st_fx == NULL)
+    {
+        fprintf(stdout,"EvsSetBitrate enc is NULL\n");
+        return -1;
+    }
+
+    j = 0;
+    while ( j < SIZE_BRATE_TBL && bitRate != brate_tbl[j] )
+    {
+        j++;
+    }
+
+    switch (bitRate)
+    {
+    case ACELP_5k90:
+        if (enc->st_fx->Opt_DTX_ON_fx == 0)
+        {
+            fprintf(stdout,"EvsSetBitrate SC-VBR 5900 is not supported without DTX\n");
+            return -1;
+        }
+        break;
+    case ACELP_6k60:
+    case ACELP_8k85:
+    case ACELP_12k65:
+    case ACELP_14k25:
+    case ACELP_15k85:
+    case ACELP_18k25:
+    case ACELP_19k85:
+    case ACELP_23k05:
+    case ACELP_23k85:
+        break;
+    default:
+        if (j >= SIZE_BRATE_TBL)
+        {
+            fprintf(stdout,"EvsSetBitrate unsupported bitrate %d\n", bitRate);
+            return -1;
+        }
+        break;
+    }
+
+    enc->req_brate = bitRate;
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Request a new maximum coded bandwidth "NB", "WB", "SWB" or "FB", applied at the
+    * next frame and limited to half the input sampling rate
+    *------------------------------------------------------------------------------------------*/
+int EvsSetMaxBandwidth(EvsEncoderContext *enc,const char* band)
+{
+    Word16 bwidth;
+
+    if (enc == NULL || enc->st_fx == NULL || band == NULL)
+    {
+        fprintf(stdout,"EvsSetMaxBandwidth enc is NULL\n");
+        return -1;
+    }
+
+    if (strcmp(band, "NB") == 0)
+    {
+        bwidth = NB;
+    }
+    else if (strcmp(band, "WB") == 0)
+    {
+        bwidth = WB;
+    }
+    else if (strcmp(band, "SWB") == 0)
+    {
+        bwidth = SWB;
+    }
+    else if (strcmp(band, "FB") == 0)
+    {
+        bwidth = FB;
+    }
+    else
+    {
+        fprintf(stdout,"EvsSetMaxBandwidth unknown bandwidth %s\n", band);
+        return -1;
+    }
+
+    enc->req_bwidth = s_min(bwidth, max_bwidth_of_fs(enc->st_fx->input_Fs_fx));
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Honour a Codec Mode Request of the far end, the CMR byte of the EVS RTP payload
+    * (TS 26.445 Annex A.2.2.1.1, H bit ignored): the T field selects the bandwidth
+    * (or AMR-WB IO / channel-aware mode), the D field the bitrate. A channel-aware
+    * request switches to 13.2 kbps with the requested FEC indicator and offset, any
+    * other request turns channel-aware mode off. NO_REQ leaves the encoder unchanged.
+    *------------------------------------------------------------------------------------------*/
+int EvsApplyCmr(EvsEncoderContext *enc,int cmr)
+{
+    static const Word16 cmr_bwidth[5] = { NB, WB, WB, SWB, FB };
+    static const Word32 cmr_brate[5][12] =
+    {
+        /* NB        */ { ACELP_5k90, ACELP_7k20, ACELP_8k00, ACELP_9k60, ACELP_13k20, ACELP_16k40, ACELP_24k40, 0, 0, 0, 0, 0 },
+        /* AMR-WB IO */ { ACELP_6k60, ACELP_8k85, ACELP_12k65, ACELP_14k25, ACELP_15k85, ACELP_18k25, ACELP_19k85, ACELP_23k05, ACELP_23k85, 0, 0, 0 },
+        /* WB        */ { ACELP_5k90, ACELP_7k20, ACELP_8k00, ACELP_9k60, ACELP_13k20, ACELP_16k40, ACELP_24k40, ACELP_32k, ACELP_48k, ACELP_64k, HQ_96k, HQ_128k },
+        /* SWB       */ { 0, 0, 0, ACELP_9k60, ACELP_13k20, ACELP_16k40, ACELP_24k40, ACELP_32k, ACELP_48k, ACELP_64k, HQ_96k, HQ_128k },
+        /* FB        */ { 0, 0, 0, 0, 0, ACELP_16k40, ACELP_24k40, ACELP_32k, ACELP_48k, ACELP_64k, HQ_96k, HQ_128k }
+    };
+    static const Word16 cmr_rf_offset[4] = { 2, 3, 5, 7 };
+    Word16 t, d, bwidth, rf_offset, rf_indicator;
+    Word32 brate;
+
+    if (enc == NULL || enc->st_fx == NULL)
+    {
+        fprintf(stdout,"EvsApplyCmr enc is NULL\n");
+        return -1;
+    }
+
+    t = (Word16)((cmr >> 4) & 0x7);
+    d = (Word16)(cmr & 0xf);
+
+    if (t == 7 && d == 0xf)
+    {
+        /* NO_REQ */
+        return 0;
+    }
+
+    if (t == 5 || t == 6)
+    {
+        /* channel-aware mode at 13.2 kbps WB/SWB, D = FEC indicator (LO/HI) and offset */
+        if (d > 7 || enc->st_fx->input_Fs_fx == 8000)
+        {
+            fprintf(stdout,"EvsApplyCmr unsupported channel-aware request 0x%02x\n", cmr & 0x7f);
+            return -1;
+        }
+        bwidth = (t == 5) ? WB : SWB;
+        brate = ACELP_13k20;
+        rf_indicator = (Word16)(d >> 2);
+        rf_offset = cmr_rf_offset[d & 0x3];
+    }
+    else
+    {
+        brate = (t < 5 && d < 12) ? cmr_brate[t][d] : 0;
+        if (brate == 0)
+        {
+            fprintf(stdout,"EvsApplyCmr unsupported request 0x%02x\n", cmr & 0x7f);
+            return -1;
+        }
+        bwidth = cmr_bwidth[t];
+        rf_indicator = enc->rf_fec_indicator;
+        rf_offset = 0;
+    }
+
+    if (EvsSetBitrate(enc, brate) != 0)
+    {
+        return -1;
+    }
+    enc->req_bwidth = s_min(bwidth, max_bwidth_of_fs(enc->st_fx->input_Fs_fx));
+    enc->rf_fec_indicator = rf_indicator;
+    enc->rf_fec_offset = rf_offset;
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Configure channel-aware mode from the next frame on: the FEC indicator 0 (LO) or 1 (HI)
+    * and the FEC offset 2, 3, 5 or 7 frames of the partial copy, offset 0 turns it off.
+    * Partial copies are sent while the encoder runs at 13.2 kbps with WB or SWB bandwidth,
+    * at other bitrates the configuration is kept and taken up again after a switch back.
+    *------------------------------------------------------------------------------------------*/
+int EvsSetChannelAware(EvsEncoderContext *enc,int fecIndicator,int offset)
+{
+    if (enc == NULL || enc->st_fx == NULL)
+    {
+        fprintf(stdout,"EvsSetChannelAware enc is NULL\n");
+        return -1;
+    }
+
+    if ((fecIndicator != 0 && fecIndicator != 1) || (offset != 0 && offset != 2 && offset != 3 && offset != 5 && offset != 7))
+    {
+        fprintf(stdout,"EvsSetChannelAware unsupported FEC indicator %d or offset %d\n", fecIndicator, offset);
+        return -1;
+    }
+
+    if (offset != 0 && enc->st_fx->input_Fs_fx == 8000)
+    {
+        fprintf(stdout,"EvsSetChannelAware channel-aware mode is not supported at 8 kHz\n");
+        return -1;
+    }
+
+    enc->rf_fec_indicator = (Word16)fecIndicator;
+    enc->rf_fec_offset = (Word16)offset;
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------------------*
+    * Leave out the information printouts of InitEncoder(), the encoding and StopEncoder(),
+    * e.g. when many streams are encoded at once. Set before InitEncoder(), kept across
+    * re-initializations. Errors are still reported on stderr.
+    *------------------------------------------------------------------------------------------*/
+int EvsSetEncoderQuiet(EvsEncoderContext *enc,int enable)
+{
+    if (enc == NULL)
+    {
+        fprintf(stderr,"EvsSetEncoderQuiet enc is NULL\n");
+        return -1;
+    }
+
+    enc->quiet = (Word16)(enable != 0);
+
+    return 0;
+}
+
 int StopEncoder(EvsEncoderContext *enc)
 {
+   Word16 quiet;
+
    if(enc == NULL){
       return -1;
    }
@@ -286,10 +638,38 @@ int StopEncoder(EvsEncoderContext *enc)
    {
       fprintf(stdout, "EVS Encoding of %ld frames finished\n\n", enc->frame);
    }
-   else
+   else if (!enc->quiet)
    {
       fprintf(stdout, "EVS Encoding of %ld frames finished\n\n", enc->frame);
    }
+#if (FE_STATS)
+   if (enc->st_fx != NULL)
+   {
+      fe_stats_print_fx(enc->st_fx);
+   }
+#endif
+
+   quiet = enc->quiet;
+   FreeEncoder(enc);
+
+   if (!quiet)
+   {
+      fprintf(stdout,"EVS StopEncoder  success\n" );
+   }
+   return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------*
+    * Release an encoder context at once, e.g. in batch processing. StopEncoder() first waits
+    * for calls still running on the context.
+    *------------------------------------------------------------------------------------------*/
+int FreeEncoder(EvsEncoderContext *enc)
+{
+   if (enc == NULL)
+   {
+      return -1;
+   }
 
    if(enc->f_stream)
       fclose(enc->f_stream);
@@ -297,13 +677,19 @@ int StopEncoder(EvsEncoderContext *enc)
      fclose(enc->f_rate);
    if(enc->f_bwidth)
      fclose(enc->f_bwidth);
-   if (enc)
+
+   if (enc->st_fx != NULL)
+   {
+      destroy_encoder_fx(enc->st_fx);
+   }
+   free(enc->st_fx);
+   if (enc->buf != NULL)
    {
-     free(enc);
-     enc = NULL;
+      free(enc->buf->data);
    }
+   free(enc->buf);
+   free(enc);
 
-   fprintf(stdout,"EVS StopEncoder  success\n" );
    return 0;
 }
 
@@ -316,7 +702,7 @@ int UnitTestEvsEncoder(void)
     FILE * f_input;
     
     EvsEncoderContext * enc = NewEvsEncoder();
-    InitEncoder(enc,8000,24400,"WB",0);
+    InitEncoder(enc,8000,24400,"WB",0,EVS_DTX_OFF);
 
     f_input = fopen("./test8K.pcm","rb");
    if(!f_input)
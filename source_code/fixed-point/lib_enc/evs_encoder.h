@@ -18,9 +18,17 @@
 #include "prot_fx.h"
 
 
+/* DTX setting of InitEncoder(), 3 .. 100 selects a fixed SID update interval in frames */
+#define EVS_DTX_OFF                 0                   /* every frame is coded               */
+#define EVS_DTX_ADAPTIVE           -1                   /* adaptive SID update interval       */
+
+/* output frame sizes: a G.192 frame holds one word per bit, a MIME frame a ToC byte and packed bits */
+#define EVS_G192_FRAME_BYTES       ((2+MAX_BITS_PER_FRAME)*sizeof(Word16))
+#define EVS_MIME_FRAME_BYTES       (1+(MAX_BITS_PER_FRAME+7)/8)
+
 typedef struct EncoderDataBuf
 {
-   char data[(2+MAX_BITS_PER_FRAME)*4];
+   char *data;                                          /* sized for the output format chosen in InitEncoder() */
    int size;
 }EncoderDataBuf;
 
@@ -28,6 +36,7 @@ typedef struct EvsEncoderContext
 {
 	long frame; 
 	Word16 quietMode;
+	Word16 quiet;                                         /* no information printouts, EvsSetEncoderQuiet() */
 	Word16 noDelayCmp;
 	Indice_fx ind_list[MAX_NUM_INDICES];                  /* list of indices */
 	FILE  *f_input;                                         /* input signal file */
@@ -37,13 +46,24 @@ typedef struct EvsEncoderContext
 	FILE *f_stream;                     /*output bitstream file*/
 	Encoder_State_fx * st_fx;
 	EncoderDataBuf* buf;
+	Word32 req_brate;                                     /* bitrate requested at runtime, 0 if none      */
+	Word16 req_bwidth;                                    /* max bandwidth requested at runtime, -1 if none */
+	Word16 rf_fec_offset;                                 /* channel-aware FEC offset in frames (0: off)   */
+	Word16 rf_fec_indicator;                              /* channel-aware FEC indicator (0: LO, 1: HI)    */
 }EvsEncoderContext;
 
 
 EvsEncoderContext* NewEvsEncoder(void);
-int InitEncoder(EvsEncoderContext *enc,int sample,int bitRate, char* codec, int isG192Format);
+int InitEncoder(EvsEncoderContext *enc,int sample,int bitRate, char* codec, int isG192Format, int dtx);
 int EvsStartEncoder(EvsEncoderContext *enc,const char* data,const int len);
+int EvsSetComplexity(EvsEncoderContext *enc,int profile);
+int EvsSetBitrate(EvsEncoderContext *enc,int bitRate);
+int EvsSetMaxBandwidth(EvsEncoderContext *enc,const char* band);
+int EvsApplyCmr(EvsEncoderContext *enc,int cmr);
+int EvsSetChannelAware(EvsEncoderContext *enc,int fecIndicator,int offset);
+int EvsSetEncoderQuiet(EvsEncoderContext *enc,int enable);
 int StopEncoder(EvsEncoderContext *enc);
+int FreeEncoder(EvsEncoderContext *enc);
 int UnitTestEvsEncoder(void);
 
 #endif
\ No newline at end of file
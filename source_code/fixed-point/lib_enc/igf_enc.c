@@ -33,19 +33,25 @@ static void IGF_write_bits(Encoder_State_fx                            *st,
                            Word16                                       bits                /**< in: Q0  | number of bits           */
                           )
 {
-    Word16 tmp;
+    Indice_fx *ind;
+
+    *bitCount = add(*bitCount, bits);
 
-    WHILE (bits)
+    /* one indice per bit, as IGFEncConcatenateBitstream() counts them back */
+    IF (st)
     {
-        bits = sub(bits, 1);
-        tmp  = s_and(value, shl(1, bits));
-        IF (tmp == 0)
-        {
-            IGF_write_bit(st, bitCount, 0);
-        }
-        ELSE
+        ind = &st->ind_list_fx[st->next_ind_fx];
+        st->next_ind_fx    = add(st->next_ind_fx, bits);
+        st->nb_bits_tot_fx = add(st->nb_bits_tot_fx, bits);
+        update_max_ind_fx(st);
+        WHILE (bits)
         {
-            IGF_write_bit(st, bitCount, 1);
+            bits         = sub(bits, 1);
+            ind->value   = (UWord16)((value >> bits) & 1);
+            move16();
+            ind->nb_bits = 1;
+            move16();
+            ind++;
         }
     }
 
@@ -386,6 +392,7 @@ static void IGF_ErodeSpectrum(Word16                             *highPassEner_e
     Word16 *igfScaleF;
     Word16 tmp;
     Word32 L_tmp;
+    UWord32 L_sum;
 
 
     hPrivateData      = &hInstance->igfData;
@@ -417,16 +424,22 @@ static void IGF_ErodeSpectrum(Word16                             *highPassEner_e
 
     IF (igfBgn > 0)
     {
-        L_c = L_add(0, 0);
+        /* 64 bit accumulation: L_sum holds the lower word and L_c counts its carries;
+           i < N_MAX so the Q4 weight i*16 needs no saturation */
+        L_c   = L_add(0, 0);
+        L_sum = 0;
+        move32();
         FOR (i = 0; i < igfBgn; i++)
         {
-            Carry        = 0;
-            highPassEner = L_add_c(highPassEner, Mpy_32_16_1(pPowerSpectrum[i], shl(i,4)/*Q4*/)/*Q20, pPowerSpectrum_exp*/);
-            Overflow     = 0;
-            L_c          = L_macNs(L_c, 0, 0);
+            L_tmp = (Word32)(((Word40)pPowerSpectrum[i] * (i << 4)/*Q4*/) >> 15);                                              /*Q20, pPowerSpectrum_exp*/
+            L_sum = (UWord32)(L_sum + (UWord32)L_tmp);
+            if (L_sum < (UWord32)L_tmp)
+            {
+                L_c++;
+            }
         }
 
-        highPassEner      = norm_llQ31(L_c, highPassEner, highPassEner_exp);                                                    /*Q20, highPassEner_exp*/
+        highPassEner      = norm_llQ31(L_c, (Word32)L_sum, highPassEner_exp);                                                   /*Q20, highPassEner_exp*/
         *highPassEner_exp = add(*highPassEner_exp, pPowerSpectrum_exp);
         test();
         test();
@@ -457,24 +470,24 @@ static void IGF_ErodeSpectrum(Word16                             *highPassEner_e
         tmploop = sub(igfEnd,1);
         FOR (/*i*/; i < tmploop; i++)
         {
-            /* May overflow - just for threshold comparison */
-            BASOP_SATURATE_WARNING_OFF
-            L_tmp = L_add(pPowerSpectrum[i], highPassEner_Ovfl);
-            BASOP_SATURATE_WARNING_ON
-
-            IF (L_tmp < 0)
+            /* threshold comparison: a saturated sum keeps its sign, so the 40 bit sum decides alike */
+            IF ((Word40)pPowerSpectrum[i] + highPassEner_Ovfl < 0)
             {
-                lastLine       = L_add(pSpectrum[i], 0);
+                lastLine       = pSpectrum[i];
+                move32();
                 pSpectrum[i]   = nextLine;
                 move32();
-                nextLine       = L_add(0, 0);
+                nextLine       = 0;
+                move32();
             }
             ELSE
             {
                 pSpectrum[i-1] = lastLine;
                 move32();
-                lastLine       = L_add(pSpectrum[i], 0);
-                nextLine       = L_add(pSpectrum[i+1], 0);
+                lastLine       = pSpectrum[i];
+                move32();
+                nextLine       = pSpectrum[i+1];
+                move32();
             }
         }
 
@@ -522,50 +535,92 @@ static void IGF_ErodeSpectrum(Word16                             *highPassEner_e
 
 }
 
+/**********************************************************************/ /*
+per tile statistics of the power spectrum for IGF_getCrest() and IGF_getSFM()
+**************************************************************************/
+static void IGF_getTileStatistics(
+    Word32                                      *sumLog,             /**< out: Q0 | sum of the integer log2 values                   */
+    Word32                                      *sumLogSq,           /**< out: Q0 | sum of the squared integer log2 values           */
+    Word16                                      *maxLog,             /**< out: Q0 | maximum integer log2 value                       */
+    Word32                                      *sumNrg,             /**< out: Q31| sum of energies, incl. the SFM bias              */
+    Word16                                      *sumNrg_exp,         /**< out:    | exponent of sumNrg                               */
+    const Word32                                *powerSpectrum,      /**< in: Q31 | power spectrum                                   */
+    const Word16                                 powerSpectrum_exp,  /**< in:     | exponent of power spectrum                       */
+    const Word16                                 start,              /**< in: Q0  | start subband index                              */
+    const Word16                                 stop                /**< in: Q0  | stop subband index                               */
+)
+{
+    Word16 i;
+    Word16 x;
+    Word32 L_c;
+    UWord32 L_sum;
+
+    *sumLog   = L_deposit_l(0);
+    *sumLogSq = L_deposit_l(0);
+    *maxLog   = 0;
+    move16();
+
+    /* 64 bit energy accumulation: L_sum holds the lower word and L_c counts its carries */
+    L_c   = L_deposit_l(0);
+    L_sum = (UWord32)L_max(L_shr(2147483 /*0,001 in Q31 - float is "1", here*/, s_min(powerSpectrum_exp, 31)), 1);
+
+    /* the log2 values are bounded by the exponent range, the sums cannot saturate */
+    FOR (i = start; i < stop; i++)
+    {
+        /*x = max(0, (int)(log(powerSpectrum[i]) * INV_LOG_2));*/
+        /*ln(x * 2^-Qx * 2^xExp) = ln(x) - Qx + xExp*/
+        x = 0;
+        move16();
+        if (powerSpectrum[i] != 0)                                          /*special case: energy is zero*/
+        {
+            x = powerSpectrum_exp - norm_l(powerSpectrum[i]) - 1;           /*Q0*/
+        }
+        if (x < 0)
+        {
+            x = 0;
+            move16();
+        }
+        *sumLog   += x;
+        *sumLogSq += x * x;
+        if (x > *maxLog)
+        {
+            *maxLog = x;
+            move16();
+        }
+
+        L_sum = (UWord32)(L_sum + (UWord32)powerSpectrum[i]);
+        if (L_sum < (UWord32)powerSpectrum[i])
+        {
+            L_c++;
+        }
+    }
+
+    *sumNrg     = norm_llQ31(L_c, (Word32)L_sum, sumNrg_exp);                                    /*Q31*/
+    *sumNrg_exp = add(*sumNrg_exp, powerSpectrum_exp);
+}
+
 /**********************************************************************/ /*
 crest factor calculation
 **************************************************************************/
 static Word16 IGF_getCrest(                                                                 /**< out: Q15| crest factor                 */
     Word16                                      *crest_exp,          /**< out:    | exponent of crest factor     */
-    const Word32                                *powerSpectrum,      /**< in: Q31 | power spectrum               */
-    const Word16                                 powerSpectrum_exp,  /**< in:     | exponent of power spectrum   */
+    Word32                                       x_eff32,            /**< in: Q0  | sum of squared log2 energies */
+    const Word16                                 x_max,              /**< in: Q0  | maximum log2 energy          */
     const Word16                                 start,              /**< in: Q0  | start subband index          */
     const Word16                                 stop                /**< in: Q0  | stop subband index           */
 )
 {
     Word16 i;
-    Word16 x;
     Word16 s;
-    Word32 x_eff32;
-    Word16 x_max;
     Word16 crest;
     Word16 tmp;
     Word32 tmp32;
 
-    x_eff32    = L_add(0, 0);
-    x_max      = 0;
-    move16();
     crest      = 16384/*.5f Q15*/;
     move16();
     *crest_exp = 1;
     move16();
 
-    FOR (i = start; i < stop; i++)
-    {
-        /*x      = max(0, (int)(log(powerSpectrum[i]) * INV_LOG_2));*/
-
-        /*see IGF_getSFM for more comment */
-        x = sub(sub(powerSpectrum_exp, norm_l(powerSpectrum[i])), 1);       /*Q0*/
-        if (powerSpectrum[i] == 0)                                          /*special case: energy is zero*/
-        {
-            x = 0;
-            move16();
-        }
-        x       = s_max(0, x);
-        x_eff32 = L_mac0(x_eff32, x ,x);                                    /*Q0*/
-        x_max   = s_max(x_max, x);                                          /*Q0*/
-    }
-
     /*x_eff /= (stop - start);*/
     x_eff32 = BASOP_Util_Divide3216_Scale(x_eff32, sub(stop,start), &s);    /*Q-1, s*/
     s       = add(s, 32);                                                   /*make x_eff Q31*/
@@ -610,60 +665,24 @@ calculates spectral flatness measurment
 **************************************************************************/
 static Word16 IGF_getSFM(                                                                   /**< out: Q15| SFM value              */
     Word16                                        *SFM_exp,            /**< out:    | exponent of SFM Factor */
-    const Word32                                  *energy,             /**< in:  Q31| energies               */
-    const Word16                                  *energy_exp,         /**< in:     | exponent of energies   */
+    const Word32                                   num,                /**< in:  Q0 | sum of log2 energies   */
+    const Word32                                   denom,              /**< in:  Q31| sum of energies        */
+    const Word16                                   denom_exp,          /**< in:     | exponent of denom      */
     const Word16                                   start,              /**< in:  Q0 | start subband index    */
     const Word16                                   stop                /**< in:  Q0 | stop subband index     */
 )
 {
-    Word16 n,i, s;
-    Word32 num;
-    Word32 denom;
-    Word16 denom_exp;
+    Word16 s;
     Word16 invDenom_exp, numf_exp;
     Word16 numf;
     Word32 SFM32;
-    Word32 L_c;
     Word16 invDenom, SFM;
 
-    L_c   = L_add(0, 0);
-    num   = L_add(0, 0);
-    denom = L_shr(2147483 /*0,001 in Q31 - float is "1", here*/,s_min(*energy_exp, 31));
-    denom = L_max(denom, 1);
     *SFM_exp = 0;
     move16();
     SFM   = 32767/*1.0f Q15*/;
     move16();
 
-    FOR (i = start; i < stop; i++)
-    {
-        /*ln(x * 2^-Qx * 2^xExp) = ln(x) - Qx + xExp*/
-
-        /* n       = sub(sub(31,norm_l(tmp32)),1);  */                                                 /*<- ld    */
-        /* n       = sub(n,31);                     */                                                 /*<- -Qx   */
-        /* n       = add(n,*energy_exp);            */                                                 /*<- +xExp */
-
-        n = sub(sub(*energy_exp, norm_l(energy[i])), 1);                                          /*<-- short form*/
-
-        if (energy[i] == 0)                                                                       /*special case: energy is zero*/
-        {
-            n = 0;
-            move16();
-        }
-
-        n        = s_max(0, n);
-        num      = L_add(num, L_deposit_l(n));                                                    /*Q0*/
-
-        Carry    = 0;
-        denom    = L_add_c(energy[i], denom);
-        Overflow = 0;
-
-        L_c       = L_macNs(L_c, 0, 0);
-    }
-
-    denom     = norm_llQ31(L_c, denom, &denom_exp);                                               /*Q31*/
-    denom_exp = add(denom_exp, *energy_exp);
-
     /* calculate SFM only if signal is present */
     IF (denom != 0)
     {
@@ -732,6 +751,11 @@ static void IGF_Whitening(const IGF_ENC_INSTANCE_HANDLE                 hInstanc
     Word16 s;
     Word32 tmp32;
     Word32 SFM32;
+    Word32 sumLog;
+    Word32 sumLogSq;
+    Word16 maxLog;
+    Word32 sumNrg;
+    Word16 sumNrg_exp;
 
     hPrivateData = &hInstance->igfData;
     hGrid        = &hPrivateData->igfInfo.grid[igfGridIdx];
@@ -783,8 +807,11 @@ static void IGF_Whitening(const IGF_ENC_INSTANCE_HANDLE                 hInstanc
             FOR (p = 0; p < nT; p++)
             {
                 /*tmp  = IGF_getSFM(powerSpectrum, hGrid->tile[p], hGrid->tile[p+1]) / IGF_getCrest(powerSpectrum, hGrid->tile[p], hGrid->tile[p+1]);*/
-                SFM   = IGF_getSFM(&SFM_exp, powerSpectrum, &powerSpectrum_exp, hGrid->tile[p], hGrid->tile[p + 1]);
-                crest = IGF_getCrest(&crest_exp, powerSpectrum, powerSpectrum_exp, hGrid->tile[p], hGrid->tile[p + 1]);
+                /* SFM and crest share the log2 values of the tile, one pass gathers both */
+                IGF_getTileStatistics(&sumLog, &sumLogSq, &maxLog, &sumNrg, &sumNrg_exp,
+                                      powerSpectrum, powerSpectrum_exp, hGrid->tile[p], hGrid->tile[p + 1]);
+                SFM   = IGF_getSFM(&SFM_exp, sumLog, sumNrg, sumNrg_exp, hGrid->tile[p], hGrid->tile[p + 1]);
+                crest = IGF_getCrest(&crest_exp, sumLogSq, maxLog, hGrid->tile[p], hGrid->tile[p + 1]);
 
                 tmp   = BASOP_Util_Divide1616_Scale(SFM, crest, &s);  /*   Q15 */
                 s     = add(s, sub(SFM_exp, crest_exp));
@@ -2,6 +2,7 @@
     EVS Codec 3GPP TS26.442 Nov 13, 2018. Version 12.12.0 / 13.7.0 / 14.3.0 / 15.1.0
   ====================================================================================*/
 
+#include <stdio.h>
 #include "options.h"        /* Compilation switches                   */
 #include "cnst_fx.h"        /* Common constants                       */
 #include "rom_com_fx.h"     /* Static table prototypes                */
@@ -60,7 +61,6 @@ void init_encoder_fx(
     Copy( GEWB_Ave_fx, st_fx->lsfoldbfi0_fx, M );
     Copy( GEWB_Ave_fx, st_fx->lsfoldbfi1_fx, M );
     Copy( GEWB_Ave_fx, st_fx->lsf_adaptive_mean_fx, M );
-    init_lvq_fx( st_fx->offset_scale1_fx, st_fx->offset_scale2_fx, st_fx->offset_scale1_p_fx, st_fx->offset_scale2_p_fx, st_fx->no_scales_fx, st_fx->no_scales_p_fx );
     st_fx->next_force_safety_net_fx = 0;
 
     st_fx->pstreaklen_fx = 0;
@@ -741,6 +741,12 @@ void init_encoder_fx(
     st_fx->last_Opt_SC_VBR_fx = 0;
     move16();
 
+    set_cmpl_profile_fx( st_fx, ENC_CMPL_REFERENCE );
+#if (FE_STATS)
+    st_fx->fe_stats.nb_frames = 0;
+    st_fx->fe_stats.nb_transforms = 0;
+#endif
+
     /*-----------------------------------------------------------------*
      * TBE parameters
      *-----------------------------------------------------------------*/
@@ -1006,3 +1012,68 @@ void destroy_encoder_fx(
 
     return;
 }
+
+/*-----------------------------------------------------------------------*
+ * set_cmpl_profile_fx()
+ *
+ * Select the encoder complexity profile. All profiles produce standard
+ * bitstreams, they only bound the search effort of the encoder:
+ *   ENC_CMPL_REFERENCE : reference search effort
+ *   ENC_CMPL_BALANCED  : at most 2 ACELP codebook search iterations,
+ *                        3 TCX rate loop iterations
+ *   ENC_CMPL_FAST      : 1 ACELP codebook search iteration, 2 TCX rate
+ *                        loop iterations, a single MSVQ survivor in the
+ *                        LSF lattice VQ and no context-based improvement
+ *                        of the GMM speech/music decision
+ *-----------------------------------------------------------------------*/
+
+void set_cmpl_profile_fx(
+    Encoder_State_fx *st_fx,  /* i/o: Encoder static variables structure  */
+    const Word16 profile      /* i  : complexity profile                   */
+)
+{
+    st_fx->cmpl_profile = ENC_CMPL_REFERENCE;
+    st_fx->cmpl_acelp_nbiter = 0;
+    st_fx->cmpl_tcx_iter_max = 4;
+    st_fx->cmpl_lsf_nbest = LSFMBEST;
+
+    IF ( sub(profile, ENC_CMPL_BALANCED) == 0 )
+    {
+        st_fx->cmpl_profile = ENC_CMPL_BALANCED;
+        st_fx->cmpl_acelp_nbiter = 2;
+        st_fx->cmpl_tcx_iter_max = 3;
+    }
+    ELSE IF ( sub(profile, ENC_CMPL_FAST) == 0 )
+    {
+        st_fx->cmpl_profile = ENC_CMPL_FAST;
+        st_fx->cmpl_acelp_nbiter = 1;
+        st_fx->cmpl_tcx_iter_max = 2;
+        st_fx->cmpl_lsf_nbest = 1;
+    }
+
+    return;
+}
+
+#if (FE_STATS)
+/*-----------------------------------------------------------------------*
+ * fe_stats_print_fx()
+ *
+ * Print the average number of spectral transforms per frame that the
+ * front-end computed
+ *-----------------------------------------------------------------------*/
+
+void fe_stats_print_fx(
+    const Encoder_State_fx *st_fx   /* i  : Encoder static variables structure  */
+)
+{
+    const FE_STATS_ENC *s = &st_fx->fe_stats;
+
+    if ( s->nb_frames > 0 )
+    {
+        fprintf( stdout, "\nFront-end analysis: %ld frames, %.2f transforms/frame computed\n",
+                 (long)s->nb_frames, (float)s->nb_transforms / s->nb_frames );
+    }
+
+    return;
+}
+#endif
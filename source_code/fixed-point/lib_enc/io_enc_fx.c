@@ -2,6 +2,7 @@
     EVS Codec 3GPP TS26.442 Nov 13, 2018. Version 12.12.0 / 13.7.0 / 14.3.0 / 15.1.0
   ====================================================================================*/
 
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -22,6 +23,20 @@
 static void usage_enc(void);
 static char *to_upper( char *str );
 
+/* information printout, left out in quiet initialization */
+static void print_info(Word16 quiet, FILE *f, const char *format, ...)
+{
+    va_list args;
+
+    if (quiet)
+    {
+        return;
+    }
+    va_start(args, format);
+    vfprintf(f, format, args);
+    va_end(args);
+}
+
 static char * bit_rate_to_string(char *string, Word32 bit_rate)
 {
     char *src, *dst;
@@ -52,7 +67,7 @@ void io_ini_enc_fx(
     FILE  **f_rate,            /* o  : bitrate switching profile (0 if N/A)      */
     FILE  **f_bwidth,          /* o  : bandwidth switching profile (0 if N/A)    */
     FILE  **f_rf,              /* o  : channel aware configuration file          */
-    Word16 *quietMode,         /* o  : limit printouts                           */
+    Word16 *quietMode,         /* i/o: limit printouts, no information if set    */
     Word16 *noDelayCmp,        /* o  : turn off delay compensation               */
     Encoder_State_fx *st                  /* o  : state structure                           */
 )
@@ -66,8 +81,13 @@ void io_ini_enc_fx(
     char first_char;
     char rf_file_name[300];
     char bit_rate_string[14];
+    Word16 quiet;
 
-    print_disclaimer(stderr);
+    quiet = *quietMode;
+    if( !quiet )
+    {
+        print_disclaimer(stderr);
+    }
 
     /*-----------------------------------------------------------------*
      * Initialization
@@ -76,7 +96,6 @@ void io_ini_enc_fx(
 
     *f_input = NULL;
     *f_stream = NULL;
-    *quietMode = 0;
 
     st->input_Fs_fx = 16000;
     st->total_brate_fx = ACELP_12k65;
@@ -153,12 +172,12 @@ void io_ini_enc_fx(
                 }
                 else
                 {
-                    fprintf(stdout, "Bandwidth switching file: %s\n", argv[i+1]);
+                    print_info(quiet, stdout, "Bandwidth switching file: %s\n", argv[i+1]);
                 }
             }
             else
             {
-                fprintf(stdout, "Maximum encoded bandwidth: %s\n", stmp);
+                print_info(quiet, stdout, "Maximum encoded bandwidth: %s\n", stmp);
             }
 
             i += 2;
@@ -344,7 +363,7 @@ void io_ini_enc_fx(
 
             rewind(*f_rate);
 
-            fprintf(stdout, "Bitrate switching file: %s\n", argv[i]);
+            print_info(quiet, stdout, "Bitrate switching file: %s\n", argv[i]);
         }
         else
         {
@@ -449,7 +468,7 @@ void io_ini_enc_fx(
 
     if( i < argc-1 )
     {
-		fprintf(stdout, "Input audio file:       %s\n", argv[i]);
+		print_info(quiet, stdout, "Input audio file:       %s\n", argv[i]);
 		if (argv[i] != NULL)
 		{
 			if ((*f_input = fopen(argv[i], "rb")) == NULL)
@@ -481,7 +500,7 @@ void io_ini_enc_fx(
 				usage_enc();
 			}
 		}
-        fprintf(stdout, "Output bitstream file:  %s\n", argv[i]);
+        print_info(quiet, stdout, "Output bitstream file:  %s\n", argv[i]);
         i++;
         /* If MIME/storage format selected, write the magic number at the beginning of the bitstream file */
         if( st->bitstreamformat == MIME && *f_stream != NULL)
@@ -491,7 +510,7 @@ void io_ini_enc_fx(
             buf[0] = buf[1] = buf[2] = 0;
             buf[3] = 1;
             fwrite(&buf, sizeof(char), 4, *f_stream);
-            fprintf(stdout, "Output bitstream file format: MIME");
+            print_info(quiet, stdout, "Output bitstream file format: MIME");
         }
     }
     else
@@ -500,7 +519,7 @@ void io_ini_enc_fx(
         /*usage_enc();*/
     }
 
-    fprintf( stdout, "\n" );
+    print_info(quiet, stdout, "\n" );
 
 
     /* Prevent st->max_bwidth from being higher than Fs/2 */
@@ -591,7 +610,7 @@ void io_ini_enc_fx(
      * Print input signal sampling frequency
      *-----------------------------------------------------------------*/
 
-    fprintf(stdout, "Input sampling rate:    %d Hz\n", st->input_Fs_fx);
+    print_info(quiet, stdout, "Input sampling rate:    %d Hz\n", st->input_Fs_fx);
 
     /*-----------------------------------------------------------------*
      * Print bitrate
@@ -599,11 +618,11 @@ void io_ini_enc_fx(
 
     if ( st->Opt_SC_VBR_fx )
     {
-        fprintf(stdout, "Average bitrate:        %s kbps\n", bit_rate_to_string(bit_rate_string, ACELP_5k90));
+        print_info(quiet, stdout, "Average bitrate:        %s kbps\n", bit_rate_to_string(bit_rate_string, ACELP_5k90));
     }
     else
     {
-        fprintf(stdout, "Bitrate:                %s kbps\n", bit_rate_to_string(bit_rate_string, st->total_brate_fx));
+        print_info(quiet, stdout, "Bitrate:                %s kbps\n", bit_rate_to_string(bit_rate_string, st->total_brate_fx));
     }
 
     /*-----------------------------------------------------------------*
@@ -614,11 +633,11 @@ void io_ini_enc_fx(
     {
         if( st->var_SID_rate_flag_fx )
         {
-            fprintf(stdout, "DTX:                    ON, variable CNG update interval\n");
+            print_info(quiet, stdout, "DTX:                    ON, variable CNG update interval\n");
         }
         else
         {
-            fprintf(stdout, "DTX:                    ON, CNG update interval = %d frames\n", st->interval_SID_fx);
+            print_info(quiet, stdout, "DTX:                    ON, CNG update interval = %d frames\n", st->interval_SID_fx);
         }
     }
 
@@ -630,11 +649,11 @@ void io_ini_enc_fx(
     {
         if ( *f_rf == NULL )
         {
-            fprintf(stdout, "Channel-aware mode:     ON, FEC indicator : %s  FEC offset: %d \n", (st->rf_fec_indicator==0)?"LO":"HI", st->rf_fec_offset);
+            print_info(quiet, stdout, "Channel-aware mode:     ON, FEC indicator : %s  FEC offset: %d \n", (st->rf_fec_indicator==0)?"LO":"HI", st->rf_fec_offset);
         }
         else
         {
-            fprintf(stdout, "Channel-aware mode:     ON, Channel-aware config file name:  %s  \n", rf_file_name );
+            print_info(quiet, stdout, "Channel-aware mode:     ON, Channel-aware config file name:  %s  \n", rf_file_name );
         }
 
     }
@@ -669,27 +688,27 @@ void io_ini_enc_fx(
 
     if ( (max_bwidth_user != -1) && (st->max_bwidth_fx != max_bwidth_user) )
     {
-        fprintf(stdout, "\nBandwidth limited to %s.\n", max_bwidth_string);
+        print_info(quiet, stdout, "\nBandwidth limited to %s.\n", max_bwidth_string);
     }
     if( (max_bwidth_user == -1) && (st->max_bwidth_fx < FB) && (st->input_Fs_fx == 48000) )
     {
-        fprintf(stdout, "\nBandwidth limited to %s. To enable FB coding, please use -max_band FB.\n", max_bwidth_string);
+        print_info(quiet, stdout, "\nBandwidth limited to %s. To enable FB coding, please use -max_band FB.\n", max_bwidth_string);
     }
     if( (st->max_bwidth_fx == FB) && (st->total_brate_fx < ACELP_16k40) )
     {
-        fprintf(stdout, "\nFB coding not supported below %s kbps. ", bit_rate_to_string(bit_rate_string, ACELP_16k40));
+        print_info(quiet, stdout, "\nFB coding not supported below %s kbps. ", bit_rate_to_string(bit_rate_string, ACELP_16k40));
         if( st->total_brate_fx < ACELP_9k60 )
         {
-            fprintf(stdout, "Switching to WB.\n");
+            print_info(quiet, stdout, "Switching to WB.\n");
         }
         else
         {
-            fprintf(stdout, "Switching to SWB.\n");
+            print_info(quiet, stdout, "Switching to SWB.\n");
         }
     }
     if( (st->max_bwidth_fx == SWB) && (st->total_brate_fx < ACELP_9k60) )
     {
-        fprintf(stdout, "\nSWB coding not supported below %s kbps. Switching to WB.", bit_rate_to_string(bit_rate_string, ACELP_9k60));
+        print_info(quiet, stdout, "\nSWB coding not supported below %s kbps. Switching to WB.", bit_rate_to_string(bit_rate_string, ACELP_9k60));
     }
     /* in case of 8kHz input sampling or "-max_band NB", require the total bitrate to be below 24.40 kbps */
     if ( ((st->max_bwidth_fx == NB) || (st->input_Fs_fx == 8000)) && (st->total_brate_fx > ACELP_24k40) )
@@ -698,7 +717,7 @@ void io_ini_enc_fx(
         exit(-1);
     }
 
-    fprintf(stdout, "\n");
+    print_info(quiet, stdout, "\n");
     return;
 }
 
@@ -789,21 +808,43 @@ void read_next_brate_fx(
     Word16 *codec_mode                /* i/o: MODE1 or MODE2                            */
 )
 {
-    Word16 j;
+    Word32 brate;
 
     /*The complexity don't need to be taken into account given that is only simulation */
     /* read next bitrate value from the profile file */
+    brate = last_total_brate;
     if( f_rate != NULL )
     {
-        while ( fread( total_brate, 4, 1, f_rate ) != 1 && feof(f_rate) )
+        while ( fread( &brate, 4, 1, f_rate ) != 1 && feof(f_rate) )
         {
             rewind(f_rate);
         }
     }
-    else
-    {
-        *total_brate = last_total_brate;
-    }
+
+    set_next_brate_fx( total_brate, brate, input_Fs, Opt_AMR_WB, Opt_SC_VBR, codec_mode );
+
+    return;
+}
+
+/*---------------------------------------------------------------------*
+ * set_next_brate_fx()
+ *
+ * Set the bitrate of the next frame together with the SC-VBR, AMR-WB IO
+ * and codec mode flags it implies (bitrate profile file or runtime API)
+ *---------------------------------------------------------------------*/
+
+void set_next_brate_fx(
+    Word32  *total_brate,             /* o  : total bitrate                             */
+    const Word32 brate,               /* i  : requested bitrate                         */
+    Word32  input_Fs,                 /* i  : input sampling frequency                  */
+    Word16 *Opt_AMR_WB,               /* o  : flag indicating AMR-WB IO mode            */
+    Word16 *Opt_SC_VBR,               /* o  : SC-VBR flag                               */
+    Word16 *codec_mode                /* o  : MODE1 or MODE2                            */
+)
+{
+    Word16 j;
+
+    *total_brate = brate;
 
     /* SC-VBR at 5.90 kbps */
     if ( *total_brate == ACELP_5k90 )
@@ -24,12 +24,12 @@
 * Local functions
 *---------------------------------------------------------------------*/
 
-static void lsfq_CNG_fx( Encoder_State_fx *st_fx, const Word16 *lsf, const Word16 *wghts,  Word16 *qlsf, Word32 *p_offset_scale1, Word32 * p_offset_scale2,
-                         Word16 * p_no_scales );
+static void lsfq_CNG_fx( Encoder_State_fx *st_fx, const Word16 *lsf, const Word16 *wghts,  Word16 *qlsf, const Word32 *p_offset_scale1, const Word32 * p_offset_scale2,
+                         const Word16 * p_no_scales );
 
 static Word32 vq_lvq_lsf_enc( Word16 pred_flag, Word16 mode, Word16 u[], Word16 * levels, Word16 stages, Word16 w[], Word16 Idx[], const Word16 * lsf,
-                              const Word16 * pred, Word32  p_offset_scale1[][MAX_NO_SCALES+1], Word32  p_offset_scale2[][MAX_NO_SCALES+1],
-                              Word16 p_no_scales[][2], Word16 *resq, Word16 * lsfq );
+                              const Word16 * pred, const Word32  p_offset_scale1[][MAX_NO_SCALES+1], const Word32  p_offset_scale2[][MAX_NO_SCALES+1],
+                              const Word16 p_no_scales[][2], Word16 *resq, Word16 * lsfq, const Word16 nbest );
 
 static void lsf_mid_enc_fx( Encoder_State_fx *st_fx,const Word16 int_fs, const Word16 qisp0[], const Word16 qisp1[], Word16 isp[], const Word16 coder_type,
                             const Word16 bwidth, const Word32 core_brate, Word32 Bin_Ener_old[], Word32 Bin_Ener[], Word16 Q_ener, Word16 ppp_mode, Word16 nelp_mode );
@@ -264,9 +264,9 @@ static void lsfq_CNG_fx(
     const Word16 *lsf,    /*x2.56  unquantized LSF vector */
     const Word16 *wghts,  /*Q10    LSF weights            */
     Word16 *qlsf,         /*x2.56  quantized LSF vecotor  */
-    Word32 *p_offset_scale1,
-    Word32 *p_offset_scale2,
-    Word16 *p_no_scales
+    const Word32 *p_offset_scale1,
+    const Word32 *p_offset_scale2,
+    const Word16 *p_no_scales
 )
 {
     Word16 i, j, idx_cv, idx_lvq[3];
@@ -550,7 +550,7 @@ void lsf_end_enc_fx(
     *--------------------------------------------------------------------------------*/
     IF ( L_sub(core_brate, SID_2k40) == 0 )
     {
-        lsfq_CNG_fx( st, lsf,  wghts, qlsf, &st->offset_scale1_fx[0][0], &st->offset_scale2_fx[0][0], &st->no_scales_fx[0][0] );
+        lsfq_CNG_fx( st, lsf,  wghts, qlsf, &offset_scale1_fx[0][0], &offset_scale2_fx[0][0], &no_scales_fx[0][0] );
         sort_fx( qlsf, 0, M-1 );
         reorder_lsf_fx( qlsf, MODE1_LSF_GAP_FX, M, int_fs );
 
@@ -589,7 +589,7 @@ void lsf_end_enc_fx(
 
         /* LVQ quantization (safety-net only) */
         Err[0] = vq_lvq_lsf_enc(0, mode_lvq, Tmp, levels0, stages0,wghts, Idx0, lsf, pred0,
-                                st->offset_scale1_fx,st->offset_scale2_fx, st->no_scales_fx, resq, lsfq);
+                                offset_scale1_fx,offset_scale2_fx, no_scales_fx, resq, lsfq, st->cmpl_lsf_nbest);
         safety_net = 1;
         move16();
         *pstreaklen = 0;
@@ -599,7 +599,7 @@ void lsf_end_enc_fx(
     {
         Vr_subt(lsf, pred1, Tmp1, M);
         Err[1] = vq_lvq_lsf_enc(2, mode_lvq_p, Tmp1, levels1, stages1, wghts, Idx1, lsf, pred1,
-                                st->offset_scale1_p_fx,st->offset_scale2_p_fx,st->no_scales_p_fx,resq, lsfq );
+                                offset_scale1_p_fx,offset_scale2_p_fx,no_scales_p_fx,resq, lsfq, st->cmpl_lsf_nbest);
 
         safety_net = 0;
         move16();
@@ -680,13 +680,14 @@ void lsf_end_enc_fx(
 
             /* safety-net */
             Err[0] = vq_lvq_lsf_enc(0, mode_lvq, Tmp, levels0, stages0, wghts, Idx0, lsf, pred0,
-            st->offset_scale1_fx,st->offset_scale2_fx,st->no_scales_fx, resq, lsfq);
-            /* Predictive quantizer is calculated only if it can be selected */
+            offset_scale1_fx,offset_scale2_fx,no_scales_fx, resq, lsfq, st->cmpl_lsf_nbest);
+            /* Predictive quantizer is calculated only if it can be selected: the safety-net
+               wins whenever it is forced or its error is already below the absolute threshold */
             test();
-            IF (!force_sf || L_sub(Err[0],abs_threshold) > 0 )
+            IF (!force_sf && L_sub(Err[0],abs_threshold) >= 0 )
             {
                 Err[1] = vq_lvq_lsf_enc(2, mode_lvq_p, Tmp2, levels1, stages1, wghts, Idx1, lsf, pred2,
-                st->offset_scale1_p_fx, st->offset_scale2_p_fx, st->no_scales_p_fx, &resq[M], &lsfq[M]);
+                offset_scale1_p_fx, offset_scale2_p_fx, no_scales_p_fx, &resq[M], &lsfq[M], st->cmpl_lsf_nbest);
 
             }
             test();
@@ -910,8 +911,8 @@ void lsf_end_enc_fx(
         ELSE
         {
             vq_dec_lvq_fx( 1, qlsf, &indice[0], stages0, M, mode_lvq, levels0[stages0-1],
-            &st->offset_scale1_fx[0][0], &st->offset_scale2_fx[0][0], &st->offset_scale1_p_fx[0][0], &st->offset_scale2_p_fx[0][0],
-            &st->no_scales_fx[0][0], &st->no_scales_p_fx[0][0] );
+            &offset_scale1_fx[0][0], &offset_scale2_fx[0][0], &offset_scale1_p_fx[0][0], &offset_scale2_p_fx[0][0],
+            &no_scales_fx[0][0], &no_scales_p_fx[0][0] );
 
             Vr_add( qlsf, pred0, qlsf, M );
             Vr_subt(qlsf, pred1,mem_MA, M);
@@ -930,8 +931,8 @@ void lsf_end_enc_fx(
         {
             /* LVQ */
             vq_dec_lvq_fx( 0, qlsf, &indice[0], stages1, M, mode_lvq_p, levels1[stages1-1],
-            &st->offset_scale1_fx[0][0], &st->offset_scale2_fx[0][0], &st->offset_scale1_p_fx[0][0],
-            &st->offset_scale2_p_fx[0][0], &st->no_scales_fx[0][0], &st->no_scales_p_fx[0][0] );
+            &offset_scale1_fx[0][0], &offset_scale2_fx[0][0], &offset_scale1_p_fx[0][0],
+            &offset_scale2_p_fx[0][0], &no_scales_fx[0][0], &no_scales_p_fx[0][0] );
             IF (sub(predmode,1) == 0)
             {
                 Copy(qlsf, mem_MA, M);
@@ -973,7 +974,8 @@ static void first_VQstages(
     Word16 w[],              /* i  : weights                                             */
     Word16 N,                /* i  : vector dimension                                    */
     Word16 max_inner,        /* i  : maximum number of swaps in inner loop               */
-    Word16 indices_VQstage[]
+    Word16 indices_VQstage[],
+    Word32 dist_VQstage[]    /* o  : weighted error of the survivors                     */
 )
 {
     Word16 resid_buf[2*LSFMBEST*M], *resid[2];
@@ -1071,16 +1073,14 @@ static void first_VQstages(
             /* compute weighted codebook element and its energy */
             FOR ( c2 = 0; c2 < N; c2++ )
             {
-                Tmp[c2] = shl( mult(w[c2],cbp[c2]),2); /* Q8 + x2.56 -Q15 +Q2 */  move16();
+                /* shl( mult(w[c2],cbp[c2]),2), i.e. saturated to 16 bits */
+                L_tmp1 = ((Word32) w[c2] * cbp[c2]) >> 15;
+                L_tmp1 = (L_tmp1 > 0x1FFF) ? MAX_16 : ((L_tmp1 < -0x2000) ? MIN_16 : L_tmp1 * 4);
+                Tmp[c2] = (Word16) L_tmp1; /* Q8 + x2.56 -Q15 +Q2 */  move16();
 
             }
 
-            en = L_mult(cbp[0],Tmp[0]);
-
-            FOR ( c2 = 1; c2 < N; c2++ )
-            {
-                en = L_mac(en,cbp[c2],Tmp[c2]); /*x2.56 + x2.56 + Q-5 +Q1 */
-            }
+            en = Dot_product_mac(0, cbp, Tmp, N); /*x2.56 + x2.56 + Q-5 +Q1 */
             cbp += N ;
             move16();
 
@@ -1089,11 +1089,7 @@ static void first_VQstages(
             {
                 pTmp = &resid[0][c*N];
                 move16();
-                L_tmp = L_mult(pTmp[0], Tmp[0]);
-                FOR ( c2=1; c2<N; c2++ )
-                {
-                    L_tmp = L_mac(L_tmp,pTmp[c2],Tmp[c2]); /* */
-                }
+                L_tmp = Dot_product_mac(0, pTmp, Tmp, N);
 
                 L_tmp = L_add(dist[0][c], L_sub(en, L_shl(L_tmp, 1)));
 
@@ -1149,6 +1145,7 @@ static void first_VQstages(
     }
 
     Copy(indices[1],indices_VQstage,maxC*stagesVQ );
+    Copy32(dist[1], dist_VQstage, maxC);
 
     return;
 }
@@ -1177,19 +1174,20 @@ static Word32 vq_lvq_lsf_enc(
     Word16 Idx[],
     const Word16 * lsf,
     const Word16 * pred,
-    Word32  p_offset_scale1[][MAX_NO_SCALES+1],
-    Word32  p_offset_scale2[][MAX_NO_SCALES+1],
-    Word16  p_no_scales[][2],
+    const Word32  p_offset_scale1[][MAX_NO_SCALES+1],
+    const Word32  p_offset_scale2[][MAX_NO_SCALES+1],
+    const Word16  p_no_scales[][2],
     Word16 *resq,
-    Word16 * lsfq
+    Word16 * lsfq,
+    const Word16 nbest        /* i  : number of MSVQ survivors searched by the lattice VQ */
 )
 {
-    Word16 i;
+    Word16 i, c_first, c_last;
     const Word16 *const *cb, *cb_stage;
     Word16 cand[LSFMBEST][M];
     Word16 maxC=LSFMBEST, stagesVQ;
     Word16  mode_glb, j, indices_firstVQ[LSFMBEST*MAX_VQ_STAGES], c2;
-    Word32 e[LSFMBEST], L_tmp, L_ftmp;
+    Word32 e[LSFMBEST], L_tmp, L_ftmp, dist_firstVQ[LSFMBEST];
     Word16 quant[LSFMBEST][M], diff[M], dd[M];
     Word16 lat_cv[LSFMBEST][M];
     Word16 idx_lead[LSFMBEST][2], idx_scale[LSFMBEST][2];
@@ -1208,14 +1206,26 @@ static Word32 vq_lvq_lsf_enc(
         move16();
         mode_glb = add(offset_lvq_modes_pred_fx[mode], offset_in_lvq_mode_pred_fx[mode][sub(levels[stagesVQ], min_lat_bits_pred_fx[mode])]);
     }
+    c_first = 0;
+    move16();
+    c_last = maxC;
+    move16();
+    set32_fx( e, MAXINT32, maxC );
     IF (stagesVQ>0)
     {
         /* first VQ stages */
-        first_VQstages( cb, u, levels, stagesVQ, w, M, MSVQ_MAXCNT, indices_firstVQ );
+        first_VQstages( cb, u, levels, stagesVQ, w, M, MSVQ_MAXCNT, indices_firstVQ, dist_firstVQ );
+
+        /* reduced complexity: the lattice VQ only refines the best survivor */
+        IF ( sub(nbest, maxC) < 0 )
+        {
+            c_first = minimum_32_fx( dist_firstVQ, maxC, &L_ftmp );
+            c_last = add(c_first, 1);
+        }
     }
 
 
-    FOR ( i=0; i<maxC; i++ )
+    FOR ( i=c_first; i<c_last; i++ )
     {
         Copy( pred, cand[i], M );
         FOR ( j=0; j<stagesVQ; j++ )
@@ -1274,6 +1284,52 @@ static Word32 vq_lvq_lsf_enc(
     return e[c2];
 }
 
+/*---------------------------------------------------------------------*
+* BcTcvq_SearchCode_fx()
+*
+* Weighted search of the 2-dimensional codewords index, index+8, ... of
+* one trellis branch. Same result as the sub()/L_mult0()/Mult_32_16()/
+* L_add() distance: each weighted square stays below 2^30 in magnitude,
+* so neither the products nor their sum can saturate.
+*---------------------------------------------------------------------*/
+static Word16 BcTcvq_SearchCode_fx(    /* o  : best codeword index             */
+    const Word16 x_fx[],               /* i  : target vector      x2.56/x2.65 */
+    const Word16 CB_fx[][2],           /* i  : stage codebook, scale of x_fx   */
+    Word16 index,                      /* i  : first codeword of the branch    */
+    const Word16 cb_size,              /* i  : codebook size                   */
+    const Word16 W_fx[],               /* i  : weights                     Q10 */
+    Word32 *minDist_fx                 /* o  : distance of the best codeword, x_fx scale squared *Q(-5) */
+)
+{
+    Word16 bestCode;
+    Word32 d0, d1, dist_fx;
+
+    bestCode = index;
+    move16();
+    *minDist_fx = MAX_32;
+    move32();
+
+    FOR ( ; index < cb_size; index += 8 )
+    {
+        d0 = (Word32)x_fx[0] - CB_fx[index][0];
+        d0 = (d0 > MAX_16) ? MAX_16 : ((d0 < MIN_16) ? MIN_16 : d0);
+        d1 = (Word32)x_fx[1] - CB_fx[index][1];
+        d1 = (d1 > MAX_16) ? MAX_16 : ((d1 < MIN_16) ? MIN_16 : d1);
+        dist_fx = (Word32)(((Word40)(d0 * d0) * W_fx[0]) >> 15)
+                  + (Word32)(((Word40)(d1 * d1) * W_fx[1]) >> 15);
+
+        if (dist_fx < *minDist_fx)
+        {
+            bestCode = index;
+            move16();
+            *minDist_fx = dist_fx;
+            move32();
+        }
+    }
+
+    return bestCode;
+}
+
 static void BcTcvq_1st_fx(
     Word16 x_fx[][2],             /*x2.56*/
     const Word16 CB_fx[][128][2], /*x2.56*/
@@ -1286,8 +1342,7 @@ static void BcTcvq_1st_fx(
 {
     Word16 state, prev_state;
     Word16 index, bestCode;
-    Word32 dist_fx, minDist_fx;
-    Word16 temp16_fx;
+    Word32 minDist_fx;
 
     FOR (state = 0; state < NUM_STATE; state +=2)
     {
@@ -1295,27 +1350,7 @@ static void BcTcvq_1st_fx(
         move16();
         index     = NTRANS[2][state];
         move16();
-        temp16_fx = sub(x_fx[0][0], CB_fx[0][index][0]);
-        minDist_fx = Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[0][0]); /* 2.56*2.56*Q(-5) */
-        temp16_fx = sub(x_fx[0][1], CB_fx[0][index][1]);
-        minDist_fx = L_add(minDist_fx, Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[0][1])); /* 2.56*2.56*Q(-5) */
-        bestCode = index;
-        move16();
-
-        FOR (index = index+8; index < 128; index += 8)
-        {
-            temp16_fx = sub(x_fx[0][0], CB_fx[0][index][0]);
-            dist_fx = Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[0][0]); /* 2.56*2.56*Q(-5) */
-            temp16_fx = sub(x_fx[0][1], CB_fx[0][index][1]);
-            dist_fx = L_add(dist_fx, Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[0][1])); /* 2.56*2.56*Q(-5) */
-
-            if (L_sub(dist_fx, minDist_fx) < 0)
-            {
-                bestCode = index;
-                move16();
-            }
-            minDist_fx = L_min(minDist_fx, dist_fx);
-        }
+        bestCode = BcTcvq_SearchCode_fx(x_fx[0], CB_fx[0], index, 128, W_fx[0], &minDist_fx); /* 2.56*2.56*Q(-5) */
 
         /* Update */
         s[0][state]    = prev_state;
@@ -1348,9 +1383,8 @@ static void BcTcvq_2nd_fx(
 {
     Word16 state, prev_state;
     Word16 index, bestCode;
-    Word32 dist_fx, minDist_fx;
+    Word32 minDist_fx;
     Word16 pred_fx[N_DIM], target_fx[N_DIM];
-    Word16 temp16_fx;
 
     FOR (state = 0; state < NUM_STATE; state++)
     {
@@ -1369,28 +1403,7 @@ static void BcTcvq_2nd_fx(
         target_fx[1] = sub(x_fx[1][1], pred_fx[1]);
         move16(); /* x2.65 */
 
-        temp16_fx = sub(target_fx[0], CB_fx[1][index][0]);
-        minDist_fx = Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[1][0]); /* 2.65*2.65*Q(-5) */
-        temp16_fx = sub(target_fx[1], CB_fx[1][index][1]);
-        minDist_fx = L_add(minDist_fx, Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[1][1])); /* 2.65*2.65*Q(-5) */
-
-        bestCode = index;
-        move16();
-
-        FOR (index = index + 8; index < 128; index += 8)
-        {
-            temp16_fx = sub(target_fx[0], CB_fx[1][index][0]);
-            dist_fx = Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[1][0]); /* 2.65*2.65*Q(-5) */
-            temp16_fx = sub(target_fx[1], CB_fx[1][index][1]);
-            dist_fx = L_add(dist_fx, Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[1][1])); /* 2.65*2.65*Q(-5) */
-
-            if (L_sub(dist_fx, minDist_fx) < 0)
-            {
-                bestCode = index;
-                move16();
-            }
-            minDist_fx = L_min(minDist_fx, dist_fx);
-        }
+        bestCode = BcTcvq_SearchCode_fx(target_fx, CB_fx[1], index, 128, W_fx[1], &minDist_fx); /* 2.65*2.65*Q(-5) */
 
         /* Update */
         s[1][state]    = prev_state;
@@ -1423,9 +1436,8 @@ static void BcTcvq_SubBlock_fx(
 {
     Word16 stage1, stage2, state, prev_state, branch;
     Word16 index, bestCode, brCode[N_DIM];
-    Word16 temp16_fx;
 
-    Word32 dist_fx, minDist_fx, brDist_fx[N_DIM];
+    Word32 minDist_fx, brDist_fx[N_DIM];
     Word16 pred_fx[N_DIM], target_fx[N_DIM], brQuant_fx[N_DIM][N_DIM];
 
     stage1 = sub(stage, 1);
@@ -1450,28 +1462,7 @@ static void BcTcvq_SubBlock_fx(
         target_fx[1] = sub(x_fx[stage][1], pred_fx[1]);
         move16();
 
-        temp16_fx = sub(target_fx[0], CB_fx[stage2][index][0]);
-        minDist_fx = Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[stage][0]); /* 2.65*2.65*Q(-5) */
-        temp16_fx = sub(target_fx[1], CB_fx[stage2][index][1]);
-        minDist_fx = L_add(minDist_fx, Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[stage][1])); /* 2.65*2.65*Q(-5) */
-
-        bestCode = index;
-        move16();
-
-        FOR (index = index + 8; index < 64; index += 8)
-        {
-            temp16_fx = sub(target_fx[0], CB_fx[stage2][index][0]);
-            dist_fx = Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[stage][0]);
-            temp16_fx = sub(target_fx[1], CB_fx[stage2][index][1]);
-            dist_fx = L_add(dist_fx, Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[stage][1]));
-
-            if (L_sub(dist_fx, minDist_fx) < 0)
-            {
-                bestCode = index;
-                move16();
-            }
-            minDist_fx = L_min(minDist_fx, dist_fx);
-        }
+        bestCode = BcTcvq_SearchCode_fx(target_fx, CB_fx[stage2], index, 64, W_fx[stage], &minDist_fx); /* 2.65*2.65*Q(-5) */
 
         brCode[0]    = bestCode;
         move16();
@@ -1499,27 +1490,7 @@ static void BcTcvq_SubBlock_fx(
         target_fx[1] = sub(x_fx[stage][1], pred_fx[1]);
         move16();
 
-        temp16_fx = sub(target_fx[0], CB_fx[stage2][index][0]);
-        minDist_fx = Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[stage][0]); /* 2.65*2.65*Q(-5) */
-        temp16_fx = sub(target_fx[1], CB_fx[stage2][index][1]);
-        minDist_fx = L_add(minDist_fx, Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[stage][1])); /* 2.65*2.65*Q(-5) */
-
-        bestCode = index;
-        move16();
-
-        FOR (index = index + 8; index < 64; index += 8)
-        {
-            temp16_fx = sub(target_fx[0], CB_fx[stage2][index][0]);
-            dist_fx = Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[stage][0]);
-            temp16_fx = sub(target_fx[1], CB_fx[stage2][index][1]);
-            dist_fx = L_add(dist_fx, Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[stage][1]));
-            if (L_sub(dist_fx, minDist_fx) < 0)
-            {
-                bestCode = index;
-                move16();
-            }
-            minDist_fx = L_min(minDist_fx, dist_fx);
-        }
+        bestCode = BcTcvq_SearchCode_fx(target_fx, CB_fx[stage2], index, 64, W_fx[stage], &minDist_fx); /* 2.65*2.65*Q(-5) */
 
         brCode[1]    = bestCode;
         move16();
@@ -1574,9 +1545,8 @@ static Word32 BcTcvq_FixSearch_fx(
 {
     Word16 stage1, stage4, branch;
     Word16 index, bestCode;
-    Word32 dist_fx, minDist_fx;
+    Word32 minDist_fx;
     Word16 pred_fx[N_DIM], target_fx[N_DIM];
-    Word16 temp16_fx;
 
     stage1 = sub(stage, 1);
     stage4 = sub(stage, 4);
@@ -1596,28 +1566,7 @@ static Word32 BcTcvq_FixSearch_fx(
     target_fx[1] = sub(x_fx[stage][1], pred_fx[1]);
     move16();
 
-    temp16_fx = sub(target_fx[0], CB_fx[stage4][index][0]);
-    minDist_fx = Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[stage][0]); /* 2.65*2.65*Q(-5) */
-    temp16_fx = sub(target_fx[1], CB_fx[stage4][index][1]);
-    minDist_fx = L_add(minDist_fx, Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[stage][1])); /* 2.65*2.65*Q(-5) */
-
-    bestCode = index;
-    move16();
-
-    FOR (index = index + 8; index < 32; index += 8)
-    {
-        temp16_fx = sub(target_fx[0], CB_fx[stage4][index][0]);
-        dist_fx = Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[stage][0]);
-        temp16_fx = sub(target_fx[1], CB_fx[stage4][index][1]);
-        dist_fx = L_add(dist_fx, Mult_32_16(L_mult0(temp16_fx, temp16_fx), W_fx[stage][1]));
-
-        if(L_sub(dist_fx, minDist_fx) < 0)
-        {
-            bestCode = index;
-            move16();
-        }
-        minDist_fx = L_min(minDist_fx, dist_fx);
-    }
+    bestCode = BcTcvq_SearchCode_fx(target_fx, CB_fx[stage4], index, 32, W_fx[stage], &minDist_fx); /* 2.65*2.65*Q(-5) */
 
     /* Update */
     *prev_state         = NTRANS2[branch][*prev_state];
@@ -15,7 +15,7 @@
 static Word32 quantize_data_fx( Word16 *data, const Word16 *w_in,  Word16 *qin, Word16 *cv_out, Word16 *idx_lead, Word16 *idx_scale,  const Word16 *sigma, const Word16 *inv_sigma,
                                 const Word16 *scales, Word16 no_scales, const Word16 *no_lead );
 static Word32 q_data_fx(Word16 *pTmp1, const Word16 *w1, Word16 *quant, Word16 *cv_out, Word16 *idx_lead, Word16 *idx_scale,
-                        const Word16 *p_sigma, const Word16 *p_inv_sigma, const Word16 *p_scales, Word16 *p_no_scales,
+                        const Word16 *p_sigma, const Word16 *p_inv_sigma, const Word16 *p_scales, const Word16 *p_no_scales,
                         const Word16 *p_no_lead);
 static void prepare_data_fx( Word16 *xsort, Word16 *sign, Word16 *data, Word32 *w, const Word16 *w_in,
                              const Word16 *sigma, const Word16 * inv_sigma, Word16 *p_sig );
@@ -45,13 +45,13 @@ Word32 mslvq_fx (
     Word16 mode,                /* i  : number indicating the coding type (V/UV/G...)*/
     Word16 mode_glb,            /* i  : LVQ coding mode */
     Word16 pred_flag,           /* i  : prediction flag (0: safety net, 1,2 - predictive  )*/
-    Word16 no_scales[][2]
+    const Word16 no_scales[][2]
 )
 {
     Word32 dist, L_tmp;
     const Word16 * p_scales, *p_sigma, *p_inv_sigma;
     const Word16  *p_no_lead;
-    Word16 * p_no_scales;
+    const Word16 * p_no_scales;
 
 
     dist = L_deposit_l(0);
@@ -104,7 +104,7 @@ static Word32 q_data_fx(
     const Word16 *p_sigma,     /* i: standard deviation x2.56                                 */
     const Word16 *p_inv_sigma, /* i: inverse standard deviation Q15                           */
     const Word16 *p_scales,    /* i: scale values Q11                                         */
-    Word16 *p_no_scales,       /* i: number of scales/truncations for each subvector          */
+    const Word16 *p_no_scales,       /* i: number of scales/truncations for each subvector          */
     const Word16 *p_no_lead    /* i: number of leaders for each truncation and each subvector */
 )
 {
@@ -139,13 +139,13 @@ Word32 mslvq_cng_fx (
     Word16   *idx_lead,         /* o  : leader index for each 8-dim subvector                            */
     Word16   *idx_scale,        /* o  : scale index for each subvector                                   */
     const Word16 *w,            /* i  : weights for LSF quantization                                  Q10*/
-    Word16 * no_scales
+    const Word16 * no_scales
 )
 {
     Word32 dist;
     const Word16 *p_scales, *p_sigma, *p_inv_sigma;
     const Word16 *p_no_lead;
-    Word16   *p_no_scales;
+    const Word16   *p_no_scales;
     Word16 mode_glb, mode, i;
     Word16 pTmp1[M], w1[M];
 
@@ -333,6 +333,9 @@ static Word32 calculate_min_dist_fx(
     pl_crt = &pl_HQ_fx[0];
     move16();
 
+    /* The leader components are at most 8 (Q1) and |w_norm| < 2^30, so the
+       accumulations below stay far from 32 bits: plain integer arithmetic
+       gives the same sums as L_mac()/L_msu()/Mult_32_16()/L_add() */
     FOR(j=0; j<no_leaders[0]; j++)
     {
         sum1[j] = L_deposit_l(0);
@@ -345,9 +348,9 @@ static Word32 calculate_min_dist_fx(
             p = *pl_crt;
             IF (p)
             {
-                sum1[j] = L_mac(sum1[j], wx[l], p); /* Q(7-nb) + Q1 + Q1 = Q(9-nb) */
-                p1 = i_mult2(p,p); /*Q2 */
-                sum2[j] = L_add(sum2[j], Mult_32_16(w_norm[l], p1)); /* Q(26-nb) + Q2 -Q15 = Q(13-nb) */
+                sum1[j] += 2 * wx[l] * p; /* Q(7-nb) + Q1 + Q1 = Q(9-nb) */
+                p1 = p * p; /*Q2 */
+                sum2[j] += (Word32) (((Word40) w_norm[l] * p1) >> 15); /* Q(26-nb) + Q2 -Q15 = Q(13-nb) */
                 pl_crt++;
                 l++;
             }
@@ -366,24 +369,24 @@ static Word32 calculate_min_dist_fx(
             {
                 IF ( sub(sig,pl_par_fx[j]) != 0 )
                 {
-                    sum1[j] = L_msu(sum1[j], wx[l], p); /* Q(7-nb) + Q1 + Q1 = Q(9-nb) //Q-7 + Q1 + Q1 = Q-5 */
-                    p1 = i_mult2(p,p); /*Q2 */
-                    sum2[j] = L_add(sum2[j], Mult_32_16(w_norm[l], p1)); /* Q(26-nb) + Q2 -Q15 = Q(13-nb)   //Q12 + Q2 -Q15 = Q-1 */
+                    sum1[j] -= 2 * wx[l] * p; /* Q(7-nb) + Q1 + Q1 = Q(9-nb) //Q-7 + Q1 + Q1 = Q-5 */
+                    p1 = p * p; /*Q2 */
+                    sum2[j] += (Word32) (((Word40) w_norm[l] * p1) >> 15); /* Q(26-nb) + Q2 -Q15 = Q(13-nb)   //Q12 + Q2 -Q15 = Q-1 */
                     pl_crt++;
                 }
                 ELSE
                 {
-                    sum1[j] = L_mac(sum1[j], wx[l], p); /* Q(7-nb) + Q1 + Q1 = Q(9-nb)   //Q-7 + Q1 + Q1 = Q-5 */
-                    p1 = i_mult2(p,p); /*Q2 */
-                    sum2[j] = L_add(sum2[j], Mult_32_16(w_norm[l], p1)); /* Q(26-nb) + Q2 -Q15 = Q(13-nb)    //Q12 + Q2 -Q15 = Q-1 */
+                    sum1[j] += 2 * wx[l] * p; /* Q(7-nb) + Q1 + Q1 = Q(9-nb)   //Q-7 + Q1 + Q1 = Q-5 */
+                    p1 = p * p; /*Q2 */
+                    sum2[j] += (Word32) (((Word40) w_norm[l] * p1) >> 15); /* Q(26-nb) + Q2 -Q15 = Q(13-nb)    //Q12 + Q2 -Q15 = Q-1 */
                     pl_crt++;
                 }
             }
             ELSE
             {
-                sum1[j] = L_mac(sum1[j], wx[l], p); /* Q(7-nb) + Q1 + Q1 = Q(9-nb)   //Q-7 + Q1 + Q1 = Q-5 */
-                p1 = i_mult2(p,p); /*Q2 */
-                sum2[j] = L_add(sum2[j], Mult_32_16(w_norm[l], p1)); /* Q(26-nb) + Q2 -Q15 = Q(13-nb)  // Q12 + Q2 -Q15 = Q-1 */
+                sum1[j] += 2 * wx[l] * p; /* Q(7-nb) + Q1 + Q1 = Q(9-nb)   //Q-7 + Q1 + Q1 = Q-5 */
+                p1 = p * p; /*Q2 */
+                sum2[j] += (Word32) (((Word40) w_norm[l] * p1) >> 15); /* Q(26-nb) + Q2 -Q15 = Q(13-nb)  // Q12 + Q2 -Q15 = Q-1 */
                 pl_crt++;
             }
         }
@@ -584,7 +587,7 @@ static void sort_desc_ind_fx(
         move16();
         FOR ( i=0 ; i < k ; i++ )
         {
-            IF ( sub(s[i],s[i+1]) < 0 )
+            IF ( s[i] < s[i+1] )
             {
                 sorted = 0;
                 move16();
@@ -618,9 +621,9 @@ void index_lvq_fx (
     Word16   *idx_scale,      /* i :scale index for each subvector                                      */
     Word16   mode,            /* i : integer signalling the quantizer structure for the current bitrate */
     Word16 *index,            /* o : encoded index (represented on 3 short each with 15 bits )          */
-    Word32 * p_offset_scale1, /* i : scales for first subvector                                         */
-    Word32 * p_offset_scale2, /* i : scales for second subvector                                        */
-    Word16 * p_no_scales      /* i : number of scales for each subvector                                */
+    const Word32 * p_offset_scale1, /* i : scales for first subvector                                         */
+    const Word32 * p_offset_scale2, /* i : scales for second subvector                                        */
+    const Word16 * p_no_scales      /* i : number of scales for each subvector                                */
 )
 {
     Word32 index1, index2, tmp, idx[2];
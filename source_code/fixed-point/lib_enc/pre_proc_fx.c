@@ -191,6 +191,8 @@ void pre_proc_fx(
 
     analysisCldfbEncoder_fx( st, signal_in, realBuffer, imagBuffer, realBuffer16, imagBuffer16, enerBuffer, &enerBuffer_exp, cldfbScale);
     cldfbScale->hb_scale = cldfbScale->lb_scale;
+    FE_STATS_FRAME(st);
+    FE_STATS_TRANSFORM(st, 1);
 
     /*----------------------------------------------------------------*
      * Change the sampling frequency to 12.8 kHz
@@ -234,10 +236,15 @@ void pre_proc_fx(
 
     /*-------------------------------------------------------------------------*
      * Spectral analysis
+     *
+     * The two half-frame spectra are computed only here; the SADs, the noise
+     * estimation, the classifiers and the LSF weighting read fr_bands, lf_E,
+     * PS, fft_buff and the per-bin energies kept in st.
      *--------------------------------------------------------------------------*/
 
     analy_sp( inp_12k8, *Q_new, fr_bands, lf_E, Etot, st->min_band_fx, st->max_band_fx, Le_min_scaled, Scale_fac, st->Bin_E_fx, st->Bin_E_old_fx,
               PS, st->lgBin_E_fx, st->band_energies, fft_buff );
+    FE_STATS_TRANSFORM(st, 2);
 
     st->band_energies_exp = sub(sub(WORD32_BITS-1,*Q_new),QSCALE);
     move16();
@@ -254,6 +261,7 @@ void pre_proc_fx(
 
     vad_flag_cldfb = vad_proc( &(st->vad_st),realBuffer, imagBuffer, cldfbScale->lb_scale, &cldfb_addition,
                                enerBuffer, enerBuffer_exp,st->cldfbAna_Fx->no_channels, *vad_flag );
+    FE_STATS_TRANSFORM(st, 1);  /* subband_FFT() of the CLDFB samples */
 
     /* Combine decisions from SADS */
     test();
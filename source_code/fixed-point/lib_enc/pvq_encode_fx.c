@@ -57,12 +57,9 @@ Word16 one_pulse_search(const Word16 dim,       /* vector dimension       */
                         Word16 max_xabs)         /* current accumulated max amplitude for pulses */
 {
     Word16  i, corr_up_shift, corr_tmp, imax,  corr_sq_tmp, en_max_den, cmax_num, en_tmp;
-    Word32  L_tmp_en_lc, L_tmp_corr  ;
+    Word32  L_tmp_corr, L_xy_tmp, L_yy_tmp;
     Word32  L_tmp_en, L_en_max_den, L_corr_sq_max, L_tmp_corr_sq;
-    Word32  L_left_h, L_right_h;
-    UWord32 UL_left_l, UL_right_l, UL_dummy;
-    Word32  L_tmp;
-    UWord16 u_sgn;
+    Word40  W_corr;
 
     en_tmp           = en_dn_shift; /* dummy assignment to avoid compiler warning for unused parameter  */
 
@@ -74,31 +71,40 @@ Word16 one_pulse_search(const Word16 dim,       /* vector dimension       */
     /* activate low complexity en/corr search section conditionally if resulting vector energy is within limits    */
     /* typical case for higher dimensions                                                                          */
 
+    /* The correlation L_xy + 2*x_abs[i] is upshifted by its worst case normalization and the
+       energy L_yy + 2*y[i] stays far below 2^31 (at most KMAX_FX pulses), so the 32 bit terms
+       below need no saturation. The energy/correlation cross comparisons are done on the
+       exact products; the saturated BASOP differences had the same sign.                   */
+
     IF( high_prec_active == 0 )
     {
-        en_max_den        =  0; /*move16()*/; /* OPT: move saved by  using high_prec_active as en_max_den */         /*      1 op   */
+        en_max_den        =  0;
         cmax_num          = -1;
-        move16();    /* req. to force a 1st update for n==0   */                            /*      1 op   */
+        move16();    /* req. to force a 1st update for n==0   */
+        L_xy_tmp = *L_xy_ptr;
+        L_yy_tmp = *L_yy_ptr;
 
-        FOR(i = 0; i < dim; i++)                                                                                     /* FOR 3 ops  */
+        FOR(i = 0; i < dim; i++)
         {
-            L_tmp_corr        = L_shl(L_mac(*L_xy_ptr,1,x_abs[i]), corr_up_shift );     /*  actual in-loop target    value, 2 ops  */
-            corr_tmp          = round_fx(L_tmp_corr);                                                                /*     1 op   */
-            corr_sq_tmp       = mult(corr_tmp, corr_tmp);  /* CorrSq, is a 16bit for low compelxity cross multiplication    1 op   */
+            L_tmp_corr        = (L_xy_tmp + 2 * x_abs[i]) << corr_up_shift;    /*  actual in-loop target    value */
+            corr_tmp          = MAX_16;                                         /* round_fx(), saturated at the top */
+            if( L_tmp_corr < 0x7fff8000L )
+            {
+                corr_tmp      = (Word16) ((L_tmp_corr + 0x8000L) >> 16);
+            }
+            corr_sq_tmp       = (Word16) ((corr_tmp * corr_tmp) >> 15);        /* CorrSq, 16 bit for low complexity cross multiplication */
 
-            L_tmp_en_lc       = L_mac(*L_yy_ptr, 1,y[i] );   /*Q1 result ,  energy may span up to ~14+1(Q1)+1(sign)=16 bits,  1 op */
-            /* extract_l without shift can always be used for this section as energy is guaranteed to stay in the lower word, 1 op */
-            en_tmp     = extract_l(L_tmp_en_lc); /* L_shl + round_fx could also be used also but then adds an uphift cost (2-3 ops)*/
+            /* energy is guaranteed to stay in the lower word, as extract_l(L_mac(*L_yy_ptr, 1, y[i])) */
+            en_tmp            = (Word16) (L_yy_tmp + 2 * y[i]);
 
-            /* 16/32 bit comparison    WC (4 +1+1 + (1+1+1) = 9                                                                   */
-            IF( L_msu(L_mult(corr_sq_tmp, en_max_den),cmax_num , en_tmp)  > 0)         /* use L_mult and then a L_msu,      2 ops  */
+            IF( (Word32) corr_sq_tmp * en_max_den > (Word32) cmax_num * en_tmp )
             {
                 cmax_num    = corr_sq_tmp;
-                move16();    /* 1 op */
+                move16();
                 en_max_den  = en_tmp;
-                move16();    /* 1 op */
+                move16();
                 imax        = i;
-                move16();    /* 1 op */
+                move16();
             }
         } /* dim  */
 
@@ -106,46 +112,28 @@ Word16 one_pulse_search(const Word16 dim,       /* vector dimension       */
     ELSE
     {
         /* High resolution section activated when vector energy is becoming high  (peaky or many pulses)                    */
-        /* BASOP operator Mpy32_32_ss used to allow higher resolution for both the CorrSq term and the Energy term          */
-
-        L_en_max_den  = L_deposit_l(0);                                                                            /* 1 op  */
-        L_corr_sq_max = L_deposit_l(-1); /* req. to force a 1st update   */                                        /* 1 op  */
+        /* exact wide products give the same CorrSq term and ordering as the Mpy_32_32_ss based hi/lo word comparison   */
+        L_en_max_den  = L_deposit_l(0);
+        L_corr_sq_max = L_deposit_l(-1); /* req. to force a 1st update   */
+        L_xy_tmp = *L_xy_ptr;
+        L_yy_tmp = *L_yy_ptr;
 
-        FOR(i = 0; i < dim; i++)                                                                               /* FOR 3 ops */
+        FOR(i = 0; i < dim; i++)
         {
-            L_tmp_corr        = L_shl(L_mac(*L_xy_ptr,1,x_abs[i]), corr_up_shift );     /* actual in  loop WC value 2 ops   */
-            Mpy_32_32_ss(L_tmp_corr,L_tmp_corr, &L_tmp_corr_sq, &UL_dummy);             /* CorrSq 32 bits,          4 ops   */
+            L_tmp_corr        = (L_xy_tmp + 2 * x_abs[i]) << corr_up_shift;    /* actual in  loop WC value */
+            W_corr            = (Word40) L_tmp_corr;
+            L_tmp_corr_sq     = (Word32) ((2 * W_corr * W_corr) >> 32);      /* CorrSq 32 bits, high word of Mpy_32_32_ss */
+
+            L_tmp_en          = L_yy_tmp + 2 * y[i];
 
-            L_tmp_en = L_mac(*L_yy_ptr, 1, y[i]);                         /* Q1,energy may span up to sign+19 bits , 1 op    */
-            /* For highest accuracy use pairs of maximum upshifted 32x32 bit signed values              */
             /*  (L_tmp_corr_sq / L_tmp_en)     >  (L_corr_sq_max/L_en_max_den)                          */
             /*  (L_tmp_corr_sq * L_en_max_den) >  (L_corr_sq_max * L_tmp_en)                            */
-            Mpy_32_32_ss( L_en_max_den, L_tmp_corr_sq, &L_left_h, &UL_left_l);                  /* 4 ops */
-            Mpy_32_32_ss( L_tmp_en, L_corr_sq_max, &L_right_h, &UL_right_l);                    /* 4 ops */
-
-            /* STL optimized "Lazy evaluation"  of:
-               IF( (L_left_h > L_right_h)  ||  ( (L_left_h == L_right_h) &&  (UL_left_l > UL_right_l) )
-             */
-            /* 32/64 bit Lazy eval comparison WC cost is    (1+  1+1+1 + 4 +(2+2+1) = 13 ,  and average  is  ~12 */
-            /* Unoptimized 32/64 bit comparison  WC cost is (1+1+ 2x2  + 4 +(2+2+1) = 15 */
-            L_tmp  = L_sub(L_left_h, L_right_h);              /* high  signed  word check            1 op  */
-            u_sgn = 0;
-            move16();                    /* 1 op  */
-            if(L_tmp == 0) /* L_tmp high Word testing is always needed */
-            {
-                /* The returned UL value from UL_subNs is not needed,  only u_sgn is needed  */
-                UL_subNs(UL_right_l, UL_left_l, &u_sgn);  /* low unsigned word check, note left/right order switch of ">"  due to ">=" inside UL_subNs, 1 op */
-            }
-            if( u_sgn != 0)
+            IF( (Word40) L_en_max_den * L_tmp_corr_sq > (Word40) L_tmp_en * L_corr_sq_max )
             {
-                L_tmp = L_add(L_tmp, 1);    /* 0+1  --> 1 use wrap/sign result of low Word u_sgn check */         /* 1 op  */
-            }
-            IF(  L_tmp > 0 )   /* IF  4 ops */
-            {
-                L_corr_sq_max =  L_add(L_tmp_corr_sq, 0);  /* 1-2 ops */
-                L_en_max_den  =  L_add(L_tmp_en, 0);       /* 1-2 ops */
+                L_corr_sq_max =  L_tmp_corr_sq;
+                L_en_max_den  =  L_tmp_en;
                 imax          =  i;
-                move16(); /* 1 op  */
+                move16();
             }
         }  /* dim loop */
 
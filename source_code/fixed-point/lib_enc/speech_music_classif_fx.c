@@ -50,7 +50,9 @@ static Word16 attack_det_fx( const Word16 *inp, const Word16 Qx, const Word16 la
 
                            );
 
-static void order_spectrum_fx( Word16 *vec, Word16 len );
+static void heap_build_fx( Word16 *vec, const Word16 len );
+
+static Word16 heap_pop_fx( Word16 *vec, const Word16 len );
 
 static void detect_sparseness_fx( Encoder_State_fx *st_fx, const Word16 localVAD_HE_SAD, Word16 *sp_aud_decision1,
                                   Word16 *sp_aud_decision2, const Word16 voi_fv );
@@ -113,9 +115,10 @@ void speech_music_classif_fx(
     {
 
 
-        /* Improvement of the 1st stage decision on mixed/music content */
+        /* Improvement of the 1st stage decision on mixed/music content (not in the fast complexity profile) */
+        test();
         test();
-        IF ( st->Opt_SC_VBR_fx == 0 && ( L_sub(st->total_brate_fx, ACELP_24k40) != 0 ) )
+        IF ( st->Opt_SC_VBR_fx == 0 && ( L_sub(st->total_brate_fx, ACELP_24k40) != 0 ) && sub(st->cmpl_profile, ENC_CMPL_FAST) != 0 )
         {
 
 
@@ -150,9 +153,10 @@ void speech_music_classif_fx(
 
 
 
-        /* Context-based improvement of 1st and 2nd stage decision on stable tonal signals */
+        /* Context-based improvement of 1st and 2nd stage decision on stable tonal signals (not in the fast complexity profile) */
+        test();
         test();
-        IF ( st->Opt_SC_VBR_fx == 0 && ( L_sub(st->total_brate_fx, ACELP_24k40) != 0 ) )
+        IF ( st->Opt_SC_VBR_fx == 0 && ( L_sub(st->total_brate_fx, ACELP_24k40) != 0 ) && sub(st->cmpl_profile, ENC_CMPL_FAST) != 0 )
         {
             tonal_context_improv_fx( st, PS, sp_aud_decision1, sp_aud_decision2, vad_flag, pitch, voicing,
                                      voi_fv, cor_map_sum_fv, LPCErr, Q_inp + QSCALE -2 );
@@ -249,7 +253,7 @@ static Word16 sp_mus_classif_gmm_fx(   /* o  : decision flag (1-music, 0-speech
     Word32 mx;
     Word32 sum_PS;
     Word16 ftmp, tmp16;
-    Word16  xm[N_FEATURES];
+    Word16  xm[N_FEATURES], xm_s[N_FEATURES], xm_n[N_FEATURES];
     Word16 lps, lpm;
     Word16 lpn;
     Word16 e_tmp, f_tmp;
@@ -258,13 +262,13 @@ static Word16 sp_mus_classif_gmm_fx(   /* o  : decision flag (1-music, 0-speech
     Word32 ps_sta;
     Word32 ps_diff;
     Word16 ps_diff_16;
-    Word32 dPS[128], PS_norm[128];
+    Word32 dPS, PS_norm[128];
     Word32 lepsP1;
     Word32 max_s=0, max_m=0, py_s, py_m;
     Word32 max_n, py_n;  /* pyn */
     Word16 ishift[12] = {8,0,2,2,2,2,2,1,0,2,2,1};
     Word16 tmp;
-    Word16 tmp1,tmp2,exp2,scale,exp3;
+    Word16 tmp1,tmp2,exp2,scale,exp3,tmp_ps,exp_ps;
 
     /*------------------------------------------------------------------*
      * Initialization
@@ -391,10 +395,15 @@ static Word16 sp_mus_classif_gmm_fx(   /* o  : decision flag (1-music, 0-speech
     {
         sum_PS = L_add(sum_PS,PS[i]);
     }
-    exp1 = norm_l(sum_PS);
-    tmp1 = round_fx(L_shl(sum_PS,exp1));
-    exp1 = sub(30,exp1);
+    exp_ps = norm_l(sum_PS);
+    tmp_ps = round_fx(L_shl(sum_PS,exp_ps));
+    exp_ps = sub(30,exp_ps);
 
+    /* normalized spectrum, spectral difference and stationarity in one pass */
+    ps_diff = 0;
+    move16();
+    ps_sta = 0;
+    move16();
     FOR ( i = LOWEST_FBIN; i < HIGHEST_FBIN; i++ )
     {
         /*PS_norm[i] = PS[i] / sum_PS;*/
@@ -403,53 +412,20 @@ static Word16 sp_mus_classif_gmm_fx(   /* o  : decision flag (1-music, 0-speech
         tmp2 = round_fx(L_shl(PS[i],exp2));
         exp2 = sub(30,exp2);
 
-        scale = shr(sub(tmp1, tmp2), 15);
+        scale = shr(sub(tmp_ps, tmp2), 15);
         tmp2 = shl(tmp2, scale);
         exp2 = sub(exp2, scale);
 
-        exp3 = sub(exp1,exp2);
+        exp3 = sub(exp_ps,exp2);
 
-        tmp = div_s(tmp2, tmp1);             /*Q(15+exp3) */
+        tmp = div_s(tmp2, tmp_ps);             /*Q(15+exp3) */
         PS_norm[i] = L_shl(tmp,sub(10,exp3));
         move32(); /*Q25 */
-        dPS[i] = L_abs(L_sub(PS_norm[i],st_fx->past_PS_fx[i-LOWEST_FBIN]));
-        move32();   /*Q25 */
-    }
+        dPS = L_abs(L_sub(PS_norm[i],st_fx->past_PS_fx[i-LOWEST_FBIN]));   /*Q25 */
 
-    /* [10] ps_diff (spectral difference) Q10*/
-    ps_diff = 0;
-    move16();
-    FOR ( i = LOWEST_FBIN; i < HIGHEST_FBIN; i++ )
-    {
         /*ps_diff += dPS[i];*/
-        ps_diff = L_add(ps_diff,dPS[i]); /*Q25*/
-    }
-
-    /*ps_diff = (float)log(ps_diff + 1e-5f);*/
-    IF( ps_diff != 0 )
-    {
-        e_tmp = norm_l(ps_diff);
-        f_tmp = Log2_norm_lc(L_shl(ps_diff,e_tmp));
-        e_tmp = sub(30-25,e_tmp);
-        ps_diff = Mpy_32_16(e_tmp, f_tmp, 22713);/* Q16 */ /* 22713 = ln(2) in Q15 */
-        ps_diff_16 = round_fx(L_shl(ps_diff,10)); /*Q10 */
-    }
-    ELSE
-    {
-        ps_diff_16 = -11789;
-        move16(); /*Q10 */
-    }
+        ps_diff = L_add(ps_diff,dPS); /*Q25*/
 
-    *pFV++ = add(ps_diff_16, st_fx->past_ps_diff_fx);
-    move16();/*Q10 */
-    st_fx->past_ps_diff_fx = ps_diff_16;
-    move16(); /*Q10 */
-
-    /* [11] ps_sta (spectral stationarity) Q11 */
-    ps_sta = 0;
-    move16();
-    FOR ( i = LOWEST_FBIN; i < HIGHEST_FBIN; i++ )
-    {
         /*mx = PS_norm[i] > st->past_PS[i] ? PS_norm[i] : st->past_PS[i];*/
         IF (L_sub(PS_norm[i],st_fx->past_PS_fx[i-LOWEST_FBIN]) > 0)
         {
@@ -463,14 +439,14 @@ static Word16 sp_mus_classif_gmm_fx(   /* o  : decision flag (1-music, 0-speech
         }
 
         /*ps_sta += mx / (dPS[i] + 1e-5f);*/
-        IF( !dPS[i] )
+        IF( !dPS )
         {
             ps_sta = L_add(ps_sta,L_shr(mx,9));  /*Q16 */
         }
         ELSE
         {
-            exp1 = norm_l(L_add(dPS[i],336));
-            tmp1 = round_fx(L_shl(L_add(dPS[i],336),exp1));
+            exp1 = norm_l(L_add(dPS,336));
+            tmp1 = round_fx(L_shl(L_add(dPS,336),exp1));
             exp1 = sub(30,exp1);
 
             exp2 = norm_l(mx);
@@ -490,6 +466,29 @@ static Word16 sp_mus_classif_gmm_fx(   /* o  : decision flag (1-music, 0-speech
         }
     }
 
+    /* [10] ps_diff (spectral difference) Q10*/
+
+    /*ps_diff = (float)log(ps_diff + 1e-5f);*/
+    IF( ps_diff != 0 )
+    {
+        e_tmp = norm_l(ps_diff);
+        f_tmp = Log2_norm_lc(L_shl(ps_diff,e_tmp));
+        e_tmp = sub(30-25,e_tmp);
+        ps_diff = Mpy_32_16(e_tmp, f_tmp, 22713);/* Q16 */ /* 22713 = ln(2) in Q15 */
+        ps_diff_16 = round_fx(L_shl(ps_diff,10)); /*Q10 */
+    }
+    ELSE
+    {
+        ps_diff_16 = -11789;
+        move16(); /*Q10 */
+    }
+
+    *pFV++ = add(ps_diff_16, st_fx->past_ps_diff_fx);
+    move16();/*Q10 */
+    st_fx->past_ps_diff_fx = ps_diff_16;
+    move16(); /*Q10 */
+
+    /* [11] ps_sta (spectral stationarity) Q11 */
     /**pFV++ = (float)log(ps_sta + 1e-5f);*/
     ps_sta = L_add(ps_sta, 336);
     e_tmp = norm_l(ps_sta);
@@ -554,51 +553,37 @@ static Word16 sp_mus_classif_gmm_fx(   /* o  : decision flag (1-music, 0-speech
 
     FOR ( k = 0; k < N_MIXTURES; k++ )
     {
-        /* for each mixture, calculate the probability of speech or noise and the probability of music */
-        /* active frames - calculate the probability of speech */
+        /* for each mixture, calculate the probability of speech (active frames), noise (inactive frames)
+           and music (either active or inactive frames) */
         FOR ( p = 0; p < N_FEATURES; p++ )
         {
             /* xm[p] = FV[p] - m_speech[k*N_FEATURES+p];*/
-            xm[p] = sub(FV[p],m_speech_fx[k*N_FEATURES+p]);
+            xm_s[p] = sub(FV[p], m_speech_fx[k*N_FEATURES+p]);
+            move16();/*Q15 */
+            /*xm[p] = FV[p] - m_noise[k*N_FEATURES+p];*/
+            xm_n[p] = sub(FV[p], m_noise_fx[k*N_FEATURES+p]);
+            move16();/*Q15 */
+            /*xm[p] = FV[p] - m_music[k*N_FEATURES+p];*/
+            xm[p] = sub(FV[p], m_music_fx[k*N_FEATURES+p]);
             move16();/*Q15 */
         }
 
         /*py = lvm_speech[k] + dot_product_mat(xm, &invV_speech[k*N_FEATURES*N_FEATURES], N_FEATURES );*/
-        L_tmp = dot_product_mat_fx(xm, &invV_speech_fx[k*N_FEATURES*N_FEATURES], N_FEATURES);  /*Q10 */
+        L_tmp = dot_product_mat_fx(xm_s, &invV_speech_fx[k*N_FEATURES*N_FEATURES], N_FEATURES);  /*Q10 */
         py_s = L_add(lvm_speech_fx[k],L_tmp);	/*Q10 */
         max_s = L_max(py_s, max_s);
-
-
         /* pys += (float)exp(py);  */
 
-        /* inactive frames - calculate the probability of noise */
-        FOR ( p = 0; p < N_FEATURES; p++ )
-        {
-            /*xm[p] = FV[p] - m_noise[k*N_FEATURES+p];*/
-            xm[p] = sub(FV[p], m_noise_fx[k*N_FEATURES+p]);
-            move16();/*Q15 */
-        }
-
         /*py = lvm_noise[k] + dot_product_mat(xm, &invV_noise[k*N_FEATURES*N_FEATURES], N_FEATURES );*/
-        L_tmp = dot_product_mat_fx(xm, &invV_noise_fx[k*N_FEATURES*N_FEATURES], N_FEATURES);  /*Q10 */
-        /* pyn += (float)exp(py); */
+        L_tmp = dot_product_mat_fx(xm_n, &invV_noise_fx[k*N_FEATURES*N_FEATURES], N_FEATURES);  /*Q10 */
         py_n = L_add(lvm_noise_fx[k],L_tmp); /*Q10 */
         max_n = L_max(py_n, max_n);
-
-
-        /* either active or inactive frames - calculate the probability of music */
-        FOR ( p = 0; p < N_FEATURES; p++ )
-        {
-            /*xm[p] = FV[p] - m_music[k*N_FEATURES+p];*/
-            xm[p] = sub(FV[p], m_music_fx[k*N_FEATURES+p]);
-            move16();	/*Q15 */
-        }
+        /* pyn += (float)exp(py); */
 
         /*py = lvm_music[k] + dot_product_mat(xm, &invV_music[k*N_FEATURES*N_FEATURES], N_FEATURES );*/
         L_tmp = dot_product_mat_fx(xm, &invV_music_fx[k*N_FEATURES*N_FEATURES], N_FEATURES); /*Q10 */
         py_m = L_add(lvm_music_fx[k],L_tmp); /*Q10 */
         max_m = L_max(py_m, max_m);
-
         /*pym += (float)exp(py);#######*/
     }
 
@@ -2514,10 +2499,8 @@ static void detect_sparseness_fx(
     sumh = extract_l(L_shr(L_tmp1, 7)); /* Q0 */
     sum = add(extract_l(L_shr(L_tmp, 7)), sumh); /* Q0 */
 
-    /* order spectral from max to min */
-    order_spectrum_fx(S1, 128);
-
-    /* calculate spectral sparseness in the range 0 - 6.4 kHz */
+    /* calculate spectral sparseness in the range 0 - 6.4 kHz (spectrum taken from max to min) */
+    heap_build_fx(S1, 128);
     j = 0;
     move16();
     L_tmp = 0;
@@ -2525,7 +2508,7 @@ static void detect_sparseness_fx(
     L_tmp1 = L_deposit_l(mult(sum, 24576));
     FOR (i = 0; i < 128; i++)
     {
-        L_tmp = L_add(L_tmp, L_deposit_l(S1[i]));
+        L_tmp = L_add(L_tmp, L_deposit_l(heap_pop_fx(S1, sub(128, i))));
         IF (L_sub(L_shr(L_tmp, 7), L_tmp1) > 0)
         {
             j = i;
@@ -2591,7 +2574,7 @@ static void detect_sparseness_fx(
         /* find high-band sparseness */
         Copy(st_fx->lgBin_E_fx+80, S1, 48);
 
-        order_spectrum_fx(S1, 48);
+        heap_build_fx(S1, 48);
 
         FOR (i = 0; i < HANG_LEN_INIT-1; i++)
         {
@@ -2603,13 +2586,7 @@ static void detect_sparseness_fx(
         L_tmp = L_deposit_l(0);
         FOR (i = 0; i < 5; i++)
         {
-            if (S1[i] < 0)
-            {
-                S1[i] = 0;
-                move16();
-            }
-
-            L_tmp = L_add(L_tmp, S1[i]);
+            L_tmp = L_add(L_tmp, s_max(heap_pop_fx(S1, sub(48, i)), 0));
         }
 
         tmp = extract_l(L_shr(L_tmp, 7));
@@ -2638,21 +2615,16 @@ static void detect_sparseness_fx(
         /* find low-band sparseness */
         Copy(st_fx->lgBin_E_fx, S1, 60);
 
-        order_spectrum_fx(S1, 60);
+        heap_build_fx(S1, 60);
         L_tmp = L_deposit_l(0);
         L_tmp1 = L_deposit_l(0);
         FOR (i = 0; i < 5; i++)
         {
-            if (S1[i] < 0)
-            {
-                S1[i] = 0;
-                move16();
-            }
-
-            L_tmp = L_add(L_tmp, S1[i]);
+            L_tmp = L_add(L_tmp, s_max(heap_pop_fx(S1, sub(60, i)), 0));
         }
 
-        FOR (; i < 60; i++)
+        /* the remaining 55 values, in any order */
+        FOR (i = 0; i < 55; i++)
         {
             if (S1[i] < 0)
             {
@@ -2817,68 +2789,78 @@ static void detect_sparseness_fx(
 }
 
 
-static void order_spectrum_fx(
-    Word16 *vec,
-    Word16 len
+/*---------------------------------------------------------------------*
+ * heap_build_fx()
+ * heap_pop_fx()
+ *
+ * Partial ordering of the spectrum from max to min: vec[] is arranged
+ * as a max-heap once and each pop then returns the next largest value,
+ * so only the order statistics which are used get extracted.
+ *---------------------------------------------------------------------*/
+
+static void heap_sift_fx(
+    Word16 *vec,             /* i/o: heap                                  */
+    Word16 i,                /* i  : node to move down                     */
+    const Word16 len         /* i  : heap size                             */
 )
 {
-    Word16 i, j, end, end_1, len_2, tmp;
-    Word16 smax, smin;
-    Word16 imax, imin;
+    Word16 c, tmp;
 
-    len_2 = shr(len, 1);
-    FOR(i = 0; i < len_2; i++)
+    tmp = vec[i];
+    move16();
+    c = add(shl(i, 1), 1);
+    WHILE ( sub(c, len) < 0 )
     {
-        imax = i;
-        move16();
-        imin = i;
-        move16();
-        smax = vec[i];
-        move16();
-        smin = vec[i];
-        move16();
-        end = sub(len, i);
-        FOR(j = i; j < end; j++)
+        test();
+        if ( sub(add(c, 1), len) < 0 && sub(vec[c+1], vec[c]) > 0 )
         {
-            IF(sub(vec[j], smax) > 0)
-            {
-                smax = vec[j];
-                move16();
-                imax = j;
-                move16();
-            }
-            ELSE
-            {
-                IF(sub(vec[j], smin) < 0)
-                {
-                    smin = vec[j];
-                    move16();
-                    imin = j;
-                    move16();
-                }
-            }
+            c = add(c, 1);
         }
-
-        tmp = vec[i];
-        move16();
-        vec[i] = smax;
-        move16();
-        vec[imax] = tmp;
-        move16();
-
-        IF(sub(imin, i) == 0)
+        IF ( sub(vec[c], tmp) <= 0 )
         {
-            imin = imax;
-            move16();
+            BREAK;
         }
-
-        end_1 = sub(end, 1);
-        tmp = vec[end_1];
+        vec[i] = vec[c];
         move16();
-        vec[end_1] = smin;
-        move16();
-        vec[imin] = tmp;
+        i = c;
         move16();
+        c = add(shl(i, 1), 1);
     }
+    vec[i] = tmp;
+    move16();
+
+    return;
+}
+
+static void heap_build_fx(
+    Word16 *vec,             /* i/o: spectrum / heap                       */
+    const Word16 len         /* i  : length                                */
+)
+{
+    Word16 i;
+
+    FOR ( i = sub(shr(len, 1), 1); i >= 0; i-- )
+    {
+        heap_sift_fx( vec, i, len );
+    }
+
+    return;
+}
+
+static Word16 heap_pop_fx(   /* o  : largest value of the heap             */
+    Word16 *vec,             /* i/o: heap, shrinks by one                  */
+    const Word16 len         /* i  : heap size                             */
+)
+{
+    Word16 top, n;
+
+    top = vec[0];
+    move16();
+    n = sub(len, 1);
+    vec[0] = vec[n];
+    move16();
+    heap_sift_fx( vec, 0, n );
+
+    return top;
 }
 
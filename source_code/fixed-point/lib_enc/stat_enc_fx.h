@@ -378,6 +378,29 @@ typedef struct
 FD_CNG_ENC;
 typedef FD_CNG_ENC *HANDLE_FD_CNG_ENC;
 
+/*---------------------------------------------------------------------------------*
+ * Front-end analysis statistics (only in builds with FE_STATS=1)
+ *
+ * The pre-processing computes the CLDFB analysis and the two half-frame FFTs of
+ * analy_sp() once per frame, and the front-end consumers read the resulting band
+ * energies, power/log-energy spectra and CLDFB energies. nb_transforms counts
+ * the transforms actually computed.
+ *---------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    Word32 nb_frames;                           /* frames through the pre-processing */
+    Word32 nb_transforms;                       /* spectral transforms computed */
+} FE_STATS_ENC;
+
+#if (FE_STATS)
+#define FE_STATS_FRAME(st)          ((st)->fe_stats.nb_frames++)
+#define FE_STATS_TRANSFORM(st, n)   ((st)->fe_stats.nb_transforms += (n))
+#else
+#define FE_STATS_FRAME(st)
+#define FE_STATS_TRANSFORM(st, n)
+#endif
+
 
 
 typedef struct Encoder_State_fx
@@ -404,6 +427,7 @@ typedef struct Encoder_State_fx
     Indice_fx *ind_list_fx;                     /* list of indices */
     Word16 next_ind_fx;                         /* pointer to the next empty slot in the list of indices */
     Word16 last_ind_fx;                         /* last written indice */
+    Word16 max_ind_fx;                          /* one past the highest slot written in the list of indices */
     Word16 bitstreamformat;                     /* Bitstream format flag (G.192/MIME) */
 
     Word32 input_Fs_fx;                         /* input signal sampling frequency in Hz */
@@ -430,6 +454,10 @@ typedef struct Encoder_State_fx
     Word16 active_fr_cnt_fx;                    /* counter of active frames */
     Word16 Opt_SC_VBR_fx;                       /* flag indicating SC-VBR mode */
     Word16 last_Opt_SC_VBR_fx;                  /* flag indicating SC-VBR mode in the last frame */
+    Word16 cmpl_profile;                        /* encoder complexity profile (ENC_CMPL_REFERENCE, ENC_CMPL_BALANCED or ENC_CMPL_FAST) */
+    Word16 cmpl_acelp_nbiter;                   /* maximum number of ACELP codebook search iterations, 0 = not limited */
+    Word16 cmpl_tcx_iter_max;                   /* maximum number of TCX rate loop iterations */
+    Word16 cmpl_lsf_nbest;                      /* number of MSVQ survivors searched by the LSF lattice VQ */
     Word16 lp_cng_mode2;
 
     /*----------------------------------------------------------------------------------*
@@ -438,6 +466,7 @@ typedef struct Encoder_State_fx
 
     Word16 clas_fx;                                 /* current frame clas */
     Word16 last_clas_fx;                            /* previous frame signal classification */
+    /* per-frame analysis shared by the front-end consumers (see analy_sp()) */
     Word32 Bin_E_fx[L_FFT];                         /* Q_new + Q_SCALE -2 per bin energy of two frames */
     Word32 Bin_E_old_fx[L_FFT/2];                   /* per bin energy of old 2nd frames */
     Word16 lsp_old1_fx[M];                          /* old unquantized LSP vector at the end of the frame */
@@ -448,12 +477,6 @@ typedef struct Encoder_State_fx
     Word16 lspold_enc_fx[M];                        /* old LSP vector at the end of the frame @16kHz */
     Word16 pstreaklen_fx;                           /* LSF quantizer */
     Word16 streaklimit_fx;                          /* LSF quantizer */
-    Word32 offset_scale1_fx[MAX_NO_MODES+1][MAX_NO_SCALES+1]; /* offsets for LSF LVQ structure 1st 8-dim subvector*/
-    Word32 offset_scale2_fx[MAX_NO_MODES+1][MAX_NO_SCALES+1]; /* offsets for LSF LVQ structure 2nd 8-dim subvector*/
-    Word32 offset_scale1_p_fx[MAX_NO_MODES_p+1][MAX_NO_SCALES+1]; /* offsets for LSF LVQ structure, pred. case, 1st 8-dim subvector*/
-    Word32 offset_scale2_p_fx[MAX_NO_MODES_p+1][MAX_NO_SCALES+1]; /* offsets for LSF LVQ structure, pred. case, 2nd 8-dim subvector*/
-    Word16 no_scales_fx[MAX_NO_MODES][2];                         /* LSF LVQ structure Q0*/
-    Word16 no_scales_p_fx[MAX_NO_MODES_p][2];                     /* LSF LVQ structure Q0*/
     Word16 stab_fac_fx;                                        /* LSF stability factor */
     Word16 mem_decim_fx[2*L_FILT_MAX];                      /* decimation filter memory */
     Word16 mem_deemph_fx;                                   /* deemphasis filter memory */
@@ -1205,6 +1228,9 @@ typedef struct Encoder_State_fx
 
     Word32 band_energies[2*NB_BANDS];     /* energy in critical bands without minimum noise floor MODE2_E_MIN */
     Word16 band_energies_exp;             /* exponent for energy in critical bands without minimum noise floor MODE2_E_MIN */
+#if (FE_STATS)
+    FE_STATS_ENC fe_stats;                /* front-end analysis statistics */
+#endif
 
     Word8 tcxonly;
 
@@ -1301,10 +1327,10 @@ typedef struct Encoder_State_fx
 
     Word16 Local_VAD;
 
-    Word8 outData[2+MAX_BITS_PER_FRAME];
-    Word8 outDataLen;
+    Word8 outData[1+(MAX_BITS_PER_FRAME+7)/8];
+    Word16 outDataLen;
 
-	Word16 outDataG192[2 + MAX_BITS_PER_FRAME];
+	Word16 *outDataG192;                       /* G.192 frame output, set by the API for G.192 output only */
 	Word16 outDataLenG192;
 
 } Encoder_State_fx;
@@ -768,10 +768,10 @@ Word16 tcx_scalar_quantization_rateloop(
     Word16 sqBits_in,           /* i  : number of sqBits as determined in prev. quant. stage, using stop mechanism (ie always <= target bits) */
     Word16 tcxRateLoopOpt,      /* i  : turns on/off rateloop optimization */
     const Word8 tcxonly,
-    CONTEXT_HM_CONFIG *hm_cfg   /* i  : configuration of the context-based harmonic model */
+    CONTEXT_HM_CONFIG *hm_cfg,  /* i  : configuration of the context-based harmonic model */
+    const Word16 iter_max       /* i  : maximum number of iterations  */
 )
 {
-    const Word16 iter_max = 4;
     Word16 sqBits;
     Word16 stopFlag;
     Word8 ubfound,lbfound;
@@ -791,10 +791,13 @@ Word16 tcx_scalar_quantization_rateloop(
     Word16 tmp, fac1, fac2;
     Word32 tmp32;
     Word16 lastnz;
+    Word16 xq_is_gain;
 
 
 
     /* Init */
+    xq_is_gain = 0;
+    move16();
     sqGain = *gain;
     move16();
     sqGain_e = *gain_e;
@@ -970,6 +973,8 @@ Word16 tcx_scalar_quantization_rateloop(
 
         /* Quantize spectrum */
         tcx_scalar_quantization( x, x_e, xq, L_frame, sqGain, sqGain_e, offset, memQuantZeros, tcxonly );
+        xq_is_gain = 0;
+        move16();
 
         /* Estimate bitrate */
         stopFlag = 1;
@@ -1010,14 +1015,19 @@ Word16 tcx_scalar_quantization_rateloop(
                 move16();
                 *lastnz_out = lastnz;
                 move16();
+                xq_is_gain = 1;
+                move16();
             }
         }
     } /* for ( iter=0 ; iter<iter_max ; iter++ ) */
 
     IF ( tcxRateLoopOpt > 0 )
     {
-        /* Quantize spectrum */
-        tcx_scalar_quantization( x, x_e, xq, L_frame, *gain, *gain_e, offset, memQuantZeros, tcxonly );
+        /* Quantize spectrum, unless the last iteration already did it with the retained gain */
+        IF ( xq_is_gain == 0 )
+        {
+            tcx_scalar_quantization( x, x_e, xq, L_frame, *gain, *gain_e, offset, memQuantZeros, tcxonly );
+        }
 
         /* Output */
         *nEncoded = old_nEncoded;
@@ -0,0 +1,612 @@
+/*====================================================================================
+    EVS batch transcoder: runs the encode/decode jobs of a manifest on all cores
+  ====================================================================================*/
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "evs_encoder.h"
+#include "evs_decoder.h"
+#include "mime.h"
+
+/************************************************************
+Usage : EVS_batch [-t threads] manifest_file
+
+    Every line of the manifest is one stream, '#' starts a comment:
+
+        mode input output fs bitrate [band=NB|WB|SWB|FB] [dtx=0|-1|3..100] [format=mime|g192]
+
+        mode    : enc   pcm input file -> bitstream output file
+                  dec   bitstream input file -> pcm output file
+                  trans bitstream input file -> decoded and re-encoded bitstream output file
+        fs      : sampling rate of the pcm in Hz (8000, 16000, 32000 or 48000)
+        bitrate : bitrate of the encoder in bps, initial bitrate of the decoder
+        band    : maximum coded bandwidth of the encoder, WB by default
+        dtx     : 0 off (default), -1 adaptive SID update interval, 3..100 fixed interval
+        format  : bitstream files in MIME storage format (default) or G.192
+
+    Bitstream input may be an EVS MIME file ("#!EVS_MC1.0\n"), an AMR-WB RFC 4867 file
+    ("#!AMR-WB\n"), MIME frames without file header or G.192. The streams run on
+    -t threads (all online cores by default) with one codec context per stream.
+******************************************************************************************/
+
+#define BATCH_MAX_LINE        1024
+#define BATCH_OUT_BUF_SIZE    (1 << 20)                 /* stdio buffer of an output file   */
+#define BATCH_FRAME_SEC       0.02
+
+typedef enum { JOB_ENC, JOB_DEC, JOB_TRANS } JobMode;
+
+typedef struct
+{
+    JobMode mode;
+    char input[BATCH_MAX_LINE];
+    char output[BATCH_MAX_LINE];
+    int fs;
+    int bitrate;
+    char band[8];
+    int dtx;
+    int g192;
+    int line;                                           /* manifest line, for messages       */
+    off_t size;                                         /* input size, to order the jobs     */
+    long frames;                                        /* o: 20 ms frames of the stream     */
+    int failed;                                         /* o: job could not be completed     */
+} BatchJob;
+
+/* job indices of one worker: the owner takes from the head, idle workers steal from the tail */
+typedef struct
+{
+    pthread_mutex_t lock;
+    int *job;
+    int head, tail;
+} WorkQueue;
+
+typedef struct
+{
+    int id;
+    int nWorkers;
+    WorkQueue *queues;
+    BatchJob *jobs;
+    char *outBuf;
+    long steals;
+    double cpuSec;
+} Worker;
+
+/* pcm input file mapped into memory, bitstreams are read with G192_Stream_Open() */
+typedef struct
+{
+    char *data;
+    size_t size;
+} MappedFile;
+
+static double now_sec(clockid_t clock)
+{
+    struct timespec ts;
+
+    clock_gettime(clock, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int map_file(const char *name, MappedFile *f)
+{
+    struct stat st;
+    int fd;
+
+    f->data = NULL;
+    f->size = 0;
+    if ((fd = open(name, O_RDONLY)) < 0 || fstat(fd, &st) != 0)
+    {
+        fprintf(stderr, "Error: can not open %s: %s\n", name, strerror(errno));
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        return -1;
+    }
+    if (st.st_size > 0)
+    {
+        /* private writable mapping: the codec API takes non-const frame pointers */
+        f->data = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (f->data == MAP_FAILED)
+        {
+            fprintf(stderr, "Error: can not map %s: %s\n", name, strerror(errno));
+            f->data = NULL;
+            close(fd);
+            return -1;
+        }
+        madvise(f->data, st.st_size, MADV_SEQUENTIAL);
+        f->size = st.st_size;
+    }
+    close(fd);
+    return 0;
+}
+
+static void unmap_file(MappedFile *f)
+{
+    if (f->data != NULL)
+    {
+        munmap(f->data, f->size);
+    }
+}
+
+/*------------------------------------------------------------------------------------------*
+ * Stream processing, one codec context per stream
+ *------------------------------------------------------------------------------------------*/
+
+static EvsEncoderContext *open_encoder(BatchJob *job, FILE *out)
+{
+    EvsEncoderContext *enc;
+
+    if ((enc = NewEvsEncoder()) == NULL)
+    {
+        return NULL;
+    }
+    EvsSetEncoderQuiet(enc, 1);                         /* no banners or frame counter       */
+    if (InitEncoder(enc, job->fs, job->bitrate, job->band, job->g192, job->dtx) != 0)
+    {
+        FreeEncoder(enc);
+        return NULL;
+    }
+
+    if (!job->g192)
+    {
+        static const char channels[4] = { 0, 0, 0, 1 };
+
+        fwrite(EVS_MAGIC_NUMBER, sizeof(char), strlen(EVS_MAGIC_NUMBER), out);
+        fwrite(channels, sizeof(char), 4, out);
+    }
+    return enc;
+}
+
+static void encode_frame(EvsEncoderContext *enc, const char *pcm, int samples, int g192, FILE *out)
+{
+    EvsStartEncoder(enc, pcm, samples);
+    if (enc->buf->size > 0)
+    {
+        fwrite(enc->buf->data, sizeof(char), enc->buf->size, out);
+    }
+    else if (g192)
+    {
+        /* DTX NO_DATA: empty G.192 frame */
+        Word16 noData[2] = { (Word16)SYNC_GOOD_FRAME, 0 };
+        fwrite(noData, sizeof(Word16), 2, out);
+    }
+    else
+    {
+        /* DTX NO_DATA: ToC without speech bits */
+        UWord8 toc = NO_DATA_TYPE;
+        fwrite(&toc, sizeof(UWord8), 1, out);
+    }
+}
+
+static EvsDecoderContext *open_decoder(const BatchJob *job, int amrwb)
+{
+    EvsDecoderContext *dec;
+
+    if ((dec = NewEvsDecoder()) == NULL)
+    {
+        return NULL;
+    }
+    EvsSetDecoderQuiet(dec, 1);
+    if (InitDecoder(dec, job->fs, job->bitrate, job->g192) != 0 ||
+        (amrwb && EvsSetAmrWbInput(dec, 1) != 0))
+    {
+        FreeDecoder(dec);
+        return NULL;
+    }
+    return dec;
+}
+
+static int run_job(BatchJob *job, char *outBuf)
+{
+    MappedFile pcm = { NULL, 0 };
+    G192_STREAM_HANDLE stream = NULL;
+    G192_FRAME_VIEW frame;
+    G192_ERROR g192err;
+    Word32 nFrames;
+    EvsEncoderContext *enc = NULL;
+    EvsDecoderContext *dec = NULL;
+    FILE *out;
+    int frameBytes = job->fs / 50 * sizeof(Word16);
+    int err = 0;
+
+    job->frames = 0;
+    if (job->mode == JOB_ENC)
+    {
+        if (map_file(job->input, &pcm) != 0)
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        /* check the whole bitstream before any output is written */
+        g192err = G192_Stream_Open(&stream, job->input, job->g192 ? G192_FORMAT_G192 : G192_FORMAT_MIME);
+        if (g192err == G192_NO_ERROR)
+        {
+            g192err = G192_Stream_Validate(stream, &nFrames);
+        }
+        if (g192err != G192_NO_ERROR)
+        {
+            fprintf(stderr, "Error: %s line %d: bitstream can not be read (error %d)\n", job->input, job->line, g192err);
+            G192_Stream_Close(&stream);
+            return -1;
+        }
+    }
+    if ((out = fopen(job->output, "wb")) == NULL)
+    {
+        fprintf(stderr, "Error: can not open %s: %s\n", job->output, strerror(errno));
+        unmap_file(&pcm);
+        G192_Stream_Close(&stream);
+        return -1;
+    }
+    setvbuf(out, outBuf, _IOFBF, BATCH_OUT_BUF_SIZE);
+
+    if (job->mode != JOB_DEC && (enc = open_encoder(job, out)) == NULL)
+    {
+        err = -1;
+    }
+    if (!err && job->mode != JOB_ENC && (dec = open_decoder(job, G192_Stream_IsAmrWb(stream))) == NULL)
+    {
+        err = -1;
+    }
+
+    if (!err && job->mode == JOB_ENC)
+    {
+        size_t pos;
+        Word16 last[L_FRAME48k];
+
+        for (pos = 0; pos + frameBytes <= pcm.size; pos += frameBytes)
+        {
+            encode_frame(enc, pcm.data + pos, frameBytes / sizeof(Word16), job->g192, out);
+            job->frames++;
+        }
+        if (pos < pcm.size)
+        {
+            /* last frame padded with zeros */
+            memset(last, 0, sizeof(last));
+            memcpy(last, pcm.data + pos, pcm.size - pos);
+            encode_frame(enc, (const char*)last, frameBytes / sizeof(Word16), job->g192, out);
+            job->frames++;
+        }
+    }
+    else if (!err)
+    {
+        /* the frames are decoded in place from the mapped file */
+        while (G192_Stream_ReadFrame(stream, &frame) == G192_NO_ERROR)
+        {
+            if (EvsStartDecoder(dec, (char*)frame.data) != 0 || dec->buf->size <= 0)
+            {
+                fprintf(stderr, "Error: %s line %d: frame %ld not decoded\n", job->input, job->line, job->frames);
+                err = -1;
+                break;
+            }
+            if (job->mode == JOB_DEC)
+            {
+                fwrite(dec->buf->data, sizeof(Word16), dec->buf->size, out);
+            }
+            else
+            {
+                encode_frame(enc, (const char*)dec->buf->data, dec->buf->size, job->g192, out);
+            }
+            job->frames++;
+        }
+    }
+
+    if (fclose(out) != 0)
+    {
+        fprintf(stderr, "Error: can not write %s: %s\n", job->output, strerror(errno));
+        err = -1;
+    }
+    FreeEncoder(enc);
+    FreeDecoder(dec);
+    unmap_file(&pcm);
+    G192_Stream_Close(&stream);
+    return err;
+}
+
+/*------------------------------------------------------------------------------------------*
+ * Work-stealing pool: the jobs are dealt to the workers largest first, a worker runs its own
+ * jobs from the head of its queue and steals from the tail of the other queues when idle
+ *------------------------------------------------------------------------------------------*/
+
+static int take_job(WorkQueue *q, int steal)
+{
+    int j = -1;
+
+    pthread_mutex_lock(&q->lock);
+    if (q->head < q->tail)
+    {
+        j = steal ? q->job[--q->tail] : q->job[q->head++];
+    }
+    pthread_mutex_unlock(&q->lock);
+    return j;
+}
+
+static void *worker_main(void *arg)
+{
+    Worker *w = (Worker *)arg;
+    double cpu = now_sec(CLOCK_THREAD_CPUTIME_ID);
+    int j, k;
+
+    for (;;)
+    {
+        j = take_job(&w->queues[w->id], 0);
+        for (k = 1; j < 0 && k < w->nWorkers; k++)
+        {
+            if ((j = take_job(&w->queues[(w->id + k) % w->nWorkers], 1)) >= 0)
+            {
+                w->steals++;
+            }
+        }
+        if (j < 0)
+        {
+            break;                                      /* all queues are empty              */
+        }
+        w->jobs[j].failed = (run_job(&w->jobs[j], w->outBuf) != 0);
+    }
+
+    w->cpuSec = now_sec(CLOCK_THREAD_CPUTIME_ID) - cpu;
+    return NULL;
+}
+
+/*------------------------------------------------------------------------------------------*
+ * Manifest
+ *------------------------------------------------------------------------------------------*/
+
+static int parse_job(char *line, int lineNo, BatchJob *job)
+{
+    char mode[16], *opt, *save;
+    int n, pos;
+
+    memset(job, 0, sizeof(*job));
+    strcpy(job->band, "WB");
+    job->line = lineNo;
+
+    if (sscanf(line, "%15s %1023s %1023s %d %d %n", mode, job->input, job->output, &job->fs, &job->bitrate, &pos) < 5)
+    {
+        fprintf(stderr, "Error: manifest line %d: expected mode input output fs bitrate\n", lineNo);
+        return -1;
+    }
+    if (strcmp(mode, "enc") == 0)
+    {
+        job->mode = JOB_ENC;
+    }
+    else if (strcmp(mode, "dec") == 0)
+    {
+        job->mode = JOB_DEC;
+    }
+    else if (strcmp(mode, "trans") == 0)
+    {
+        job->mode = JOB_TRANS;
+    }
+    else
+    {
+        fprintf(stderr, "Error: manifest line %d: unknown mode %s\n", lineNo, mode);
+        return -1;
+    }
+    if (job->fs != 8000 && job->fs != 16000 && job->fs != 32000 && job->fs != 48000)
+    {
+        fprintf(stderr, "Error: manifest line %d: unsupported sampling rate %d\n", lineNo, job->fs);
+        return -1;
+    }
+
+    for (opt = strtok_r(line + pos, " \t\r\n", &save); opt != NULL; opt = strtok_r(NULL, " \t\r\n", &save))
+    {
+        if (strncmp(opt, "band=", 5) == 0 && strlen(opt + 5) < sizeof(job->band))
+        {
+            strcpy(job->band, opt + 5);
+        }
+        else if (sscanf(opt, "dtx=%d%n", &job->dtx, &n) == 1 && opt[n] == '\0')
+        {
+            continue;
+        }
+        else if (strcmp(opt, "format=g192") == 0 || strcmp(opt, "format=mime") == 0)
+        {
+            job->g192 = (opt[7] == 'g');
+        }
+        else
+        {
+            fprintf(stderr, "Error: manifest line %d: unknown option %s\n", lineNo, opt);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int read_manifest(const char *name, BatchJob **jobs, int *nJobs)
+{
+    FILE *f;
+    char line[4 * BATCH_MAX_LINE], *p;
+    int lineNo = 0, n = 0, size = 0, err = 0;
+    struct stat st;
+
+    if ((f = fopen(name, "r")) == NULL)
+    {
+        fprintf(stderr, "Error: can not open manifest %s: %s\n", name, strerror(errno));
+        return -1;
+    }
+    *jobs = NULL;
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        lineNo++;
+        if ((p = strchr(line, '#')) != NULL)
+        {
+            *p = '\0';
+        }
+        for (p = line; *p == ' ' || *p == '\t'; p++)
+        {
+        }
+        if (*p == '\0' || *p == '\n' || *p == '\r')
+        {
+            continue;
+        }
+        if (n == size)
+        {
+            BatchJob *grown;
+
+            size = size ? 2 * size : 64;
+            if ((grown = realloc(*jobs, size * sizeof(BatchJob))) == NULL)
+            {
+                fprintf(stderr, "Error: can not allocate memory for the manifest\n");
+                err = -1;
+                break;
+            }
+            *jobs = grown;
+        }
+        if (parse_job(p, lineNo, &(*jobs)[n]) != 0)
+        {
+            err = -1;
+            continue;
+        }
+        (*jobs)[n].size = (stat((*jobs)[n].input, &st) == 0) ? st.st_size : 0;
+        n++;
+    }
+    fclose(f);
+    *nJobs = n;
+    return err;
+}
+
+static int larger_job_first(const void *a, const void *b)
+{
+    off_t sa = (*(BatchJob *const *)a)->size, sb = (*(BatchJob *const *)b)->size;
+
+    return (sa < sb) - (sa > sb);
+}
+
+int main(int argc, char *argv[])
+{
+    BatchJob *jobs = NULL, **order = NULL;
+    Worker *workers = NULL;
+    WorkQueue *queues = NULL;
+    pthread_t *threads = NULL;
+    int nJobs, nWorkers = (int)sysconf(_SC_NPROCESSORS_ONLN), nLocks = 0, nThreads = 0, i, failed = 0, ret = 1;
+    long frames = 0, steals = 0;
+    double wall, cpu = 0, audio;
+
+    if (argc == 4 && strcmp(argv[1], "-t") == 0)
+    {
+        nWorkers = atoi(argv[2]);
+        argv += 2;
+        argc -= 2;
+    }
+    if (argc != 2 || nWorkers < 1)
+    {
+        fprintf(stderr, "Usage: EVS_batch [-t threads] manifest_file\n");
+        return 1;
+    }
+    if (read_manifest(argv[1], &jobs, &nJobs) != 0)
+    {
+        goto cleanup;
+    }
+    if (nJobs == 0)
+    {
+        fprintf(stderr, "Error: no streams in manifest %s\n", argv[1]);
+        goto cleanup;
+    }
+    if (nWorkers > nJobs)
+    {
+        nWorkers = nJobs;
+    }
+
+    workers = calloc(nWorkers, sizeof(Worker));
+    queues = calloc(nWorkers, sizeof(WorkQueue));
+    threads = calloc(nWorkers, sizeof(pthread_t));
+    order = calloc(nJobs, sizeof(BatchJob *));
+    if (workers == NULL || queues == NULL || threads == NULL || order == NULL)
+    {
+        fprintf(stderr, "Error: can not allocate memory for %d workers\n", nWorkers);
+        goto cleanup;
+    }
+
+    /* deal the jobs largest first, each queue is then ordered by decreasing size */
+    for (i = 0; i < nJobs; i++)
+    {
+        order[i] = &jobs[i];
+    }
+    qsort(order, nJobs, sizeof(BatchJob *), larger_job_first);
+    for (; nLocks < nWorkers; nLocks++)
+    {
+        pthread_mutex_init(&queues[nLocks].lock, NULL);
+    }
+    for (i = 0; i < nWorkers; i++)
+    {
+        if ((queues[i].job = malloc(((nJobs + nWorkers - 1) / nWorkers) * sizeof(int))) == NULL ||
+            (workers[i].outBuf = malloc(BATCH_OUT_BUF_SIZE)) == NULL)
+        {
+            fprintf(stderr, "Error: can not allocate memory for %d workers\n", nWorkers);
+            goto cleanup;
+        }
+    }
+    for (i = 0; i < nJobs; i++)
+    {
+        queues[i % nWorkers].job[queues[i % nWorkers].tail++] = (int)(order[i] - jobs);
+    }
+
+    wall = now_sec(CLOCK_MONOTONIC);
+    for (; nThreads < nWorkers; nThreads++)
+    {
+        workers[nThreads].id = nThreads;
+        workers[nThreads].nWorkers = nWorkers;
+        workers[nThreads].queues = queues;
+        workers[nThreads].jobs = jobs;
+        if (pthread_create(&threads[nThreads], NULL, worker_main, &workers[nThreads]) != 0)
+        {
+            fprintf(stderr, "Error: can not start worker thread %d\n", nThreads);
+            goto cleanup;
+        }
+    }
+    for (i = 0; i < nThreads; i++)
+    {
+        pthread_join(threads[i], NULL);
+        cpu += workers[i].cpuSec;
+        steals += workers[i].steals;
+    }
+    nThreads = 0;
+    wall = now_sec(CLOCK_MONOTONIC) - wall;
+
+    for (i = 0; i < nJobs; i++)
+    {
+        if (jobs[i].failed)
+        {
+            fprintf(stderr, "Failed: manifest line %d (%s)\n", jobs[i].line, jobs[i].input);
+            failed++;
+        }
+        frames += jobs[i].frames;
+    }
+    audio = frames * BATCH_FRAME_SEC;
+
+    fprintf(stderr, "\nEVS_batch: %d streams, %d failed, %d threads, %ld steals\n", nJobs, failed, nWorkers, steals);
+    fprintf(stderr, "  audio %.1f s, wall %.2f s, cpu %.2f s\n", audio, wall, cpu);
+    if (audio > 0 && wall > 0)
+    {
+        fprintf(stderr, "  aggregate %.1fx real time (RTF %.4f), %.1fx real time per thread\n",
+                audio / wall, wall / audio, audio / wall / nWorkers);
+    }
+    ret = failed ? 1 : 0;
+
+cleanup:
+    /* the workers already started still finish their queues before the memory goes */
+    for (i = 0; i < nThreads; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    for (i = 0; i < nLocks; i++)
+    {
+        pthread_mutex_destroy(&queues[i].lock);
+        free(queues[i].job);
+        free(workers[i].outBuf);
+    }
+    free(order);
+    free(threads);
+    free(queues);
+    free(workers);
+    free(jobs);
+
+    return ret;
+}